@@ -19,7 +19,8 @@ ContextConfig::ContextConfig(
     m_dbState(dbState),
     m_zmqEnable(false),
     m_zmqEndpoint("ipc:///tmp/zmq_ep"),
-    m_zmqNtfEndpoint("ipc:///tmp/zmq_ntf_ep")
+    m_zmqNtfEndpoint("ipc:///tmp/zmq_ntf_ep"),
+    m_zmqBinaryFraming(false)
 {
     SWSS_LOG_ENTER();
 
@@ -46,6 +46,8 @@ namespace sairedis
 
             std::string m_zmqNtfEndpoint;
 
+            bool m_zmqBinaryFraming;
+
             std::shared_ptr<SwitchConfigContainer> m_scc;
     };
 }
@@ -127,10 +127,16 @@ std::shared_ptr<ContextConfigContainer> ContextConfigContainer::loadFromFile(
             cc->m_zmqEndpoint = item["zmq_endpoint"];
             cc->m_zmqNtfEndpoint = item["zmq_ntf_endpoint"];
 
-            SWSS_LOG_NOTICE("contextConfig zmq enable %s, endpoint: %s, ntf endpoint: %s",
+            if (item.find("zmq_binary_framing") != item.end())
+            {
+                cc->m_zmqBinaryFraming = item["zmq_binary_framing"];
+            }
+
+            SWSS_LOG_NOTICE("contextConfig zmq enable %s, endpoint: %s, ntf endpoint: %s, binary framing: %s",
                     (cc->m_zmqEnable) ? "true" : "false",
                     cc->m_zmqEndpoint.c_str(),
-                    cc->m_zmqNtfEndpoint.c_str());
+                    cc->m_zmqNtfEndpoint.c_str(),
+                    (cc->m_zmqBinaryFraming) ? "true" : "false");
 
             for (size_t k = 0; k < item["switches"].size(); k++)
             {
@@ -0,0 +1,134 @@
+#include "GzipInputStreamBuf.h"
+
+#include "swss/logger.h"
+
+using namespace sairedis;
+
+#define GZIP_INPUT_BUFFER_SIZE (64 * 1024)
+
+GzipInputStreamBuf::GzipInputStreamBuf():
+    m_file(NULL),
+    m_buffer(GZIP_INPUT_BUFFER_SIZE)
+{
+    SWSS_LOG_ENTER();
+
+    setg(m_buffer.data(), m_buffer.data(), m_buffer.data());
+}
+
+GzipInputStreamBuf::~GzipInputStreamBuf()
+{
+    SWSS_LOG_ENTER();
+
+    close();
+}
+
+bool GzipInputStreamBuf::open(
+        _In_ const std::string& path)
+{
+    SWSS_LOG_ENTER();
+
+    close();
+
+    m_file = gzopen(path.c_str(), "rb");
+
+    if (m_file == NULL)
+    {
+        SWSS_LOG_ERROR("failed to open %s", path.c_str());
+
+        return false;
+    }
+
+    gzbuffer(m_file, GZIP_INPUT_BUFFER_SIZE);
+
+    return true;
+}
+
+void GzipInputStreamBuf::close()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_file)
+    {
+        gzclose(m_file);
+
+        m_file = NULL;
+    }
+
+    setg(m_buffer.data(), m_buffer.data(), m_buffer.data());
+}
+
+bool GzipInputStreamBuf::is_open() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_file != NULL;
+}
+
+GzipInputStreamBuf::int_type GzipInputStreamBuf::underflow()
+{
+    SWSS_LOG_ENTER();
+
+    if (gptr() < egptr())
+    {
+        return traits_type::to_int_type(*gptr());
+    }
+
+    if (m_file == NULL)
+    {
+        return traits_type::eof();
+    }
+
+    int n = gzread(m_file, m_buffer.data(), (unsigned)m_buffer.size());
+
+    if (n <= 0)
+    {
+        if (n < 0)
+        {
+            int err;
+
+            SWSS_LOG_ERROR("failed to read: %s", gzerror(m_file, &err));
+        }
+
+        return traits_type::eof();
+    }
+
+    setg(m_buffer.data(), m_buffer.data(), m_buffer.data() + n);
+
+    return traits_type::to_int_type(*gptr());
+}
+
+GzipInputStreamBuf::pos_type GzipInputStreamBuf::seekoff(
+        _In_ off_type off,
+        _In_ std::ios_base::seekdir dir,
+        _In_ std::ios_base::openmode which)
+{
+    SWSS_LOG_ENTER();
+
+    if (off == 0 && dir == std::ios_base::beg)
+    {
+        return seekpos(0, which);
+    }
+
+    return pos_type(off_type(-1));
+}
+
+GzipInputStreamBuf::pos_type GzipInputStreamBuf::seekpos(
+        _In_ pos_type pos,
+        _In_ std::ios_base::openmode which)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_file == NULL || pos != pos_type(0) || (which & std::ios_base::in) == 0)
+    {
+        return pos_type(off_type(-1));
+    }
+
+    if (gzrewind(m_file) != 0)
+    {
+        return pos_type(off_type(-1));
+    }
+
+    setg(m_buffer.data(), m_buffer.data(), m_buffer.data());
+
+    return pos_type(0);
+}
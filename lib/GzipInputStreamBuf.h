@@ -0,0 +1,62 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <zlib.h>
+
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace sairedis
+{
+    /**
+     * @brief Input stream buffer reading gzip compressed file.
+     *
+     * Files which are not compressed are read as they are, so the same
+     * stream can be used for plain and compressed recordings. Only seeking
+     * to the beginning of the file is supported.
+     */
+    class GzipInputStreamBuf:
+        public std::streambuf
+    {
+        private:
+
+            GzipInputStreamBuf(const GzipInputStreamBuf&) = delete;
+            GzipInputStreamBuf& operator=(const GzipInputStreamBuf&) = delete;
+
+        public:
+
+            GzipInputStreamBuf();
+
+            virtual ~GzipInputStreamBuf();
+
+        public:
+
+            bool open(
+                    _In_ const std::string& path);
+
+            void close();
+
+            bool is_open() const;
+
+        protected:
+
+            virtual int_type underflow() override;
+
+            virtual pos_type seekoff(
+                    _In_ off_type off,
+                    _In_ std::ios_base::seekdir dir,
+                    _In_ std::ios_base::openmode which) override;
+
+            virtual pos_type seekpos(
+                    _In_ pos_type pos,
+                    _In_ std::ios_base::openmode which) override;
+
+        private:
+
+            gzFile m_file;
+
+            std::vector<char> m_buffer;
+    };
+}
@@ -0,0 +1,148 @@
+#include "LeasedVidIndexGenerator.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <inttypes.h>
+
+using namespace sairedis;
+
+constexpr uint64_t LeasedVidIndexGenerator::DEFAULT_MIN_BLOCK_SIZE;
+constexpr uint64_t LeasedVidIndexGenerator::DEFAULT_MAX_BLOCK_SIZE;
+constexpr uint64_t LeasedVidIndexGenerator::DEFAULT_GROW_INTERVAL_MS;
+
+LeasedVidIndexGenerator::LeasedVidIndexGenerator(
+        _In_ std::shared_ptr<OidIndexGenerator> generator,
+        _In_ uint64_t minBlockSize,
+        _In_ uint64_t maxBlockSize,
+        _In_ uint64_t growIntervalMs):
+    m_generator(generator),
+    m_minBlockSize(minBlockSize),
+    m_maxBlockSize(maxBlockSize),
+    m_growInterval(growIntervalMs),
+    m_blockSize(minBlockSize),
+    m_next(0),
+    m_end(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_generator == nullptr)
+    {
+        SWSS_LOG_THROW("generator can't be nullptr");
+    }
+
+    if (m_minBlockSize == 0 || m_minBlockSize > m_maxBlockSize)
+    {
+        SWSS_LOG_THROW("invalid block size range: %" PRIu64 " - %" PRIu64, m_minBlockSize, m_maxBlockSize);
+    }
+}
+
+void LeasedVidIndexGenerator::lease()
+{
+    SWSS_LOG_ENTER();
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (m_end != 0)
+    {
+        // previous block was used up, adjust size to allocation rate
+
+        if (now - m_leaseTime < m_growInterval)
+        {
+            m_blockSize = std::min(m_blockSize * 2, m_maxBlockSize);
+        }
+        else
+        {
+            m_blockSize = m_minBlockSize;
+        }
+    }
+
+    m_next = m_generator->incrementRange(m_blockSize);
+
+    m_end = m_next + m_blockSize;
+
+    m_leaseTime = now;
+
+    SWSS_LOG_INFO("leased VID indexes %" PRIu64 " - %" PRIu64, m_next, m_end - 1);
+}
+
+uint64_t LeasedVidIndexGenerator::increment()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_next >= m_end)
+    {
+        lease();
+    }
+
+    return m_next++;
+}
+
+std::vector<uint64_t> LeasedVidIndexGenerator::incrementBy(
+    _In_ uint64_t count)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t first = incrementRange(count);
+
+    std::vector<uint64_t> result;
+    result.reserve(static_cast<size_t>(count));
+
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        result.push_back(first + i);
+    }
+
+    return result;
+}
+
+uint64_t LeasedVidIndexGenerator::incrementRange(
+    _In_ uint64_t count)
+{
+    SWSS_LOG_ENTER();
+
+    if (count > m_end - m_next)
+    {
+        if (count <= m_blockSize)
+        {
+            lease();
+        }
+
+        if (count > m_end - m_next)
+        {
+            // large range is reserved directly and current lease is kept
+
+            return m_generator->incrementRange(count);
+        }
+    }
+
+    uint64_t first = m_next;
+
+    m_next += count;
+
+    return first;
+}
+
+void LeasedVidIndexGenerator::reset()
+{
+    SWSS_LOG_ENTER();
+
+    m_next = 0;
+    m_end = 0;
+
+    m_blockSize = m_minBlockSize;
+}
+
+uint64_t LeasedVidIndexGenerator::getBlockSize() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_blockSize;
+}
+
+uint64_t LeasedVidIndexGenerator::getRemainingCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_end - m_next;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "OidIndexGenerator.h"
+
+#include "swss/sal.h"
+
+#include <memory>
+#include <chrono>
+
+namespace sairedis
+{
+    /**
+     * @brief VID index generator leasing blocks of indexes.
+     *
+     * Blocks of indexes are reserved from underlying generator with single
+     * call and then handed out locally, so creating many objects does not
+     * cost one redis round trip per object. When block is used up quickly,
+     * next block is made twice as large, up to maximum block size. When
+     * block lasts long, block size goes back to minimum.
+     *
+     * Indexes left in a block which is dropped are never used, which is
+     * fine since VIDs only need to be unique.
+     */
+    class LeasedVidIndexGenerator:
+        public OidIndexGenerator
+    {
+        public:
+
+            static constexpr uint64_t DEFAULT_MIN_BLOCK_SIZE = 16;
+
+            static constexpr uint64_t DEFAULT_MAX_BLOCK_SIZE = 8192;
+
+            static constexpr uint64_t DEFAULT_GROW_INTERVAL_MS = 1000;
+
+        public:
+
+            LeasedVidIndexGenerator(
+                    _In_ std::shared_ptr<OidIndexGenerator> generator,
+                    _In_ uint64_t minBlockSize = DEFAULT_MIN_BLOCK_SIZE,
+                    _In_ uint64_t maxBlockSize = DEFAULT_MAX_BLOCK_SIZE,
+                    _In_ uint64_t growIntervalMs = DEFAULT_GROW_INTERVAL_MS);
+
+            virtual ~LeasedVidIndexGenerator() = default;
+
+        public:
+
+            virtual uint64_t increment() override;
+
+            virtual std::vector<uint64_t> incrementBy(
+                _In_ uint64_t count) override;
+
+            virtual uint64_t incrementRange(
+                _In_ uint64_t count) override;
+
+            /**
+             * @brief Drop current lease, next index will be taken from new
+             * block.
+             */
+            virtual void reset() override;
+
+        public:
+
+            uint64_t getBlockSize() const;
+
+            uint64_t getRemainingCount() const;
+
+        private:
+
+            void lease();
+
+        private:
+
+            std::shared_ptr<OidIndexGenerator> m_generator;
+
+            uint64_t m_minBlockSize;
+
+            uint64_t m_maxBlockSize;
+
+            std::chrono::milliseconds m_growInterval;
+
+            uint64_t m_blockSize;
+
+            /**
+             * @brief Next index to hand out, valid when smaller than m_end.
+             */
+            uint64_t m_next;
+
+            uint64_t m_end;
+
+            std::chrono::steady_clock::time_point m_leaseTime;
+    };
+}
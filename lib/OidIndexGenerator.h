@@ -22,6 +22,14 @@ namespace sairedis
             virtual std::vector<uint64_t> incrementBy(
                 _In_ uint64_t count) = 0;
 
+            /**
+             * @brief Reserve contiguous range of indexes.
+             *
+             * @return First index of range [first, first + count).
+             */
+            virtual uint64_t incrementRange(
+                _In_ uint64_t count) = 0;
+
             virtual void reset() = 0;
     };
 }
@@ -7,10 +7,14 @@
 
 #include <unistd.h>
 #include <inttypes.h>
+#include <sys/stat.h>
 
 #include <cstring>
+#include <cstdlib>
 #include <vector>
 #include <fstream>
+#include <chrono>
+#include <set>
 
 using namespace sairedis;
 using namespace saimeta;
@@ -22,6 +26,46 @@ std::vector<swss::FieldValueTuple> serialize_counter_id_list(
 
 #define MUTEX() std::lock_guard<std::mutex> _lock(m_mutex)
 #define DEFAULT_RECORDING_FILE_NAME "sairedis.rec"
+
+#define RECORDER_STAGING_BUFFER_SIZE (64 * 1024)
+
+/*
+ * In async mode records are written at least every writer interval, so
+ * when process is killed without flushing recorder, up to last interval of
+ * records can be lost. Recorder is flushed when async recording is
+ * disabled, on recorder destruction, at process exit (also when SIGTERM
+ * handler ends process with exit()), and by RedisRemoteSaiInterface on
+ * shutdown request and on failure dump before client aborts.
+ */
+#define RECORDER_WRITER_INTERVAL_MS 100
+
+/*
+ * Recorders with running async writer, flushed from atexit handler.
+ */
+static std::mutex g_asyncRecordersMutex;
+
+static std::set<Recorder*> g_asyncRecorders;
+
+static void flushAsyncRecordersAtExit()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(g_asyncRecordersMutex);
+
+    for (auto* recorder: g_asyncRecorders)
+    {
+        recorder->flush();
+    }
+}
+
+/*
+ * Binary recording starts with magic header, followed by records. Each
+ * record is varint encoded timestamp in microseconds since epoch, varint
+ * encoded length of record string, and record string itself.
+ */
+#define RECORDER_BINARY_MAGIC "SAIRDRC1"
+#define RECORDER_BINARY_MAGIC_SIZE 8
+
 Recorder::Recorder()
 {
     SWSS_LOG_ENTER();
@@ -35,12 +79,34 @@ Recorder::Recorder()
     m_enabled = false;
 
     m_recordStats = true;
+
+    m_recordingFormat = SAI_REDIS_RECORDING_FORMAT_TEXT;
+
+    m_fileFormat = SAI_REDIS_RECORDING_FORMAT_TEXT;
+
+    m_asyncRecording = false;
+
+    m_runWriter = false;
+
+    m_rotateSize = 0;
+
+    m_rotateInterval = 0;
+
+    m_rotateCompress = true;
+
+    m_rotateMaxSegments = 0;
+
+    m_recordingFileSize = 0;
+
+    m_recordingFileOpenTime = 0;
 }
 
 Recorder::~Recorder()
 {
     SWSS_LOG_ENTER();
 
+    stopAsyncWriter();
+
     stopRecording();
 }
 
@@ -166,19 +232,506 @@ void Recorder::enableRecording(
 void Recorder::recordLine(
         _In_ const std::string& line)
 {
+    SWSS_LOG_ENTER();
+
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    Record record;
+
+    gettimeofday(&record.m_timestamp, NULL);
+
+    record.m_line = line;
+
+    if (m_asyncRecording && enqueueRecord(record))
+    {
+        return;
+    }
+
     MUTEX();
 
+    // records could be left in buffer after async recording was disabled
+
+    writeBufferedRecords();
+
+    if (m_ofstream.is_open())
+    {
+        appendRecord(record);
+
+        writeBatch();
+    }
+}
+
+bool Recorder::enqueueRecord(
+        _Inout_ Record& record)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    // enqueue will not move record if buffer is full
+
+    while (!m_stagingBuffer->tryEnqueue(std::move(record)))
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (!m_runWriter)
+        {
+            // writer is stopping, record will be written synchronously
+
+            return false;
+        }
+
+        m_writerCv.notify_one();
+
+        m_spaceCv.wait(lock, [&]{
+                return !m_runWriter || m_stagingBuffer->size() < m_stagingBuffer->capacity(); });
+    }
+
+    if (m_stagingBuffer->size() >= m_stagingBuffer->capacity() / 2)
+    {
+        m_writerCv.notify_one();
+    }
+
+    return true;
+}
+
+void Recorder::enableAsyncRecording(
+        _In_ bool enabled)
+{
     SWSS_LOG_ENTER();
 
-    if (!m_enabled)
+    if (enabled)
+    {
+        startAsyncWriter();
+    }
+    else
+    {
+        stopAsyncWriter();
+    }
+}
+
+void Recorder::setRecordingFormat(
+        _In_ sai_redis_recording_format_t format)
+{
+    SWSS_LOG_ENTER();
+
+    switch (format)
     {
+        case SAI_REDIS_RECORDING_FORMAT_TEXT:
+        case SAI_REDIS_RECORDING_FORMAT_BINARY:
+            break;
+
+        default:
+            SWSS_LOG_THROW("unknown recording format %d", format);
+    }
+
+    MUTEX();
+
+    m_recordingFormat = format;
+
+    SWSS_LOG_NOTICE("setting recording format to %s, will be used on next recording file",
+            format == SAI_REDIS_RECORDING_FORMAT_BINARY ? "binary" : "text");
+}
+
+void Recorder::flush()
+{
+    SWSS_LOG_ENTER();
+
+    MUTEX();
+
+    writeBufferedRecords();
+
+    // rotation is checked on flush also when there was nothing to write
+
+    rotateIfRequired();
+}
+
+void Recorder::setRotateSize(
+        _In_ uint64_t size)
+{
+    SWSS_LOG_ENTER();
+
+    MUTEX();
+
+    m_rotateSize = size;
+
+    SWSS_LOG_NOTICE("setting recording rotate size to %" PRIu64 " bytes", size);
+}
+
+void Recorder::setRotateInterval(
+        _In_ uint32_t seconds)
+{
+    SWSS_LOG_ENTER();
+
+    MUTEX();
+
+    m_rotateInterval = seconds;
+
+    SWSS_LOG_NOTICE("setting recording rotate interval to %u seconds", seconds);
+}
+
+void Recorder::setRotateCompress(
+        _In_ bool compress)
+{
+    SWSS_LOG_ENTER();
+
+    MUTEX();
+
+    m_rotateCompress = compress;
+}
+
+void Recorder::setRotateMaxSegments(
+        _In_ uint32_t maxSegments)
+{
+    SWSS_LOG_ENTER();
+
+    MUTEX();
+
+    m_rotateMaxSegments = maxSegments;
+}
+
+void Recorder::openRecordingFile()
+{
+    SWSS_LOG_ENTER();
+
+    m_recordingFile = m_recordingOutputDirectory + "/" + m_recordingFileName;
+
+    m_fileFormat = m_recordingFormat;
+
+    bool empty = true;
+
+    struct stat st;
+
+    if (stat(m_recordingFile.c_str(), &st) == 0 && st.st_size > 0)
+    {
+        // we are appending to existing file, so keep its format
+
+        std::ifstream existing(m_recordingFile, std::ifstream::binary);
+
+        m_fileFormat = readBinaryHeader(existing)
+            ? SAI_REDIS_RECORDING_FORMAT_BINARY
+            : SAI_REDIS_RECORDING_FORMAT_TEXT;
+
+        if (m_fileFormat != m_recordingFormat)
+        {
+            SWSS_LOG_WARN("recording file %s already exists in different format, keeping its format",
+                    m_recordingFile.c_str());
+        }
+
+        empty = false;
+    }
+
+    m_ofstream.open(m_recordingFile, std::ofstream::out | std::ofstream::app | std::ofstream::binary);
+
+    if (!m_ofstream.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open recording file %s: %s", m_recordingFile.c_str(), strerror(errno));
         return;
     }
 
+    m_recordingFileSize = empty ? 0 : (uint64_t)st.st_size;
+
+    m_recordingFileOpenTime = time(NULL);
+
+    if (empty && m_fileFormat == SAI_REDIS_RECORDING_FORMAT_BINARY)
+    {
+        m_ofstream.write(RECORDER_BINARY_MAGIC, RECORDER_BINARY_MAGIC_SIZE);
+
+        m_recordingFileSize += RECORDER_BINARY_MAGIC_SIZE;
+    }
+}
+
+static void appendVarint(
+        _Inout_ std::string& buffer,
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    while (value >= 0x80)
+    {
+        buffer.push_back((char)((value & 0x7f) | 0x80));
+
+        value >>= 7;
+    }
+
+    buffer.push_back((char)value);
+}
+
+static bool readVarint(
+        _Inout_ std::istream& in,
+        _Out_ uint64_t& value)
+{
+    SWSS_LOG_ENTER();
+
+    value = 0;
+
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        int c = in.get();
+
+        if (c == std::char_traits<char>::eof())
+        {
+            return false;
+        }
+
+        value |= (uint64_t)(c & 0x7f) << shift;
+
+        if ((c & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Recorder::appendRecord(
+        _In_ const Record& record)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_fileFormat == SAI_REDIS_RECORDING_FORMAT_BINARY)
+    {
+        uint64_t usec = (uint64_t)record.m_timestamp.tv_sec * 1000000 + (uint64_t)record.m_timestamp.tv_usec;
+
+        appendVarint(m_writeBatch, usec);
+
+        appendVarint(m_writeBatch, record.m_line.size());
+
+        m_writeBatch += record.m_line;
+
+        return;
+    }
+
+    m_writeBatch += getTimestamp(record.m_timestamp);
+    m_writeBatch += "|";
+    m_writeBatch += record.m_line;
+    m_writeBatch += "\n";
+}
+
+void Recorder::writeBufferedRecords()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_stagingBuffer == nullptr || m_stagingBuffer->empty())
+    {
+        return;
+    }
+
+    Record record;
+
+    while (m_stagingBuffer->tryDequeue(record))
+    {
+        // records are dropped when file is not opened, same as in sync mode
+
+        if (m_ofstream.is_open())
+        {
+            appendRecord(record);
+        }
+    }
+
     if (m_ofstream.is_open())
     {
-        m_ofstream << getTimestamp() << "|" << line << std::endl;
+        writeBatch();
+    }
+
+    m_writeBatch.clear();
+
+    // wake up producers waiting for space in staging buffer
+
+    m_spaceCv.notify_all();
+}
+
+void Recorder::writeBatch()
+{
+    SWSS_LOG_ENTER();
+
+    m_ofstream.write(m_writeBatch.data(), m_writeBatch.size());
+
+    m_ofstream.flush();
+
+    m_recordingFileSize += m_writeBatch.size();
+
+    m_writeBatch.clear();
+
+    rotateIfRequired();
+}
+
+void Recorder::rotateIfRequired()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_ofstream.is_open())
+    {
+        return;
+    }
+
+    bool rotate = false;
+
+    if (m_rotateSize && m_recordingFileSize >= m_rotateSize)
+    {
+        rotate = true;
+    }
+
+    if (m_rotateInterval && time(NULL) - m_recordingFileOpenTime >= (time_t)m_rotateInterval)
+    {
+        rotate = true;
+    }
+
+    if (rotate)
+    {
+        rotateRecordingFile();
+    }
+}
+
+void Recorder::rotateRecordingFile()
+{
+    SWSS_LOG_ENTER();
+
+    m_ofstream.close();
+
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+
+    std::string segment = RecordingCompressor::getSegmentFileName(m_recordingFile, tv);
+
+    if (rename(m_recordingFile.c_str(), segment.c_str()) != 0)
+    {
+        SWSS_LOG_ERROR("failed to rename %s to %s: %s", m_recordingFile.c_str(), segment.c_str(), strerror(errno));
+    }
+    else
+    {
+        if (m_compressor == nullptr)
+        {
+            m_compressor = std::make_shared<RecordingCompressor>();
+        }
+
+        m_compressor->push(segment, m_rotateCompress, m_recordingOutputDirectory, m_recordingFileName, m_rotateMaxSegments);
+    }
+
+    openRecordingFile();
+
+    if (!m_ofstream.is_open())
+    {
+        return;
+    }
+
+    // record rotation directly, recordLine would take recorder mutex again
+
+    Record record;
+
+    record.m_timestamp = tv;
+    record.m_line = "#|rotated from: " + segment;
+
+    appendRecord(record);
+
+    m_ofstream.write(m_writeBatch.data(), m_writeBatch.size());
+
+    m_recordingFileSize += m_writeBatch.size();
+
+    m_writeBatch.clear();
+}
+
+void Recorder::startAsyncWriter()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_writerThread)
+    {
+        return;
+    }
+
+    {
+        MUTEX();
+
+        if (m_stagingBuffer == nullptr)
+        {
+            m_stagingBuffer = std::make_shared<saimeta::MpscRingBuffer<Record>>(RECORDER_STAGING_BUFFER_SIZE);
+        }
+
+        m_runWriter = true;
+    }
+
+    m_writerThread = std::make_shared<std::thread>(&Recorder::asyncWriterThreadFunction, this);
+
+    m_asyncRecording = true;
+
+    static std::once_flag atExitRegistered;
+
+    std::call_once(atExitRegistered, []{ std::atexit(flushAsyncRecordersAtExit); });
+
+    {
+        std::lock_guard<std::mutex> lock(g_asyncRecordersMutex);
+
+        g_asyncRecorders.insert(this);
     }
+
+    SWSS_LOG_NOTICE("async recording enabled");
+}
+
+void Recorder::stopAsyncWriter()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_writerThread == nullptr)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_asyncRecordersMutex);
+
+        g_asyncRecorders.erase(this);
+    }
+
+    m_asyncRecording = false;
+
+    {
+        MUTEX();
+
+        m_runWriter = false;
+    }
+
+    m_writerCv.notify_all();
+
+    m_spaceCv.notify_all();
+
+    m_writerThread->join();
+
+    m_writerThread = nullptr;
+
+    SWSS_LOG_NOTICE("async recording disabled");
+}
+
+void Recorder::asyncWriterThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("starting recorder writer thread");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_writerCv.wait_for(lock, std::chrono::milliseconds(RECORDER_WRITER_INTERVAL_MS), [&]{
+                return !m_runWriter || m_stagingBuffer->size() >= m_stagingBuffer->capacity() / 2; });
+
+        writeBufferedRecords();
+
+        // writer wakes up at least every interval, so time based rotation
+        // happens also when there is nothing to record
+
+        rotateIfRequired();
+
+        if (!m_runWriter)
+        {
+            break;
+        }
+    }
+
+    SWSS_LOG_NOTICE("ending recorder writer thread");
 }
 
 void Recorder::requestLogRotate()
@@ -198,6 +751,10 @@ void Recorder::recordingFileReopen()
 
     SWSS_LOG_ENTER();
 
+    // buffered records belong to file before rotation
+
+    writeBufferedRecords();
+
     m_ofstream.close();
 
     /*
@@ -206,30 +763,20 @@ void Recorder::recordingFileReopen()
      * empty file here.
      */
 
-    m_recordingFile = m_recordingOutputDirectory + "/" + m_recordingFileName;
-
-    m_ofstream.open(m_recordingFile, std::ofstream::out | std::ofstream::app);
-
-    if (!m_ofstream.is_open())
-    {
-        SWSS_LOG_ERROR("failed to open recording file %s: %s", m_recordingFile.c_str(), strerror(errno));
-        return;
-    }
+    openRecordingFile();
 }
 
 void Recorder::startRecording()
 {
     SWSS_LOG_ENTER();
 
-    m_recordingFile = m_recordingOutputDirectory + "/" + m_recordingFileName;
-
     {
         MUTEX();
-        m_ofstream.open(m_recordingFile, std::ofstream::out | std::ofstream::app);
+
+        openRecordingFile();
 
         if (!m_ofstream.is_open())
         {
-            SWSS_LOG_ERROR("failed to open recording file %s: %s", m_recordingFile.c_str(), strerror(errno));
             return;
         }
     }
@@ -247,6 +794,8 @@ void Recorder::stopRecording()
 
     SWSS_LOG_NOTICE("stopped recording");
 
+    writeBufferedRecords();
+
     if (m_ofstream.is_open())
     {
         m_ofstream.close();
@@ -259,11 +808,20 @@ std::string Recorder::getTimestamp()
 {
     SWSS_LOG_ENTER();
 
-    char buffer[64];
     struct timeval tv;
 
     gettimeofday(&tv, NULL);
 
+    return getTimestamp(tv);
+}
+
+std::string Recorder::getTimestamp(
+        _In_ const struct timeval& tv)
+{
+    SWSS_LOG_ENTER();
+
+    char buffer[64];
+
     struct tm now;
     localtime_r(&tv.tv_sec, &now);
 
@@ -274,6 +832,99 @@ std::string Recorder::getTimestamp()
     return std::string(buffer);
 }
 
+bool Recorder::readBinaryHeader(
+        _Inout_ std::istream& in)
+{
+    SWSS_LOG_ENTER();
+
+    char magic[RECORDER_BINARY_MAGIC_SIZE];
+
+    in.read(magic, RECORDER_BINARY_MAGIC_SIZE);
+
+    if (in.gcount() == RECORDER_BINARY_MAGIC_SIZE &&
+            memcmp(magic, RECORDER_BINARY_MAGIC, RECORDER_BINARY_MAGIC_SIZE) == 0)
+    {
+        return true;
+    }
+
+    in.clear();
+    in.seekg(0);
+
+    return false;
+}
+
+bool Recorder::readBinaryRecord(
+        _Inout_ std::istream& in,
+        _Out_ std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    line.clear();
+
+    uint64_t usec;
+    uint64_t length;
+
+    if (in.peek() == std::char_traits<char>::eof())
+    {
+        return false;
+    }
+
+    if (!readVarint(in, usec) || !readVarint(in, length))
+    {
+        SWSS_LOG_ERROR("binary record header truncated");
+
+        return false;
+    }
+
+    std::string record(length, '\0');
+
+    in.read(&record[0], length);
+
+    if ((uint64_t)in.gcount() != length)
+    {
+        SWSS_LOG_ERROR("binary record truncated, expected %" PRIu64 " bytes, got %ld", length, (long)in.gcount());
+
+        return false;
+    }
+
+    struct timeval tv;
+
+    tv.tv_sec = (time_t)(usec / 1000000);
+    tv.tv_usec = (suseconds_t)(usec % 1000000);
+
+    line = getTimestamp(tv) + "|" + record;
+
+    return true;
+}
+
+bool Recorder::convertBinaryToText(
+        _Inout_ std::istream& in,
+        _Inout_ std::ostream& out)
+{
+    SWSS_LOG_ENTER();
+
+    if (!readBinaryHeader(in))
+    {
+        SWSS_LOG_ERROR("input is not binary recording");
+
+        return false;
+    }
+
+    std::string line;
+
+    while (in.peek() != std::char_traits<char>::eof())
+    {
+        if (!readBinaryRecord(in, line))
+        {
+            return false;
+        }
+
+        out << line << "\n";
+    }
+
+    return true;
+}
+
 // SAI APIs record functions
 
 void Recorder::recordFlushFdbEntries(
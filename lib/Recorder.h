@@ -8,10 +8,22 @@ extern "C" {
 
 #include "sairedis.h"
 #include "meta/SaiInterface.h"
+#include "meta/MpscRingBuffer.h"
+
+#include "RecordingCompressor.h"
+
+#include <sys/time.h>
 
 #include <string>
 #include <fstream>
+#include <istream>
+#include <ostream>
 #include <vector>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <condition_variable>
 
 #define SAI_REDIS_RECORDER_DECLARE_RECORD_REMOVE(X,ot)   \
     void recordRemove(                                   \
@@ -402,10 +414,106 @@ namespace sairedis
             void recordComment(
                     _In_ const std::string& comment);
 
+            /**
+             * @brief Enable or disable asynchronous recording.
+             *
+             * In asynchronous mode records are put into lock-free staging
+             * buffer and written to recording file in batches by background
+             * writer thread. When disabled, all buffered records are written
+             * before returning.
+             *
+             * Records are written at least every 100 ms, so if process is
+             * killed without flush, records from that window may be lost.
+             */
+            void enableAsyncRecording(
+                    _In_ bool enabled);
+
+            /**
+             * @brief Set recording format.
+             *
+             * Format is applied when recording file is opened. If opened
+             * file already contains records, its existing format is kept.
+             */
+            void setRecordingFormat(
+                    _In_ sai_redis_recording_format_t format);
+
+            /**
+             * @brief Write all buffered records and flush recording file.
+             *
+             * Rotation policy is also checked, so flush can be used to
+             * rotate file by time when nothing is recorded.
+             */
+            void flush();
+
+            /**
+             * @brief Set recording file size which triggers rotation, 0
+             * disables size based rotation.
+             */
+            void setRotateSize(
+                    _In_ uint64_t size);
+
+            /**
+             * @brief Set recording file age in seconds which triggers
+             * rotation, 0 disables time based rotation.
+             *
+             * File age is checked on each write, on flush and, in async
+             * mode, on each writer thread wake up.
+             */
+            void setRotateInterval(
+                    _In_ uint32_t seconds);
+
+            /**
+             * @brief Set whether rotated segments are compressed with
+             * gzip, enabled by default.
+             */
+            void setRotateCompress(
+                    _In_ bool compress);
+
+            /**
+             * @brief Set number of rotated segments to keep, 0 keeps all.
+             */
+            void setRotateMaxSegments(
+                    _In_ uint32_t maxSegments);
+
         public: // static helper functions
 
             static std::string getTimestamp();
 
+            static std::string getTimestamp(
+                    _In_ const struct timeval& tv);
+
+            /**
+             * @brief Consume binary recording header from input stream.
+             *
+             * @return True if stream starts with binary recording header,
+             * false otherwise, in which case stream is rewound to the start.
+             */
+            static bool readBinaryHeader(
+                    _Inout_ std::istream& in);
+
+            /**
+             * @brief Read single binary record and convert it to text line.
+             *
+             * Returned line is the same as line written in text format,
+             * without trailing new line.
+             *
+             * @return True on success, false on end of stream or when record
+             * is truncated.
+             */
+            static bool readBinaryRecord(
+                    _Inout_ std::istream& in,
+                    _Out_ std::string& line);
+
+            /**
+             * @brief Convert binary recording to text recording.
+             *
+             * @return True on success, false if input is not binary recording
+             * or is truncated.
+             */
+            static bool convertBinaryToText(
+                    _Inout_ std::istream& in,
+                    _Inout_ std::ostream& out);
+
             void recordStats(
                     _In_ bool enable);
 
@@ -443,11 +551,81 @@ namespace sairedis
             void recordLine(
                     _In_ const std::string& line);
 
+        private: // buffered writing helpers
+
+            struct Record
+            {
+                struct timeval m_timestamp;
+
+                std::string m_line;
+            };
+
+            /**
+             * @brief Open recording file and select its format.
+             *
+             * Must be called with recorder mutex held.
+             */
+            void openRecordingFile();
+
+            /**
+             * @brief Append record to write batch in current file format.
+             */
+            void appendRecord(
+                    _In_ const Record& record);
+
+            /**
+             * @brief Write all records from staging buffer and flush file.
+             *
+             * Must be called with recorder mutex held.
+             */
+            void writeBufferedRecords();
+
+            /**
+             * @brief Write batch to recording file and rotate file if
+             * rotation policy requires.
+             *
+             * Must be called with recorder mutex held.
+             */
+            void writeBatch();
+
+            /**
+             * @brief Close recording file, hand it over to compressor and
+             * open new recording file.
+             *
+             * Must be called with recorder mutex held.
+             */
+            void rotateRecordingFile();
+
+            /**
+             * @brief Rotate recording file if its size or age reached
+             * rotation limit.
+             *
+             * Must be called with recorder mutex held.
+             */
+            void rotateIfRequired();
+
+            void startAsyncWriter();
+
+            void stopAsyncWriter();
+
+            void asyncWriterThreadFunction();
+
+            /**
+             * @brief Put record into staging buffer.
+             *
+             * When buffer is full, waits until writer thread makes space.
+             *
+             * @return False if writer is stopping and record must be
+             * written synchronously.
+             */
+            bool enqueueRecord(
+                    _Inout_ Record& record);
+
         private:
 
             bool m_performLogRotate;
 
-            bool m_enabled;
+            std::atomic<bool> m_enabled;
 
             bool m_recordStats;
 
@@ -460,5 +638,47 @@ namespace sairedis
             std::ofstream m_ofstream;
 
             std::mutex m_mutex;
+
+            sai_redis_recording_format_t m_recordingFormat;
+
+            /**
+             * @brief Format of currently opened recording file.
+             */
+            sai_redis_recording_format_t m_fileFormat;
+
+            std::atomic<bool> m_asyncRecording;
+
+            std::shared_ptr<saimeta::MpscRingBuffer<Record>> m_stagingBuffer;
+
+            std::string m_writeBatch;
+
+            bool m_runWriter;
+
+            std::condition_variable m_writerCv;
+
+            /**
+             * @brief Signaled when writer thread makes space in staging
+             * buffer.
+             */
+            std::condition_variable m_spaceCv;
+
+            std::shared_ptr<std::thread> m_writerThread;
+
+            uint64_t m_rotateSize;
+
+            uint32_t m_rotateInterval;
+
+            bool m_rotateCompress;
+
+            uint32_t m_rotateMaxSegments;
+
+            /**
+             * @brief Size of currently opened recording file.
+             */
+            uint64_t m_recordingFileSize;
+
+            time_t m_recordingFileOpenTime;
+
+            std::shared_ptr<RecordingCompressor> m_compressor;
     };
 }
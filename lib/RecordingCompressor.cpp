@@ -0,0 +1,302 @@
+#include "RecordingCompressor.h"
+
+#include "swss/logger.h"
+
+#include <zlib.h>
+#include <dirent.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <cstdio>
+#include <cctype>
+#include <vector>
+#include <algorithm>
+
+using namespace sairedis;
+
+#define COMPRESSOR_BUFFER_SIZE (64 * 1024)
+#define COMPRESSED_SEGMENT_SUFFIX ".gz"
+
+RecordingCompressor::RecordingCompressor():
+    m_run(true),
+    m_busy(false)
+{
+    SWSS_LOG_ENTER();
+
+    m_thread = std::make_shared<std::thread>(&RecordingCompressor::compressorThreadFunction, this);
+}
+
+RecordingCompressor::~RecordingCompressor()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_run = false;
+    }
+
+    m_jobsCv.notify_all();
+
+    m_thread->join();
+}
+
+void RecordingCompressor::push(
+        _In_ const std::string& segment,
+        _In_ bool compress,
+        _In_ const std::string& directory,
+        _In_ const std::string& fileName,
+        _In_ uint32_t maxSegments)
+{
+    SWSS_LOG_ENTER();
+
+    Job job;
+
+    job.m_segment = segment;
+    job.m_compress = compress;
+    job.m_directory = directory;
+    job.m_fileName = fileName;
+    job.m_maxSegments = maxSegments;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_jobs.push(job);
+    }
+
+    m_jobsCv.notify_one();
+}
+
+void RecordingCompressor::wait()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_idleCv.wait(lock, [&]{ return m_jobs.empty() && !m_busy; });
+}
+
+std::string RecordingCompressor::getSegmentFileName(
+        _In_ const std::string& recordingFile,
+        _In_ const struct timeval& tv)
+{
+    SWSS_LOG_ENTER();
+
+    char buffer[64];
+
+    struct tm now;
+    localtime_r(&tv.tv_sec, &now);
+
+    size_t size = strftime(buffer, 32, ".%Y%m%d.%H%M%S.", &now);
+
+    snprintf(&buffer[size], 32, "%06ld", tv.tv_usec);
+
+    return recordingFile + buffer;
+}
+
+bool RecordingCompressor::isSegmentFileName(
+        _In_ const std::string& fileName,
+        _In_ const std::string& name)
+{
+    SWSS_LOG_ENTER();
+
+    // expected: <fileName>.YYYYmmdd.HHMMSS.uuuuuu[.gz]
+
+    const std::string pattern = ".dddddddd.dddddd.dddddd";
+
+    if (name.size() < fileName.size() + pattern.size() ||
+            name.compare(0, fileName.size(), fileName) != 0)
+    {
+        return false;
+    }
+
+    std::string suffix = name.substr(fileName.size());
+
+    for (size_t i = 0; i < pattern.size(); i++)
+    {
+        if (pattern[i] == 'd' ? !isdigit((unsigned char)suffix[i]) : suffix[i] != pattern[i])
+        {
+            return false;
+        }
+    }
+
+    suffix = suffix.substr(pattern.size());
+
+    return suffix.empty() || suffix == COMPRESSED_SEGMENT_SUFFIX;
+}
+
+bool RecordingCompressor::compressFile(
+        _In_ const std::string& src,
+        _In_ const std::string& dst)
+{
+    SWSS_LOG_ENTER();
+
+    FILE* in = fopen(src.c_str(), "rb");
+
+    if (in == NULL)
+    {
+        SWSS_LOG_ERROR("failed to open %s: %s", src.c_str(), strerror(errno));
+
+        return false;
+    }
+
+    gzFile out = gzopen(dst.c_str(), "wb");
+
+    if (out == NULL)
+    {
+        SWSS_LOG_ERROR("failed to open %s for compression", dst.c_str());
+
+        fclose(in);
+
+        return false;
+    }
+
+    std::vector<char> buffer(COMPRESSOR_BUFFER_SIZE);
+
+    bool success = true;
+
+    size_t n;
+
+    while ((n = fread(buffer.data(), 1, buffer.size(), in)) > 0)
+    {
+        if (gzwrite(out, buffer.data(), (unsigned)n) != (int)n)
+        {
+            int err;
+
+            SWSS_LOG_ERROR("failed to write %s: %s", dst.c_str(), gzerror(out, &err));
+
+            success = false;
+            break;
+        }
+    }
+
+    if (ferror(in))
+    {
+        SWSS_LOG_ERROR("failed to read %s", src.c_str());
+
+        success = false;
+    }
+
+    fclose(in);
+
+    if (gzclose(out) != Z_OK)
+    {
+        SWSS_LOG_ERROR("failed to close %s", dst.c_str());
+
+        success = false;
+    }
+
+    if (!success)
+    {
+        // keep uncompressed segment
+
+        unlink(dst.c_str());
+
+        return false;
+    }
+
+    unlink(src.c_str());
+
+    return true;
+}
+
+void RecordingCompressor::removeOldSegments(
+        _In_ const std::string& directory,
+        _In_ const std::string& fileName,
+        _In_ uint32_t maxSegments)
+{
+    SWSS_LOG_ENTER();
+
+    if (maxSegments == 0)
+    {
+        return;
+    }
+
+    DIR* dir = opendir(directory.c_str());
+
+    if (dir == NULL)
+    {
+        SWSS_LOG_ERROR("failed to open dir %s: %s", directory.c_str(), strerror(errno));
+
+        return;
+    }
+
+    std::vector<std::string> segments;
+
+    struct dirent* entry;
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if (isSegmentFileName(fileName, entry->d_name))
+        {
+            segments.push_back(entry->d_name);
+        }
+    }
+
+    closedir(dir);
+
+    if (segments.size() <= maxSegments)
+    {
+        return;
+    }
+
+    // timestamp suffix makes lexicographic order chronological
+
+    std::sort(segments.begin(), segments.end());
+
+    for (size_t i = 0; i < segments.size() - maxSegments; i++)
+    {
+        std::string path = directory + "/" + segments[i];
+
+        SWSS_LOG_NOTICE("removing old recording segment %s", path.c_str());
+
+        if (unlink(path.c_str()) != 0)
+        {
+            SWSS_LOG_ERROR("failed to remove %s: %s", path.c_str(), strerror(errno));
+        }
+    }
+}
+
+void RecordingCompressor::compressorThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("starting recording compressor thread");
+
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_jobsCv.wait(lock, [&]{ return !m_jobs.empty() || !m_run; });
+
+        if (m_jobs.empty())
+        {
+            break; // m_run is false and all segments were processed
+        }
+
+        Job job = m_jobs.front();
+
+        m_jobs.pop();
+
+        m_busy = true;
+
+        lock.unlock();
+
+        if (job.m_compress)
+        {
+            compressFile(job.m_segment, job.m_segment + COMPRESSED_SEGMENT_SUFFIX);
+        }
+
+        removeOldSegments(job.m_directory, job.m_fileName, job.m_maxSegments);
+
+        lock.lock();
+
+        m_busy = false;
+
+        lock.unlock();
+
+        m_idleCv.notify_all();
+    }
+
+    SWSS_LOG_NOTICE("ending recording compressor thread");
+}
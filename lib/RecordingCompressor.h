@@ -0,0 +1,123 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <sys/time.h>
+
+#include <string>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+
+namespace sairedis
+{
+    /**
+     * @brief Background compressor of closed recording segments.
+     *
+     * When recorder rotates recording file, closed file is renamed to
+     * segment name with timestamp suffix and pushed here. Segment is gzip
+     * compressed on dedicated thread, and then oldest segments above the
+     * configured limit are removed, so recording takes bounded disk space.
+     */
+    class RecordingCompressor
+    {
+        private:
+
+            RecordingCompressor(const RecordingCompressor&) = delete;
+            RecordingCompressor& operator=(const RecordingCompressor&) = delete;
+
+        public:
+
+            RecordingCompressor();
+
+            virtual ~RecordingCompressor();
+
+        public:
+
+            /**
+             * @brief Queue closed segment for compression and cleanup.
+             *
+             * @param segment Path of closed segment.
+             * @param compress Whether segment should be compressed.
+             * @param directory Recording directory.
+             * @param fileName Recording file name, segments of this file
+             * will be considered when removing old segments.
+             * @param maxSegments Maximum number of segments to keep, 0 means
+             * unlimited.
+             */
+            void push(
+                    _In_ const std::string& segment,
+                    _In_ bool compress,
+                    _In_ const std::string& directory,
+                    _In_ const std::string& fileName,
+                    _In_ uint32_t maxSegments);
+
+            /**
+             * @brief Block until all queued segments are processed.
+             */
+            void wait();
+
+        public:
+
+            /**
+             * @brief Get segment file name for recording file closed at
+             * given time.
+             */
+            static std::string getSegmentFileName(
+                    _In_ const std::string& recordingFile,
+                    _In_ const struct timeval& tv);
+
+            static bool isSegmentFileName(
+                    _In_ const std::string& fileName,
+                    _In_ const std::string& name);
+
+            /**
+             * @brief Compress source file to gzip destination file.
+             *
+             * On success source file is removed.
+             */
+            static bool compressFile(
+                    _In_ const std::string& src,
+                    _In_ const std::string& dst);
+
+            static void removeOldSegments(
+                    _In_ const std::string& directory,
+                    _In_ const std::string& fileName,
+                    _In_ uint32_t maxSegments);
+
+        private:
+
+            struct Job
+            {
+                std::string m_segment;
+
+                bool m_compress;
+
+                std::string m_directory;
+
+                std::string m_fileName;
+
+                uint32_t m_maxSegments;
+            };
+
+            void compressorThreadFunction();
+
+        private:
+
+            bool m_run;
+
+            bool m_busy;
+
+            std::queue<Job> m_jobs;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_jobsCv;
+
+            std::condition_variable m_idleCv;
+
+            std::shared_ptr<std::thread> m_thread;
+    };
+}
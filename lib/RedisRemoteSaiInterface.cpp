@@ -39,7 +39,12 @@ RedisRemoteSaiInterface::RedisRemoteSaiInterface(
     m_contextConfig(contextConfig),
     m_redisCommunicationMode(SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC),
     m_recorder(recorder),
-    m_notificationCallback(notificationCallback)
+    m_notificationCallback(notificationCallback),
+    m_syncWindowSize(0),
+    m_requestSequence(0),
+    m_syncCompletionCallback(nullptr),
+    m_syncWindowStatus(SAI_STATUS_SUCCESS),
+    m_syncWindowSupported(false)
 {
     SWSS_LOG_ENTER();
 
@@ -87,7 +92,8 @@ sai_status_t RedisRemoteSaiInterface::apiInitialize(
                 m_contextConfig->m_zmqEndpoint,
                 m_contextConfig->m_zmqNtfEndpoint,
                 std::bind(&RedisRemoteSaiInterface::handleNotification, this, _1, _2, _3),
-                m_zmqResponseBufferSize);
+                m_zmqResponseBufferSize,
+                m_contextConfig->m_zmqBinaryFraming);
 
         SWSS_LOG_NOTICE("zmq enabled, forcing sync mode");
 
@@ -104,7 +110,8 @@ sai_status_t RedisRemoteSaiInterface::apiInitialize(
 
     m_db = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbAsic, 0);
 
-    m_redisVidIndexGenerator = std::make_shared<RedisVidIndexGenerator>(m_db, REDIS_KEY_VIDCOUNTER);
+    m_redisVidIndexGenerator = std::make_shared<LeasedVidIndexGenerator>(
+            std::make_shared<RedisVidIndexGenerator>(m_db, REDIS_KEY_VIDCOUNTER));
 
     clear_local_state();
 
@@ -128,6 +135,8 @@ sai_status_t RedisRemoteSaiInterface::apiUninitialize(void)
         return SAI_STATUS_FAILURE;
     }
 
+    drainSyncWindow();
+
     m_communicationChannel = nullptr; // will stop thread
 
     // clear local state after stopping threads
@@ -349,6 +358,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
             SWSS_LOG_WARN("sync mode is depreacated, use communication mode");
 
+            drainSyncWindow();
+
             m_syncMode = attr->value.booldata;
 
             if (m_contextConfig->m_zmqEnable)
@@ -378,6 +389,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
                 m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC;
             }
 
+            drainSyncWindow();
+
             m_communicationChannel = nullptr;
 
             switch (m_redisCommunicationMode)
@@ -418,6 +431,13 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
                     m_contextConfig->m_zmqEnable = true;
 
+                    if (m_syncWindowSize > 1)
+                    {
+                        SWSS_LOG_WARN("sync window is not supported in zmq mode, disabling");
+
+                        m_syncWindowSize = 0;
+                    }
+
                     // main communication channel was created at initialize method
                     // so this command will replace it with zmq channel
 
@@ -425,7 +445,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
                             m_contextConfig->m_zmqEndpoint,
                             m_contextConfig->m_zmqNtfEndpoint,
                             std::bind(&RedisRemoteSaiInterface::handleNotification, this, _1, _2, _3),
-                            m_zmqResponseBufferSize);
+                            m_zmqResponseBufferSize,
+                            m_contextConfig->m_zmqBinaryFraming);
 
                     m_communicationChannel->setResponseTimeout(m_responseTimeoutMs);
 
@@ -463,8 +484,57 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
             m_communicationChannel->flush();
 
+            // flush is called periodically by client, so it also gives
+            // recorder chance to rotate file by time in sync mode
+
+            if (m_recorder)
+            {
+                m_recorder->flush();
+            }
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_SYNC_WINDOW_SIZE:
+
+            if (attr->value.u32 > 1 && m_contextConfig->m_zmqEnable)
+            {
+                SWSS_LOG_ERROR("sync window is not supported in zmq mode, zmq REQ/REP allows single request in flight");
+
+                return SAI_STATUS_NOT_SUPPORTED;
+            }
+
+            drainSyncWindow();
+
+            if (attr->value.u32 > 1 && m_syncMode && !isSyncWindowSupported())
+            {
+                SWSS_LOG_ERROR("sync window is not supported by syncd");
+
+                return SAI_STATUS_NOT_SUPPORTED;
+            }
+
+            m_syncWindowSize = attr->value.u32;
+
+            SWSS_LOG_NOTICE("set sync window size to %u", m_syncWindowSize);
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_SYNC_COMPLETION_CALLBACK:
+
+            m_syncCompletionCallback = (sai_redis_sync_completion_fn)attr->value.ptr;
+
             return SAI_STATUS_SUCCESS;
 
+        case SAI_REDIS_SWITCH_ATTR_SYNC_DRAIN:
+            {
+                drainSyncWindow();
+
+                sai_status_t status = m_syncWindowStatus;
+
+                m_syncWindowStatus = SAI_STATUS_SUCCESS;
+
+                return status;
+            }
+
         case SAI_REDIS_SWITCH_ATTR_RECORDING_OUTPUT_DIR:
 
             if (m_recorder)
@@ -483,6 +553,72 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
             return SAI_STATUS_SUCCESS;
 
+        case SAI_REDIS_SWITCH_ATTR_RECORDING_ASYNC:
+
+            if (m_recorder)
+            {
+                m_recorder->enableAsyncRecording(attr->value.booldata);
+            }
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_RECORDING_FORMAT:
+
+            switch (attr->value.s32)
+            {
+                case SAI_REDIS_RECORDING_FORMAT_TEXT:
+                case SAI_REDIS_RECORDING_FORMAT_BINARY:
+
+                    if (m_recorder)
+                    {
+                        m_recorder->setRecordingFormat((sai_redis_recording_format_t)attr->value.s32);
+                    }
+
+                    return SAI_STATUS_SUCCESS;
+
+                default:
+
+                    SWSS_LOG_ERROR("invalid recording format value: %d", attr->value.s32);
+
+                    return SAI_STATUS_INVALID_ATTR_VALUE_0;
+            }
+
+        case SAI_REDIS_SWITCH_ATTR_RECORDING_ROTATE_SIZE:
+
+            if (m_recorder)
+            {
+                m_recorder->setRotateSize(attr->value.u64);
+            }
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_RECORDING_ROTATE_INTERVAL:
+
+            if (m_recorder)
+            {
+                m_recorder->setRotateInterval(attr->value.u32);
+            }
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_RECORDING_ROTATE_COMPRESS:
+
+            if (m_recorder)
+            {
+                m_recorder->setRotateCompress(attr->value.booldata);
+            }
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_RECORDING_ROTATE_MAX_SEGMENTS:
+
+            if (m_recorder)
+            {
+                m_recorder->setRotateMaxSegments(attr->value.u32);
+            }
+
+            return SAI_STATUS_SUCCESS;
+
         case SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER_GROUP:
             return notifyCounterGroupOperations(objectId,
                                                 reinterpret_cast<sai_redis_flex_counter_group_parameter_t*>(attr->value.ptr));
@@ -578,11 +714,14 @@ sai_status_t RedisRemoteSaiInterface::notifyCounterGroupOperations(
     emplaceStrings(BULK_CHUNK_SIZE_FIELD, flexCounterGroupParam->bulk_chunk_size, entries);
     emplaceStrings(BULK_CHUNK_SIZE_PER_PREFIX_FIELD, flexCounterGroupParam->bulk_chunk_size_per_prefix, entries);
     emplaceStrings(STATS_MODE_FIELD, flexCounterGroupParam->stats_mode, entries);
+    emplaceStrings(PUBLISH_MODE_FIELD, flexCounterGroupParam->publish_mode, entries);
     emplaceStrings(flexCounterGroupParam->plugin_name, flexCounterGroupParam->plugins, entries);
     emplaceStrings(FLEX_COUNTER_STATUS_FIELD, flexCounterGroupParam->operation, entries);
 
     m_recorder->recordGenericCounterPolling(key, entries);
 
+    drainSyncWindow();
+
     m_communicationChannel->set(key,
                                 entries,
                                 (entries.size() != 0) ? REDIS_FLEX_COUNTER_COMMAND_SET_GROUP : REDIS_FLEX_COUNTER_COMMAND_DEL_GROUP);
@@ -617,6 +756,9 @@ sai_status_t RedisRemoteSaiInterface::notifyCounterOperations(
     }
 
     m_recorder->recordGenericCounterPolling(key, entries);
+
+    drainSyncWindow();
+
     m_communicationChannel->set(key, entries, command);
 
     return waitForResponse(SAI_COMMON_API_SET);
@@ -837,6 +979,13 @@ sai_status_t RedisRemoteSaiInterface::create(
 
     m_recorder->recordGenericCreate(key, entry);
 
+    if (isSyncWindowEnabled(object_type))
+    {
+        return sendWindowedRequest(key, entry);
+    }
+
+    drainSyncWindow();
+
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_CREATE);
 
     auto status = waitForResponse(SAI_COMMON_API_CREATE);
@@ -860,6 +1009,8 @@ sai_status_t RedisRemoteSaiInterface::remove(
 
     m_recorder->recordGenericRemove(key);
 
+    drainSyncWindow();
+
     m_communicationChannel->del(key, REDIS_ASIC_STATE_COMMAND_REMOVE);
 
     auto status = waitForResponse(SAI_COMMON_API_REMOVE);
@@ -890,6 +1041,8 @@ sai_status_t RedisRemoteSaiInterface::set(
 
     m_recorder->recordGenericSet(key, entry);
 
+    drainSyncWindow();
+
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_SET);
 
     auto status = waitForResponse(SAI_COMMON_API_SET);
@@ -899,6 +1052,174 @@ sai_status_t RedisRemoteSaiInterface::set(
     return status;
 }
 
+bool RedisRemoteSaiInterface::isSyncWindowEnabled(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_syncMode || m_syncWindowSize <= 1)
+    {
+        return false;
+    }
+
+    // only creates of non object id objects are windowed, on failure meta
+    // can remove them by key, while object id creates must release
+    // allocated object id and failed remove or set can't be undone
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (!info || !info->isnonobjectid)
+    {
+        return false;
+    }
+
+    return isSyncWindowSupported();
+}
+
+bool RedisRemoteSaiInterface::isSyncWindowSupported()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_syncWindowChannel.lock() == m_communicationChannel)
+    {
+        return m_syncWindowSupported;
+    }
+
+    // channel was created or replaced, ask syncd on the other end if
+    // responses will carry request sequence
+
+    drainSyncWindow();
+
+    m_syncWindowChannel = m_communicationChannel;
+
+    const std::vector<swss::FieldValueTuple> entry =
+    {
+        swss::FieldValueTuple(REDIS_ASIC_STATE_SYNC_WINDOW_HANDSHAKE_FIELD, "1")
+    };
+
+    m_communicationChannel->set(sai_serialize_object_id(SAI_NULL_OBJECT_ID), entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE, kco);
+
+    auto& values = kfvFieldsValues(kco);
+
+    m_syncWindowSupported = (status == SAI_STATUS_SUCCESS &&
+            values.size() == 1 &&
+            fvField(values[0]) == REDIS_ASIC_STATE_SYNC_WINDOW_HANDSHAKE_FIELD);
+
+    if (m_syncWindowSupported)
+    {
+        SWSS_LOG_NOTICE("syncd supports windowed requests");
+    }
+    else
+    {
+        SWSS_LOG_WARN("syncd doesn't support windowed requests (%s), each request will wait for its response",
+                sai_serialize_status(status).c_str());
+    }
+
+    return m_syncWindowSupported;
+}
+
+sai_status_t RedisRemoteSaiInterface::sendWindowedRequest(
+        _In_ const std::string& key,
+        _In_ std::vector<swss::FieldValueTuple>& entry)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t sequence = ++m_requestSequence;
+
+    // sequence must be last field, syncd will remove it before processing
+
+    entry.emplace_back(REDIS_ASIC_STATE_SEQUENCE_FIELD, std::to_string(sequence));
+
+    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_CREATE);
+
+    m_windowedRequests.push_back({sequence, SAI_COMMON_API_CREATE, key});
+
+    while (m_windowedRequests.size() >= m_syncWindowSize)
+    {
+        completeWindowedRequest();
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+void RedisRemoteSaiInterface::completeWindowedRequest()
+{
+    SWSS_LOG_ENTER();
+
+    WindowedRequest request = m_windowedRequests.front();
+
+    m_windowedRequests.pop_front();
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+
+    m_recorder->recordGenericResponse(status);
+
+    auto& values = kfvFieldsValues(kco);
+
+    if (values.empty() || fvField(values.back()) != REDIS_ASIC_STATE_SEQUENCE_FIELD)
+    {
+        SWSS_LOG_THROW("response for %s has no sequence (%s), responses out of sync",
+                request.m_key.c_str(),
+                sai_serialize_status(status).c_str());
+    }
+
+    if (fvValue(values.back()) != std::to_string(request.m_sequence))
+    {
+        SWSS_LOG_THROW("got response for sequence %s, expected %" PRIu64 " (%s), responses out of sync",
+                fvValue(values.back()).c_str(),
+                request.m_sequence,
+                request.m_key.c_str());
+    }
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("windowed %s %s failed: %s",
+                sai_serialize_common_api(request.m_api).c_str(),
+                request.m_key.c_str(),
+                sai_serialize_status(status).c_str());
+
+        // create already returned success and meta added object to its db,
+        // remove it so meta stays in sync with ASIC
+
+        auto meta = m_meta.lock();
+
+        sai_object_meta_key_t mk;
+
+        sai_deserialize_object_meta_key(request.m_key, mk);
+
+        if (meta && meta->objectExists(mk))
+        {
+            meta->meta_generic_validation_post_remove(mk);
+        }
+
+        if (m_syncWindowStatus == SAI_STATUS_SUCCESS)
+        {
+            m_syncWindowStatus = status;
+        }
+    }
+
+    if (m_syncCompletionCallback)
+    {
+        m_syncCompletionCallback(request.m_sequence, request.m_api, request.m_key.c_str(), status);
+    }
+}
+
+void RedisRemoteSaiInterface::drainSyncWindow()
+{
+    SWSS_LOG_ENTER();
+
+    while (m_windowedRequests.size())
+    {
+        completeWindowedRequest();
+    }
+}
+
 sai_status_t RedisRemoteSaiInterface::waitForResponse(
         _In_ sai_common_api_t api)
 {
@@ -994,6 +1315,8 @@ sai_status_t RedisRemoteSaiInterface::get(
         m_recorder->recordGenericGet(key, entry);
     }
 
+    drainSyncWindow();
+
     // get is special, it will not put data
     // into asic view, only to message queue
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET);
@@ -1058,6 +1381,8 @@ sai_status_t RedisRemoteSaiInterface::flushFdbEntries(
     m_recorder->recordFlushFdbEntries(switchId, attrCount, attrList);
    // TODO m_recorder->recordFlushFdbEntries(key, entry)
 
+    drainSyncWindow();
+
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_FLUSH);
 
     auto status = waitForFlushFdbEntriesResponse();
@@ -1092,6 +1417,8 @@ sai_status_t RedisRemoteSaiInterface::objectTypeGetAvailability(
     m_recorder->recordObjectTypeGetAvailability(switchId, objectType, attrCount, attrList);
     // recordObjectTypeGetAvailability(strSwitchId, entry);
 
+    drainSyncWindow();
+
     // This query will not put any data into the ASIC view, just into the
     // message queue
     m_communicationChannel->set(strSwitchId, entry, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_QUERY);
@@ -1170,6 +1497,8 @@ sai_status_t RedisRemoteSaiInterface::queryAttributeCapability(
 
     m_recorder->recordQueryAttributeCapability(switchId, objectType, attrId, capability);
 
+    drainSyncWindow();
+
     m_communicationChannel->set(switchIdStr, entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY);
 
     auto status = waitForQueryAttributeCapabilityResponse(capability);
@@ -1259,6 +1588,8 @@ sai_status_t RedisRemoteSaiInterface::queryAttributeEnumValuesCapability(
 
     m_recorder->recordQueryAttributeEnumValuesCapability(switchId, objectType, attrId, enumValuesCapability);
 
+    drainSyncWindow();
+
     m_communicationChannel->set(switch_id_str, entry, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_QUERY);
 
     auto status = waitForQueryAttributeEnumValuesCapabilityResponse(enumValuesCapability);
@@ -1360,6 +1691,8 @@ sai_status_t RedisRemoteSaiInterface::getStats(
 
     // get_stats will not put data to asic view, only to message queue
 
+    drainSyncWindow();
+
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET_STATS);
 
     return waitForGetStatsResponse(number_of_counters, counters);
@@ -1439,6 +1772,8 @@ sai_status_t RedisRemoteSaiInterface::queryStatsCapability(
 
     m_recorder->recordQueryStatsCapability(switchId, objectType, stats_capability);
 
+    drainSyncWindow();
+
     m_communicationChannel->set(switchIdStr, entry, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY);
 
     auto status = waitForQueryStatsCapabilityResponse(stats_capability);
@@ -1545,6 +1880,8 @@ sai_status_t RedisRemoteSaiInterface::queryStatsStCapability(
 
     m_recorder->recordQueryStatsStCapability(switchId, objectType, stats_capability);
 
+    drainSyncWindow();
+
     m_communicationChannel->set(switchIdStr, entry, REDIS_ASIC_STATE_COMMAND_STATS_ST_CAPABILITY_QUERY);
 
     auto status = waitForQueryStatsStCapabilityResponse(stats_capability);
@@ -1646,6 +1983,8 @@ sai_status_t RedisRemoteSaiInterface::clearStats(
 
     m_recorder->recordGenericClearStats(object_type, object_id, number_of_counters, counter_ids);
 
+    drainSyncWindow();
+
     m_communicationChannel->set(key, values, REDIS_ASIC_STATE_COMMAND_CLEAR_STATS);
 
     auto status = waitForClearStatsResponse();
@@ -1738,6 +2077,8 @@ sai_status_t RedisRemoteSaiInterface::bulkRemove(
 
     m_recorder->recordBulkGenericRemove(serializedObjectType, entries);
 
+    drainSyncWindow();
+
     m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_REMOVE);
 
     return waitForBulkResponse(SAI_COMMON_API_BULK_REMOVE, (uint32_t)serialized_object_ids.size(), object_statuses);
@@ -1933,6 +2274,8 @@ sai_status_t RedisRemoteSaiInterface::bulkSet(
 
     m_recorder->recordBulkGenericSet(serializedObjectType, entries);
 
+    drainSyncWindow();
+
     m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_SET);
 
     return waitForBulkResponse(SAI_COMMON_API_BULK_SET, (uint32_t)serialized_object_ids.size(), object_statuses);
@@ -2001,6 +2344,8 @@ sai_status_t RedisRemoteSaiInterface::bulkGet(
 
     const auto key = serializedObjectType + ":" + std::to_string(entries.size());
 
+    drainSyncWindow();
+
     m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_GET);
 
     m_recorder->recordBulkGenericGet(serializedObjectType, entries);
@@ -2106,6 +2451,8 @@ sai_status_t RedisRemoteSaiInterface::bulkCreate(
 
     m_recorder->recordBulkGenericCreate(str_object_type, entries);
 
+    drainSyncWindow();
+
     m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
 
     return waitForBulkResponse(SAI_COMMON_API_BULK_CREATE, (uint32_t)serialized_object_ids.size(), object_statuses);
@@ -2135,6 +2482,8 @@ sai_status_t RedisRemoteSaiInterface::notifySyncd(
 
     m_recorder->recordNotifySyncd(switchId, redisNotifySyncd);
 
+    drainSyncWindow();
+
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_NOTIFY);
 
     auto status = waitForNotifySyncdResponse();
@@ -2194,6 +2543,14 @@ void RedisRemoteSaiInterface::handleNotification(
 
     m_recorder->recordNotification(name, serializedNotification, values);
 
+    if (name == SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST)
+    {
+        // client usually ends process on shutdown request, make sure that
+        // async records are written before that
+
+        m_recorder->flush();
+    }
+
     auto notification = NotificationFactory::deserialize(name, serializedNotification);
 
     if (notification)
@@ -2277,6 +2634,13 @@ sai_status_t RedisRemoteSaiInterface::sai_redis_notify_syncd(
 
     auto status = notifySyncd(switchId, redisNotifySyncd);
 
+    if (redisNotifySyncd == SAI_REDIS_NOTIFY_SYNCD_INVOKE_DUMP)
+    {
+        // dump is invoked on failure, right before client aborts
+
+        m_recorder->flush();
+    }
+
     if (status == SAI_STATUS_SUCCESS)
     {
         switch (redisNotifySyncd)
@@ -2332,6 +2696,10 @@ void RedisRemoteSaiInterface::clear_local_state()
     // will clear switch container
     m_switchContainer = std::make_shared<SwitchContainer>();
 
+    // don't reuse indexes leased before init view
+
+    m_redisVidIndexGenerator->reset();
+
     m_virtualObjectIdManager =
         std::make_shared<VirtualObjectIdManager>(
                 m_contextConfig->m_guid,
@@ -5,6 +5,7 @@
 #include "VirtualObjectIdManager.h"
 #include "Recorder.h"
 #include "RedisVidIndexGenerator.h"
+#include "LeasedVidIndexGenerator.h"
 #include "SkipRecordAttrContainer.h"
 #include "RedisChannel.h"
 #include "SwitchConfigContainer.h"
@@ -20,6 +21,7 @@
 #include <memory>
 #include <functional>
 #include <map>
+#include <deque>
 
 namespace sairedis
 {
@@ -376,6 +378,44 @@ namespace sairedis
             sai_status_t waitForQueryStatsStCapabilityResponse(
                     _Inout_ sai_stat_st_capability_list_t *stats_capability);
 
+        private: // windowed QUAD API
+
+            /**
+             * @brief Check if create should be windowed.
+             *
+             * Only creates of non object id objects are windowed, since meta
+             * can undo them when they fail.
+             */
+            bool isSyncWindowEnabled(
+                    _In_ sai_object_type_t objectType);
+
+            /**
+             * @brief Check if syncd supports windowed requests.
+             *
+             * Handshake is sent once per communication channel.
+             */
+            bool isSyncWindowSupported();
+
+            /**
+             * @brief Send create request without waiting for its response.
+             *
+             * Blocks only when window is full, until oldest request in flight
+             * will be completed.
+             */
+            sai_status_t sendWindowedRequest(
+                    _In_ const std::string& key,
+                    _In_ std::vector<swss::FieldValueTuple>& entry);
+
+            void completeWindowedRequest();
+
+            /**
+             * @brief Wait until all windowed requests are completed.
+             *
+             * Must be called before any non windowed request is sent, since
+             * all responses are received on the same channel.
+             */
+            void drainSyncWindow();
+
     private: // notify syncd response
 
             sai_status_t waitForNotifySyncdResponse();
@@ -450,7 +490,7 @@ namespace sairedis
 
             std::shared_ptr<swss::DBConnector> m_db;
 
-            std::shared_ptr<RedisVidIndexGenerator> m_redisVidIndexGenerator;
+            std::shared_ptr<LeasedVidIndexGenerator> m_redisVidIndexGenerator;
 
             std::weak_ptr<saimeta::Meta> m_meta;
 
@@ -465,5 +505,38 @@ namespace sairedis
             std::function<sai_switch_notifications_t(std::shared_ptr<Notification>)> m_notificationCallback;
 
             std::map<sai_object_id_t, swss::TableDump> m_tableDump;
+
+        private: // windowed QUAD API
+
+            typedef struct _WindowedRequest
+            {
+                uint64_t m_sequence;
+
+                sai_common_api_t m_api;
+
+                std::string m_key;
+
+            } WindowedRequest;
+
+            uint32_t m_syncWindowSize;
+
+            uint64_t m_requestSequence;
+
+            std::deque<WindowedRequest> m_windowedRequests;
+
+            sai_redis_sync_completion_fn m_syncCompletionCallback;
+
+            /**
+             * @brief First failure status of windowed requests since last
+             * SAI_REDIS_SWITCH_ATTR_SYNC_DRAIN.
+             */
+            sai_status_t m_syncWindowStatus;
+
+            /**
+             * @brief Channel on which sync window handshake was done.
+             */
+            std::weak_ptr<Channel> m_syncWindowChannel;
+
+            bool m_syncWindowSupported;
     };
 }
@@ -32,11 +32,8 @@ std::vector<uint64_t> RedisVidIndexGenerator::incrementBy(
 {
     SWSS_LOG_ENTER();
 
-    swss::RedisCommand sincr;
-    sincr.format("INCRBY %s %" PRIu64, m_vidCounterName.c_str(), count);
-    swss::RedisReply r(m_dbConnector.get(), sincr, REDIS_REPLY_INTEGER);
-    uint64_t lastObjectIndex = r.getContext()->integer;
-    uint64_t firstObjectIndex = lastObjectIndex - count + 1;
+    uint64_t firstObjectIndex = incrementRange(count);
+    uint64_t lastObjectIndex = firstObjectIndex + count - 1;
 
     std::vector<uint64_t> result;
     result.reserve(static_cast<size_t>(count));
@@ -49,6 +46,19 @@ std::vector<uint64_t> RedisVidIndexGenerator::incrementBy(
     return result;
 }
 
+uint64_t RedisVidIndexGenerator::incrementRange(
+    _In_ uint64_t count)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisCommand sincr;
+    sincr.format("INCRBY %s %" PRIu64, m_vidCounterName.c_str(), count);
+    swss::RedisReply r(m_dbConnector.get(), sincr, REDIS_REPLY_INTEGER);
+    uint64_t lastObjectIndex = r.getContext()->integer;
+
+    return lastObjectIndex - count + 1;
+}
+
 void RedisVidIndexGenerator::reset()
 {
     SWSS_LOG_ENTER();
@@ -296,20 +296,22 @@ void VirtualObjectIdManager::allocateNewObjectIds(
 
     uint32_t switchIndex = static_cast<uint32_t>(SAI_REDIS_GET_SWITCH_INDEX(switchId));
 
-    std::vector<uint64_t> objectIndexes = m_oidIndexGenerator->incrementBy(count);
+    uint64_t firstObjectIndex = m_oidIndexGenerator->incrementRange(count);
+
+    uint64_t lastObjectIndex = firstObjectIndex + count - 1;
 
     const uint64_t indexMax = SAI_REDIS_OBJECT_INDEX_MAX;
 
-    if (objectIndexes.back() > indexMax)
+    if (lastObjectIndex > indexMax)
     {
         SWSS_LOG_THROW("no more object indexes available, given: 0x%" PRIx64 " but limit is 0x%" PRIx64 " ",
-                objectIndexes.back(),
+                lastObjectIndex,
                 indexMax);
     }
 
     for (size_t idx = 0; idx < count; idx++)
     {
-        oids[idx] = constructObjectId(objectTypes[idx], switchIndex, objectIndexes[idx], m_globalContext);
+        oids[idx] = constructObjectId(objectTypes[idx], switchIndex, firstObjectIndex + idx, m_globalContext);
     }
 }
 
@@ -3,6 +3,7 @@
 #include "sairediscommon.h"
 
 #include "meta/sai_serialize.h"
+#include "meta/ZeroMQBinaryFraming.h"
 
 #include "swss/logger.h"
 #include "swss/select.h"
@@ -18,7 +19,8 @@ ZeroMQChannel::ZeroMQChannel(
         _In_ const std::string& endpoint,
         _In_ const std::string& ntfEndpoint,
         _In_ Channel::Callback callback,
-        _In_ long zmqResponseBufferSize):
+        _In_ long zmqResponseBufferSize,
+        _In_ bool binaryFraming):
     Channel(callback),
     m_endpoint(endpoint),
     m_ntfEndpoint(ntfEndpoint),
@@ -26,7 +28,9 @@ ZeroMQChannel::ZeroMQChannel(
     m_socket(nullptr),
     m_ntfContext(nullptr),
     m_ntfSocket(nullptr),
-    m_zmqResponseBufferSize(zmqResponseBufferSize)
+    m_zmqResponseBufferSize(zmqResponseBufferSize),
+    m_binaryFraming(false),
+    m_negotiateBinaryFraming(binaryFraming)
 {
     SWSS_LOG_ENTER();
     if (m_zmqResponseBufferSize != ZMQ_RESPONSE_DEFAULT_BUFFER_SIZE)
@@ -40,6 +44,9 @@ ZeroMQChannel::ZeroMQChannel(
 
     m_buffer.resize(m_zmqResponseBufferSize);
 
+    SWSS_LOG_NOTICE("using json framing for zmq requests%s",
+            m_negotiateBinaryFraming ? ", binary framing will be negotiated" : "");
+
     // configure ZMQ for main communication
 
     m_context = zmq_ctx_new();
@@ -212,6 +219,35 @@ void ZeroMQChannel::flush()
     // not supported
 }
 
+bool ZeroMQChannel::negotiateBinaryFraming()
+{
+    SWSS_LOG_ENTER();
+
+    // handshake is sent as JSON, and older server will respond to it with
+    // invalid parameter status, since capability query expects 2 fields
+
+    set(sai_serialize_object_id(SAI_NULL_OBJECT_ID),
+            ZeroMQBinaryFraming::getHandshakeValues(),
+            REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    sai_status_t status = wait(REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE, kco);
+
+    if (status == SAI_STATUS_SUCCESS && ZeroMQBinaryFraming::isHandshake(kfvFieldsValues(kco)))
+    {
+        SWSS_LOG_NOTICE("binary framing confirmed by %s, using binary framing for zmq requests", m_endpoint.c_str());
+
+        return true;
+    }
+
+    SWSS_LOG_NOTICE("binary framing not supported by %s (status: %s), using json framing for zmq requests",
+            m_endpoint.c_str(),
+            sai_serialize_status(status).c_str());
+
+    return false;
+}
+
 void ZeroMQChannel::set(
         _In_ const std::string& key,
         _In_ const std::vector<swss::FieldValueTuple>& values,
@@ -219,11 +255,37 @@ void ZeroMQChannel::set(
 {
     SWSS_LOG_ENTER();
 
-    std::vector<swss::FieldValueTuple> copy = values;
+    if (m_negotiateBinaryFraming)
+    {
+        // negotiate only once, handshake itself is sent as JSON
+
+        m_negotiateBinaryFraming = false;
+
+        m_binaryFraming = negotiateBinaryFraming();
+    }
+
+    if (m_binaryFraming)
+    {
+        SWSS_LOG_DEBUG("sending binary: %s %s", key.c_str(), command.c_str());
+
+        if (ZeroMQBinaryFraming::send(m_socket, key, command, values) < 0)
+        {
+            SWSS_LOG_THROW("zmq_send failed, on endpoint %s, zmqerrno: %d: %s",
+                    m_endpoint.c_str(),
+                    zmq_errno(),
+                    zmq_strerror(zmq_errno()));
+        }
+
+        return;
+    }
+
+    std::vector<swss::FieldValueTuple> copy;
+
+    copy.reserve(values.size() + 1);
 
-    swss::FieldValueTuple opdata(key, command);
+    copy.emplace_back(key, command);
 
-    copy.insert(copy.begin(), opdata);
+    copy.insert(copy.end(), values.begin(), values.end());
 
     std::string msg = swss::JSon::buildJson(copy);
 
@@ -312,6 +374,8 @@ sai_status_t ZeroMQChannel::wait(
         }
         if (rc >= m_zmqResponseBufferSize)
         {
+            ZeroMQBinaryFraming::drain(m_socket);
+
             SWSS_LOG_THROW("zmq_recv message was truncated (over %d bytes, received %d), increase buffer size, message DROPPED",
                     m_zmqResponseBufferSize,
                     rc);
@@ -319,24 +383,41 @@ sai_status_t ZeroMQChannel::wait(
         break;
     }
 
-    m_buffer.at(rc) = 0; // make sure that we end string with zero before parse
+    if (ZeroMQBinaryFraming::hasMore(m_socket))
+    {
+        if (!ZeroMQBinaryFraming::isMagic(m_buffer.data(), rc))
+        {
+            ZeroMQBinaryFraming::drain(m_socket);
+
+            SWSS_LOG_THROW("zmq_recv multipart response without binary framing header");
+        }
+
+        if (ZeroMQBinaryFraming::recv(m_socket, kco) < 0)
+        {
+            SWSS_LOG_THROW("zmq_recv binary response failed, zmqerrno: %d", zmq_errno());
+        }
+    }
+    else
+    {
+        m_buffer.at(rc) = 0; // make sure that we end string with zero before parse
 
-    SWSS_LOG_DEBUG("response: %s", m_buffer.data());
+        SWSS_LOG_DEBUG("response: %s", m_buffer.data());
 
-    std::vector<swss::FieldValueTuple> values;
+        std::vector<swss::FieldValueTuple> values;
 
-    swss::JSon::readJson((char*)m_buffer.data(), values);
+        swss::JSon::readJson((char*)m_buffer.data(), values);
 
-    swss::FieldValueTuple fvt = values.at(0);
+        swss::FieldValueTuple fvt = values.at(0);
 
-    const std::string& opkey = fvField(fvt);
-    const std::string& op= fvValue(fvt);
+        values.erase(values.begin());
 
-    values.erase(values.begin());
+        kfvFieldsValues(kco) = std::move(values);
+        kfvOp(kco) = fvValue(fvt);
+        kfvKey(kco) = fvField(fvt);
+    }
 
-    kfvFieldsValues(kco) = values;
-    kfvOp(kco) = op;
-    kfvKey(kco) = opkey;
+    const std::string& opkey = kfvKey(kco);
+    const std::string& op = kfvOp(kco);
 
     SWSS_LOG_INFO("response: op = %s, key = %s", opkey.c_str(), op.c_str());
 
@@ -23,7 +23,8 @@ namespace sairedis
                     _In_ const std::string& endpoint,
                     _In_ const std::string& ntfEndpoint,
                     _In_ Channel::Callback callback,
-                    _In_ long zmqResponseBufferSize = ZMQ_RESPONSE_DEFAULT_BUFFER_SIZE);
+                    _In_ long zmqResponseBufferSize = ZMQ_RESPONSE_DEFAULT_BUFFER_SIZE,
+                    _In_ bool binaryFraming = false);
 
             virtual ~ZeroMQChannel();
 
@@ -51,6 +52,15 @@ namespace sairedis
 
             virtual void notificationThreadFunction() override;
 
+        private:
+
+            /**
+             * @brief Send binary framing handshake to server.
+             *
+             * @return True if server confirmed binary framing support.
+             */
+            bool negotiateBinaryFraming();
+
         private:
 
             std::string m_endpoint;
@@ -68,5 +78,19 @@ namespace sairedis
             void* m_ntfSocket;
 
             long m_zmqResponseBufferSize;
+
+            /**
+             * @brief When true, requests are sent using binary framing
+             * instead of JSON. Responses are accepted in both formats.
+             *
+             * Set only after server confirmed binary framing in handshake.
+             */
+            bool m_binaryFraming;
+
+            /**
+             * @brief When true, binary framing handshake will be sent
+             * before first request.
+             */
+            bool m_negotiateBinaryFraming;
     };
 }
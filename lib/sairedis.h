@@ -86,6 +86,25 @@ typedef enum _sai_redis_communication_mode_t
 
 } sai_redis_communication_mode_t;
 
+typedef enum _sai_redis_recording_format_t
+{
+    /**
+     * @brief Text recording format, one record per line.
+     */
+    SAI_REDIS_RECORDING_FORMAT_TEXT,
+
+    /**
+     * @brief Compact binary recording format.
+     *
+     * Each record holds binary timestamp and record length followed by the
+     * same record string as in text format. Binary recording can be
+     * converted back to text format by Recorder::convertBinaryToText, and
+     * saiplayer accepts both formats.
+     */
+    SAI_REDIS_RECORDING_FORMAT_BINARY,
+
+} sai_redis_recording_format_t;
+
 /**
  * @brief Use Redis communication channel to handle counters.
  *
@@ -154,6 +173,13 @@ typedef struct _sai_redis_flex_counter_group_parameter_t
      */
     sai_s8_list_t bulk_chunk_size_per_prefix;
 
+    /**
+     * @brief The counter publishing mode.
+     *
+     * It should be either "full" or "delta"
+     */
+    sai_s8_list_t publish_mode;
+
 } sai_redis_flex_counter_group_parameter_t;
 
 typedef struct _sai_redis_flex_counter_parameter_t
@@ -182,6 +208,20 @@ typedef struct _sai_redis_flex_counter_parameter_t
 
 } sai_redis_flex_counter_parameter_t;
 
+/**
+ * @brief Windowed request completion callback.
+ *
+ * @param[in] sequence Request sequence number
+ * @param[in] api Request api, always create
+ * @param[in] key Serialized object type and object id
+ * @param[in] status Status returned by syncd
+ */
+typedef void (*sai_redis_sync_completion_fn)(
+        _In_ uint64_t sequence,
+        _In_ sai_common_api_t api,
+        _In_ const char *key,
+        _In_ sai_status_t status);
+
 typedef enum _sai_redis_switch_attr_t
 {
     /**
@@ -224,7 +264,7 @@ typedef enum _sai_redis_switch_attr_t
     SAI_REDIS_SWITCH_ATTR_USE_PIPELINE,
 
     /**
-     * @brief Will flush redis pipeline
+     * @brief Will flush redis pipeline and recorder
      *
      * @type bool
      * @flags CREATE_AND_SET
@@ -364,6 +404,120 @@ typedef enum _sai_redis_switch_attr_t
      */
     SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER,
 
+    /**
+     * @brief Number of create, remove and set requests allowed in flight.
+     *
+     * Used only in REDIS_SYNC communication mode. When greater than 1,
+     * creates of non object id objects (like route or neighbor entries)
+     * return success right after request is sent, and actual status is
+     * reported by completion callback and by SAI_REDIS_SWITCH_ATTR_SYNC_DRAIN.
+     * When windowed create fails, object is removed from metadata db. Requests
+     * in flight are drained before any other request is sent. Value 0 or 1
+     * means each request waits for its response.
+     *
+     * Syncd support is checked by handshake, if syncd doesn't support
+     * windowed requests, setting value greater than 1 returns
+     * SAI_STATUS_NOT_SUPPORTED.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_REDIS_SWITCH_ATTR_SYNC_WINDOW_SIZE,
+
+    /**
+     * @brief Completion callback for windowed requests.
+     *
+     * @type sai_pointer_t sai_redis_sync_completion_fn
+     * @flags CREATE_AND_SET
+     * @default NULL
+     */
+    SAI_REDIS_SWITCH_ATTR_SYNC_COMPLETION_CALLBACK,
+
+    /**
+     * @brief Wait until all windowed requests are completed.
+     *
+     * Returns first failure status of windowed requests completed since
+     * previous drain, or success if all of them succeeded.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    SAI_REDIS_SWITCH_ATTR_SYNC_DRAIN,
+
+    /**
+     * @brief Asynchronous recording.
+     *
+     * When enabled, API calls only put records into lock-free staging buffer
+     * and background thread writes them to recording file in batches. Buffer
+     * is drained before recording file is closed, reopened or renamed.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    SAI_REDIS_SWITCH_ATTR_RECORDING_ASYNC,
+
+    /**
+     * @brief Recording format.
+     *
+     * It will have only impact on next opened recording file.
+     *
+     * @type sai_redis_recording_format_t
+     * @flags CREATE_AND_SET
+     * @default SAI_REDIS_RECORDING_FORMAT_TEXT
+     */
+    SAI_REDIS_SWITCH_ATTR_RECORDING_FORMAT,
+
+    /**
+     * @brief Recording file size in bytes which triggers rotation.
+     *
+     * When recording file reaches this size, it's closed, renamed to
+     * segment with timestamp suffix and new recording file is opened.
+     * Value 0 disables size based rotation.
+     *
+     * @type sai_uint64_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_REDIS_SWITCH_ATTR_RECORDING_ROTATE_SIZE,
+
+    /**
+     * @brief Recording file age in seconds which triggers rotation.
+     *
+     * Value 0 disables time based rotation.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_REDIS_SWITCH_ATTR_RECORDING_ROTATE_INTERVAL,
+
+    /**
+     * @brief Compress rotated recording segments.
+     *
+     * Segments are gzip compressed on background thread. Saiplayer can read
+     * compressed segments directly.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default true
+     */
+    SAI_REDIS_SWITCH_ATTR_RECORDING_ROTATE_COMPRESS,
+
+    /**
+     * @brief Maximum number of rotated recording segments to keep.
+     *
+     * Oldest segments above this limit are removed. Value 0 keeps all
+     * segments.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_REDIS_SWITCH_ATTR_RECORDING_ROTATE_MAX_SEGMENTS,
+
 } sai_redis_switch_attr_t;
 
 /**
@@ -40,6 +40,22 @@
 
 #define REDIS_ASIC_STATE_COMMAND_GETRESPONSE        "getresponse"
 
+/**
+ * @brief Field carrying sequence number of windowed request.
+ *
+ * Added as last field of create/remove/set request, and echoed back by syncd
+ * as last field of response.
+ */
+#define REDIS_ASIC_STATE_SEQUENCE_FIELD             "sequence"
+
+/**
+ * @brief Field of attribute capability query used as sync window handshake.
+ *
+ * Syncd which supports windowed requests answers it with success and the
+ * same field, older syncd rejects query as invalid.
+ */
+#define REDIS_ASIC_STATE_SYNC_WINDOW_HANDSHAKE_FIELD "SAI_REDIS_SYNC_WINDOW"
+
 #define REDIS_ASIC_STATE_COMMAND_FLUSH              "flush"
 #define REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE      "flushresponse"
 
@@ -106,3 +122,15 @@
 // TODO to be removed (used only for plugin register)
 #define REDIS_DEFAULT_DATABASE_FLEX_COUNTER "FLEX_COUNTER_DB"
 
+/**
+ * @brief Flex counter group publish mode field.
+ *
+ * In "delta" mode only counters which value changed since last poll are
+ * written to COUNTERS_DB, "full" mode writes all counters on every poll.
+ */
+#define PUBLISH_MODE_FIELD  "PUBLISH_MODE"
+#define PUBLISH_MODE_FULL   "full"
+#define PUBLISH_MODE_DELTA  "delta"
+
+#define BULK_CHUNK_SIZE_AUTO "auto"
+
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "swss/logger.h"
+#include "swss/sal.h"
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+namespace saimeta
+{
+    /**
+     * @brief Bounded lock-free multiple producer single consumer ring buffer.
+     *
+     * All slots are preallocated at construction time, and values are moved
+     * in and out of the slots, so no allocation is done on enqueue or
+     * dequeue. Each slot carries a sequence number which tells whether slot
+     * is ready to be written by producer or read by consumer.
+     *
+     * Only one thread at a time can dequeue from the buffer.
+     */
+    template <class T>
+    class MpscRingBuffer
+    {
+        public:
+
+            /**
+             * @brief Constructor.
+             *
+             * @param capacity Minimum number of slots, will be rounded up to
+             * power of 2.
+             */
+            explicit MpscRingBuffer(
+                    _In_ size_t capacity);
+
+            virtual ~MpscRingBuffer() = default;
+
+        public:
+
+            /**
+             * @brief Try to enqueue value.
+             *
+             * Value is moved only when enqueue succeeds, when buffer is full
+             * value is left untouched.
+             */
+            bool tryEnqueue(
+                    _In_ T&& val);
+
+            bool tryDequeue(
+                    _Out_ T& val);
+
+            /**
+             * @brief Get number of items in the buffer.
+             *
+             * When producers are active, returned value is approximate.
+             */
+            size_t size() const;
+
+            bool empty() const;
+
+            size_t capacity() const;
+
+        private:
+
+            struct Slot
+            {
+                std::atomic<size_t> m_sequence;
+
+                T m_value;
+            };
+
+            std::unique_ptr<Slot[]> m_slots;
+
+            size_t m_mask;
+
+            alignas(64) std::atomic<size_t> m_enqueuePos;
+
+            alignas(64) std::atomic<size_t> m_dequeuePos;
+
+            MpscRingBuffer(const MpscRingBuffer&) = delete;
+            MpscRingBuffer& operator=(const MpscRingBuffer&) = delete;
+    };
+
+    template <class T>
+    MpscRingBuffer<T>::MpscRingBuffer(
+            _In_ size_t capacity):
+        m_enqueuePos(0),
+        m_dequeuePos(0)
+    {
+        SWSS_LOG_ENTER();
+
+        if (capacity < 2)
+        {
+            SWSS_LOG_THROW("ring buffer capacity must be at least 2, got %zu", capacity);
+        }
+
+        size_t size = 2;
+
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+
+        m_mask = size - 1;
+
+        m_slots.reset(new Slot[size]);
+
+        for (size_t idx = 0; idx < size; idx++)
+        {
+            m_slots[idx].m_sequence.store(idx, std::memory_order_relaxed);
+        }
+    }
+
+    template <class T>
+    bool MpscRingBuffer<T>::tryEnqueue(
+            _In_ T&& val)
+    {
+        SWSS_LOG_ENTER();
+
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+        Slot* slot;
+
+        while (true)
+        {
+            slot = &m_slots[pos & m_mask];
+
+            size_t seq = slot->m_sequence.load(std::memory_order_acquire);
+
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+            if (diff == 0)
+            {
+                // slot is free, try to claim it
+
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false; // buffer is full
+            }
+            else
+            {
+                // other producer claimed this slot
+
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->m_value = std::move(val);
+
+        slot->m_sequence.store(pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    template <class T>
+    bool MpscRingBuffer<T>::tryDequeue(
+            _Out_ T& val)
+    {
+        SWSS_LOG_ENTER();
+
+        size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+
+        Slot* slot = &m_slots[pos & m_mask];
+
+        size_t seq = slot->m_sequence.load(std::memory_order_acquire);
+
+        if ((intptr_t)seq - (intptr_t)(pos + 1) < 0)
+        {
+            return false; // buffer is empty or producer didn't finish writing
+        }
+
+        val = std::move(slot->m_value);
+
+        slot->m_sequence.store(pos + m_mask + 1, std::memory_order_release);
+
+        m_dequeuePos.store(pos + 1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    template <class T>
+    size_t MpscRingBuffer<T>::size() const
+    {
+        SWSS_LOG_ENTER();
+
+        size_t dequeuePos = m_dequeuePos.load(std::memory_order_relaxed);
+        size_t enqueuePos = m_enqueuePos.load(std::memory_order_relaxed);
+
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    template <class T>
+    bool MpscRingBuffer<T>::empty() const
+    {
+        SWSS_LOG_ENTER();
+
+        return size() == 0;
+    }
+
+    template <class T>
+    size_t MpscRingBuffer<T>::capacity() const
+    {
+        SWSS_LOG_ENTER();
+
+        return m_mask + 1;
+    }
+}
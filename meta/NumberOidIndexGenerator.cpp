@@ -34,6 +34,18 @@ std::vector<uint64_t> NumberOidIndexGenerator::incrementBy(
     return result;
 }
 
+uint64_t NumberOidIndexGenerator::incrementRange(
+    _In_ uint64_t count)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t first = m_index + 1;
+
+    m_index += count;
+
+    return first;
+}
+
 void NumberOidIndexGenerator::reset()
 {
     SWSS_LOG_ENTER();
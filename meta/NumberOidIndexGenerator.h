@@ -19,6 +19,8 @@ namespace saimeta
             virtual uint64_t increment() override;
             virtual std::vector<uint64_t> incrementBy(
                 _In_ uint64_t count) override;
+            virtual uint64_t incrementRange(
+                _In_ uint64_t count) override;
 
             virtual void reset() override;
 
@@ -0,0 +1,225 @@
+#include "ZeroMQBinaryFraming.h"
+
+#include "swss/logger.h"
+
+#include <zmq.h>
+#include <string.h>
+
+using namespace sairedis;
+
+#define ZMQ_MAX_RETRY 10
+
+const std::string ZeroMQBinaryFraming::MAGIC = "SAIRDBIN1";
+
+const std::string ZeroMQBinaryFraming::HANDSHAKE_FIELD = "SAI_REDIS_ZMQ_BINARY_FRAMING";
+
+std::vector<swss::FieldValueTuple> ZeroMQBinaryFraming::getHandshakeValues()
+{
+    SWSS_LOG_ENTER();
+
+    return { swss::FieldValueTuple(HANDSHAKE_FIELD, MAGIC) };
+}
+
+bool ZeroMQBinaryFraming::isHandshake(
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    return values.size() == 1 &&
+        fvField(values[0]) == HANDSHAKE_FIELD &&
+        fvValue(values[0]) == MAGIC;
+}
+
+int ZeroMQBinaryFraming::sendFrame(
+        _In_ void* socket,
+        _In_ const std::string& data,
+        _In_ int flags)
+{
+    SWSS_LOG_ENTER();
+
+    for (int i = 0; true; ++i)
+    {
+        int rc = zmq_send(socket, data.data(), data.size(), flags);
+
+        if (rc < 0 && zmq_errno() == EINTR && i < ZMQ_MAX_RETRY)
+        {
+            continue;
+        }
+
+        return rc < 0 ? -1 : 0;
+    }
+}
+
+int ZeroMQBinaryFraming::send(
+        _In_ void* socket,
+        _In_ const std::string& key,
+        _In_ const std::string& op,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    if (sendFrame(socket, MAGIC, ZMQ_SNDMORE) < 0)
+        return -1;
+
+    if (sendFrame(socket, key, ZMQ_SNDMORE) < 0)
+        return -1;
+
+    if (sendFrame(socket, op, values.size() ? ZMQ_SNDMORE : 0) < 0)
+        return -1;
+
+    for (size_t idx = 0; idx < values.size(); idx++)
+    {
+        if (sendFrame(socket, fvField(values[idx]), ZMQ_SNDMORE) < 0)
+            return -1;
+
+        if (sendFrame(socket, fvValue(values[idx]), (idx + 1 < values.size()) ? ZMQ_SNDMORE : 0) < 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+bool ZeroMQBinaryFraming::hasMore(
+        _In_ void* socket)
+{
+    SWSS_LOG_ENTER();
+
+    int more = 0;
+    size_t moreLen = sizeof(more);
+
+    if (zmq_getsockopt(socket, ZMQ_RCVMORE, &more, &moreLen) != 0)
+    {
+        SWSS_LOG_ERROR("zmq_getsockopt ZMQ_RCVMORE failed, zmqerrno: %d", zmq_errno());
+
+        return false;
+    }
+
+    return more != 0;
+}
+
+bool ZeroMQBinaryFraming::isMagic(
+        _In_ const void* data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    return size == MAGIC.size() && memcmp(data, MAGIC.data(), size) == 0;
+}
+
+int ZeroMQBinaryFraming::recvFrame(
+        _In_ void* socket,
+        _Out_ std::string& data)
+{
+    SWSS_LOG_ENTER();
+
+    zmq_msg_t msg;
+
+    zmq_msg_init(&msg);
+
+    int rc;
+
+    for (int i = 0; true; ++i)
+    {
+        rc = zmq_msg_recv(&msg, socket, 0);
+
+        if (rc < 0 && zmq_errno() == EINTR && i < ZMQ_MAX_RETRY)
+        {
+            continue;
+        }
+
+        break;
+    }
+
+    if (rc >= 0)
+    {
+        data.assign((const char*)zmq_msg_data(&msg), zmq_msg_size(&msg));
+    }
+
+    zmq_msg_close(&msg);
+
+    return rc < 0 ? -1 : 0;
+}
+
+void ZeroMQBinaryFraming::drain(
+        _In_ void* socket)
+{
+    SWSS_LOG_ENTER();
+
+    int count = 0;
+
+    while (hasMore(socket))
+    {
+        zmq_msg_t msg;
+
+        zmq_msg_init(&msg);
+
+        int rc = zmq_msg_recv(&msg, socket, 0);
+
+        zmq_msg_close(&msg);
+
+        if (rc >= 0)
+        {
+            count++;
+        }
+        else if (zmq_errno() != EINTR)
+        {
+            SWSS_LOG_ERROR("zmq_msg_recv failed while draining message, zmqerrno: %d", zmq_errno());
+            break;
+        }
+    }
+
+    if (count)
+    {
+        SWSS_LOG_WARN("drained %d remaining frames of message", count);
+    }
+}
+
+int ZeroMQBinaryFraming::recv(
+        _In_ void* socket,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    auto& values = kfvFieldsValues(kco);
+
+    values.clear();
+
+    if (!hasMore(socket) || recvFrame(socket, kfvKey(kco)) < 0)
+    {
+        drain(socket);
+        return -1;
+    }
+
+    if (!hasMore(socket) || recvFrame(socket, kfvOp(kco)) < 0)
+    {
+        drain(socket);
+        return -1;
+    }
+
+    while (hasMore(socket))
+    {
+        std::string field;
+        std::string value;
+
+        if (recvFrame(socket, field) < 0)
+        {
+            drain(socket);
+            return -1;
+        }
+
+        if (!hasMore(socket))
+        {
+            SWSS_LOG_THROW("binary message for key %s has field %s without value", kfvKey(kco).c_str(), field.c_str());
+        }
+
+        if (recvFrame(socket, value) < 0)
+        {
+            drain(socket);
+            return -1;
+        }
+
+        values.emplace_back(std::move(field), std::move(value));
+    }
+
+    return 0;
+}
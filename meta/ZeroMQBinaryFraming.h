@@ -0,0 +1,108 @@
+#pragma once
+
+#include "swss/table.h"
+#include "swss/sal.h"
+
+#include <string>
+#include <vector>
+
+namespace sairedis
+{
+    /**
+     * @brief Binary framing of ZMQ requests and responses.
+     *
+     * Message is sent as multipart ZMQ message, where first frame is magic
+     * header, then key, op and each field and value are sent as separate
+     * frames. Each ZMQ frame carries its own length, so no escaping or
+     * parsing is needed on receiving side.
+     *
+     * Legacy JSON message is always single frame, so receiver can tell both
+     * formats apart by checking if first frame has more frames following.
+     *
+     * Client only switches to binary framing after handshake. Handshake is
+     * sent as JSON attribute capability query on NULL switch with single
+     * HANDSHAKE_FIELD field. Server which supports binary framing answers it
+     * with the same field, while older server treats it as invalid query and
+     * responds with error status, so client stays on JSON.
+     */
+    class ZeroMQBinaryFraming
+    {
+        private:
+
+            ZeroMQBinaryFraming() = delete;
+            ~ZeroMQBinaryFraming() = delete;
+
+        public:
+
+            static const std::string MAGIC;
+
+            static const std::string HANDSHAKE_FIELD;
+
+            /**
+             * @brief Get handshake request fields.
+             */
+            static std::vector<swss::FieldValueTuple> getHandshakeValues();
+
+            /**
+             * @brief Check if values are handshake request or response fields.
+             */
+            static bool isHandshake(
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            /**
+             * @brief Send message using binary framing.
+             *
+             * @return 0 on success, -1 on failure, zmq_errno() is set.
+             */
+            static int send(
+                    _In_ void* socket,
+                    _In_ const std::string& key,
+                    _In_ const std::string& op,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            /**
+             * @brief Check if last received frame has more frames following.
+             */
+            static bool hasMore(
+                    _In_ void* socket);
+
+            /**
+             * @brief Check if received first frame is binary framing header.
+             */
+            static bool isMagic(
+                    _In_ const void* data,
+                    _In_ size_t size);
+
+            /**
+             * @brief Receive and discard remaining frames of current message.
+             *
+             * Must be called when receive fails in the middle of multipart
+             * message, otherwise next receive will return frames of this
+             * message.
+             */
+            static void drain(
+                    _In_ void* socket);
+
+            /**
+             * @brief Receive rest of binary message after magic frame.
+             *
+             * On failure remaining frames of message are drained.
+             *
+             * @return 0 on success, -1 on failure, zmq_errno() is set.
+             */
+            static int recv(
+                    _In_ void* socket,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco);
+
+        private:
+
+            static int sendFrame(
+                    _In_ void* socket,
+                    _In_ const std::string& data,
+                    _In_ int flags);
+
+            static int recvFrame(
+                    _In_ void* socket,
+                    _Out_ std::string& data);
+    };
+}
@@ -1,4 +1,8 @@
 #include "ZeroMQSelectableChannel.h"
+#include "ZeroMQBinaryFraming.h"
+
+#include "sairediscommon.h"
+#include "sai_serialize.h"
 
 #include "swss/logger.h"
 #include "swss/json.h"
@@ -18,6 +22,7 @@ ZeroMQSelectableChannel::ZeroMQSelectableChannel(
     m_context(nullptr),
     m_socket(nullptr),
     m_fd(0),
+    m_binaryFraming(false),
     m_allowZmqPoll(false),
     m_runThread(true),
     m_zmqResponseBufferSize(zmqResponseBufferSize)
@@ -174,21 +179,9 @@ void ZeroMQSelectableChannel::pop(
         SWSS_LOG_THROW("queue is empty, can't pop");
     }
 
-    std::string msg = m_queue.front();
-    m_queue.pop();
-
-    auto& values = kfvFieldsValues(kco);
+    kco = std::move(m_queue.front());
 
-    values.clear();
-
-    swss::JSon::readJson(msg, values);
-
-    swss::FieldValueTuple fvt = values.at(0);
-
-    kfvKey(kco) = fvField(fvt);
-    kfvOp(kco) = fvValue(fvt);
-
-    values.erase(values.begin());
+    m_queue.pop();
 }
 
 void ZeroMQSelectableChannel::set(
@@ -198,17 +191,30 @@ void ZeroMQSelectableChannel::set(
 {
     SWSS_LOG_ENTER();
 
-    std::vector<swss::FieldValueTuple> copy = values;
+    int rc;
 
-    swss::FieldValueTuple opdata(key, op);
+    if (m_binaryFraming)
+    {
+        SWSS_LOG_DEBUG("sending binary: %s %s", key.c_str(), op.c_str());
 
-    copy.insert(copy.begin(), opdata);
+        rc = ZeroMQBinaryFraming::send(m_socket, key, op, values) == 0 ? 1 : -1;
+    }
+    else
+    {
+        std::vector<swss::FieldValueTuple> copy;
 
-    std::string msg = swss::JSon::buildJson(copy);
+        copy.reserve(values.size() + 1);
 
-    SWSS_LOG_DEBUG("sending: %s", msg.c_str());
+        copy.emplace_back(key, op);
 
-    int rc = zmq_send(m_socket, msg.c_str(), msg.length(), 0);
+        copy.insert(copy.end(), values.begin(), values.end());
+
+        std::string msg = swss::JSon::buildJson(copy);
+
+        SWSS_LOG_DEBUG("sending: %s", msg.c_str());
+
+        rc = zmq_send(m_socket, msg.c_str(), msg.length(), 0);
+    }
 
     // at this point we already did send/receive pattern, so we can notify
     // thread that we can poll again
@@ -248,14 +254,65 @@ uint64_t ZeroMQSelectableChannel::readData()
 
     if (rc >= m_zmqResponseBufferSize)
     {
+        ZeroMQBinaryFraming::drain(m_socket);
+
         SWSS_LOG_THROW("zmq_recv message was truncated (over %d bytes, received %d), increase buffer size, message DROPPED",
                 m_zmqResponseBufferSize,
                 rc);
     }
 
+    swss::KeyOpFieldsValuesTuple kco;
+
+    m_binaryFraming = ZeroMQBinaryFraming::hasMore(m_socket);
+
+    if (m_binaryFraming)
+    {
+        if (!ZeroMQBinaryFraming::isMagic(m_buffer.data(), rc))
+        {
+            ZeroMQBinaryFraming::drain(m_socket);
+
+            SWSS_LOG_THROW("zmq_recv multipart message without binary framing header");
+        }
+
+        if (ZeroMQBinaryFraming::recv(m_socket, kco) < 0)
+        {
+            SWSS_LOG_THROW("zmq_recv binary message failed, zmqerrno: %d", zmq_errno());
+        }
+
+        m_queue.push(std::move(kco));
+
+        return 0;
+    }
+
     m_buffer.at(rc) = 0; // make sure that we end string with zero before parse
 
-    m_queue.push((char*)m_buffer.data());
+    auto& values = kfvFieldsValues(kco);
+
+    swss::JSon::readJson((char*)m_buffer.data(), values);
+
+    swss::FieldValueTuple fvt = values.at(0);
+
+    kfvKey(kco) = fvField(fvt);
+    kfvOp(kco) = fvValue(fvt);
+
+    values.erase(values.begin());
+
+    if (kfvOp(kco) == REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY &&
+            ZeroMQBinaryFraming::isHandshake(values))
+    {
+        SWSS_LOG_NOTICE("binary framing handshake on %s, confirming", m_endpoint.c_str());
+
+        // handshake is answered here and it's not queued, so
+        // select will not report this channel as having data
+
+        set(sai_serialize_status(SAI_STATUS_SUCCESS),
+                ZeroMQBinaryFraming::getHandshakeValues(),
+                REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
+
+        return 0;
+    }
+
+    m_queue.push(std::move(kco));
 
     return 0;
 }
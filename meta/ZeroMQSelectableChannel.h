@@ -67,7 +67,13 @@ namespace sairedis
 
             int m_fd;
 
-            std::queue<std::string> m_queue;
+            std::queue<swss::KeyOpFieldsValuesTuple> m_queue;
+
+            /**
+             * @brief True if last request was received using binary framing,
+             * response will be sent using the same framing.
+             */
+            bool m_binaryFraming;
 
             std::vector<uint8_t> m_buffer;
 
@@ -3,6 +3,7 @@
 #include "sairedis.h"
 #include "sairediscommon.h"
 #include "VirtualObjectIdManager.h"
+#include "Recorder.h"
 
 #include "meta/sai_serialize.h"
 #include "meta/PerformanceIntervalTimer.h"
@@ -64,7 +65,9 @@ SaiPlayer::SaiPlayer(
         _In_ std::shared_ptr<sairedis::SaiInterface> sai,
         _In_ std::shared_ptr<CommandLineOptions> cmd):
     m_sai(sai),
-    m_commandLineOptions(cmd)
+    m_commandLineOptions(cmd),
+    m_infile(&m_infileBuf),
+    m_binaryRecording(false)
 {
     SWSS_LOG_ENTER();
 
@@ -2803,7 +2806,7 @@ void SaiPlayer::processBulk(
         do
         {
             // this line may be notification, we need to skip
-            std::getline(m_infile, response);
+            readLine(response);
         }
         while (response[response.find_first_of("|") + 1] == 'n');
 
@@ -2892,6 +2895,19 @@ void SaiPlayer::processBulk(
     }
 }
 
+bool SaiPlayer::readLine(
+        _Out_ std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_binaryRecording)
+    {
+        return sairedis::Recorder::readBinaryRecord(m_infile, line);
+    }
+
+    return (bool)std::getline(m_infile, line);
+}
+
 int SaiPlayer::replay()
 {
     //swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_DEBUG);
@@ -2909,17 +2925,19 @@ int SaiPlayer::replay()
 
     SWSS_LOG_NOTICE("using file: %s", filename.c_str());
 
-    m_infile = std::ifstream{filename};
-
-    if (!m_infile.is_open())
+    if (!m_infileBuf.open(filename))
     {
         SWSS_LOG_ERROR("failed to open file %s", filename.c_str());
         return -1;
     }
 
+    m_binaryRecording = sairedis::Recorder::readBinaryHeader(m_infile);
+
+    SWSS_LOG_NOTICE("recording format: %s", m_binaryRecording ? "binary" : "text");
+
     std::string line;
 
-    while (std::getline(m_infile, line))
+    while (readLine(line))
     {
         // std::cout << "processing " << line << std::endl;
 
@@ -2938,7 +2956,7 @@ int SaiPlayer::replay()
                     do
                     {
                         // this line may be notification, we need to skip
-                        if (!std::getline(m_infile, response))
+                        if (!readLine(response))
                         {
                             SWSS_LOG_THROW("failed to read next file from file, previous: %s", line.c_str());
                         }
@@ -2956,7 +2974,7 @@ int SaiPlayer::replay()
                     do
                     {
                         // this line may be notification, we need to skip
-                        if (!std::getline(m_infile, response))
+                        if (!readLine(response))
                         {
                             SWSS_LOG_THROW("failed to read next file from file, previous: %s", line.c_str());
                         }
@@ -3129,7 +3147,7 @@ int SaiPlayer::replay()
             do
             {
                 // this line may be notification, we need to skip
-                std::getline(m_infile, response);
+                readLine(response);
             }
             while (response[response.find_first_of("|") + 1] == 'n');
 
@@ -3174,7 +3192,7 @@ int SaiPlayer::replay()
         }
     }
 
-    m_infile.close();
+    m_infileBuf.close();
 
     SWSS_LOG_NOTICE("finished replaying %s with SUCCESS", filename.c_str());
 
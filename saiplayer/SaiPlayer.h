@@ -7,7 +7,10 @@
 #include "syncd/ServiceMethodTable.h"
 #include "syncd/SwitchNotifications.h"
 
+#include "GzipInputStreamBuf.h"
+
 #include <fstream>
+#include <istream>
 #include <memory>
 #include <map>
 
@@ -36,6 +39,14 @@ namespace saiplayer
 
             int replay();
 
+            /**
+             * @brief Read next recording line.
+             *
+             * Binary recording records are converted to text lines.
+             */
+            bool readLine(
+                    _Out_ std::string& line);
+
             void processBulk(
                     _In_ sai_common_api_t api,
                     _In_ const std::string &line);
@@ -290,7 +301,15 @@ namespace saiplayer
 
             std::shared_ptr<CommandLineOptions> m_commandLineOptions;
 
-            std::ifstream m_infile;
+            /**
+             * @brief Recording file buffer, reads both plain and gzip
+             * compressed recordings.
+             */
+            sairedis::GzipInputStreamBuf m_infileBuf;
+
+            std::istream m_infile;
+
+            bool m_binaryRecording;
 
             std::map<sai_object_id_t,sai_object_id_t> m_local_to_redis;
             std::map<sai_object_id_t,sai_object_id_t> m_redis_to_local;
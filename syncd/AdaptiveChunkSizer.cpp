@@ -0,0 +1,245 @@
+#include "AdaptiveChunkSizer.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+
+using namespace syncd;
+
+// weight of newest measurement in average poll time
+#define COST_EWMA_WEIGHT (0.3)
+
+// trial size must be better by this factor to become best size
+#define IMPROVEMENT_FACTOR (0.95)
+
+constexpr uint32_t AdaptiveChunkSizer::DEFAULT_MIN_CHUNK_SIZE;
+constexpr uint32_t AdaptiveChunkSizer::DEFAULT_EXPLORE_INTERVAL;
+constexpr uint32_t AdaptiveChunkSizer::DEFAULT_RECOVERY_INTERVAL;
+
+const std::vector<uint64_t> AdaptiveChunkSizer::HISTOGRAM_BOUNDS_US = { 100, 1000, 10000, 100000, 1000000 };
+
+AdaptiveChunkSizer::AdaptiveChunkSizer(
+        _In_ uint32_t minChunkSize,
+        _In_ uint32_t exploreInterval,
+        _In_ uint32_t recoveryInterval):
+    m_minChunkSize(minChunkSize ? minChunkSize : 1),
+    m_exploreInterval(exploreInterval ? exploreInterval : 1),
+    m_recoveryInterval(recoveryInterval ? recoveryInterval : 1),
+    m_objectCount(0),
+    m_maxChunkSize(UINT32_MAX),
+    m_bestChunkSize(0),
+    m_trialChunkSize(0),
+    m_trialFailed(false),
+    m_pollCount(0),
+    m_stablePollCount(0),
+    m_exploreUp(false),
+    m_histogram(HISTOGRAM_BOUNDS_US.size() + 1, 0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+uint32_t AdaptiveChunkSizer::clamp(
+        _In_ uint32_t chunkSize) const
+{
+    SWSS_LOG_ENTER();
+
+    chunkSize = std::min(chunkSize, m_maxChunkSize);
+    chunkSize = std::min(chunkSize, m_objectCount);
+
+    return std::max(chunkSize, std::min(m_minChunkSize, m_objectCount));
+}
+
+uint32_t AdaptiveChunkSizer::startPoll(
+        _In_ uint32_t objectCount)
+{
+    SWSS_LOG_ENTER();
+
+    if (objectCount == 0)
+    {
+        m_trialChunkSize = 0;
+        return 0;
+    }
+
+    if (objectCount != m_objectCount)
+    {
+        // measurements are not comparable when object count changed
+
+        m_objectCount = objectCount;
+
+        m_cost.clear();
+
+        // failed size was learned for different set of objects
+
+        m_maxChunkSize = UINT32_MAX;
+
+        m_stablePollCount = 0;
+
+        if (m_bestChunkSize == 0)
+        {
+            m_bestChunkSize = objectCount; // single call for all objects
+        }
+    }
+
+    m_bestChunkSize = clamp(m_bestChunkSize);
+
+    m_trialChunkSize = m_bestChunkSize;
+
+    m_trialFailed = false;
+
+    if (++m_pollCount % m_exploreInterval == 0)
+    {
+        uint32_t candidate = m_exploreUp
+            ? clamp(m_bestChunkSize * 2)
+            : clamp(std::max(m_bestChunkSize / 2, 1u));
+
+        if (candidate == m_bestChunkSize)
+        {
+            // limit reached in this direction, try other one
+
+            candidate = m_exploreUp
+                ? clamp(std::max(m_bestChunkSize / 2, 1u))
+                : clamp(m_bestChunkSize * 2);
+        }
+
+        m_exploreUp = !m_exploreUp;
+
+        m_trialChunkSize = candidate;
+    }
+
+    return m_trialChunkSize;
+}
+
+void AdaptiveChunkSizer::recordChunk(
+        _In_ uint32_t chunkSize,
+        _In_ uint64_t latencyUs,
+        _In_ bool success,
+        _In_ bool objectFailed)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = std::lower_bound(HISTOGRAM_BOUNDS_US.begin(), HISTOGRAM_BOUNDS_US.end(), latencyUs);
+
+    m_histogram[std::distance(HISTOGRAM_BOUNDS_US.begin(), it)]++;
+
+    if (success)
+    {
+        return;
+    }
+
+    if (objectFailed || chunkSize <= 1)
+    {
+        // failure is caused by particular object, smaller chunk will fail
+        // the same way
+
+        return;
+    }
+
+    m_trialFailed = true;
+
+    // back off below failed size
+
+    uint32_t maxChunkSize = std::max(chunkSize / 2, m_minChunkSize);
+
+    if (maxChunkSize < m_maxChunkSize)
+    {
+        SWSS_LOG_NOTICE("bulk chunk size %u failed, limiting chunk size to %u", chunkSize, maxChunkSize);
+
+        m_maxChunkSize = maxChunkSize;
+    }
+
+    m_stablePollCount = 0;
+}
+
+void AdaptiveChunkSizer::endPoll(
+        _In_ uint64_t totalUs)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_trialChunkSize == 0)
+    {
+        return;
+    }
+
+    if (m_trialFailed)
+    {
+        // failed measurement is not representative
+
+        m_cost.erase(m_trialChunkSize);
+
+        m_bestChunkSize = clamp(m_bestChunkSize);
+        return;
+    }
+
+    if (m_maxChunkSize != UINT32_MAX && ++m_stablePollCount >= m_recoveryInterval)
+    {
+        // failure could be transient, allow bigger chunks to be tried again
+
+        m_maxChunkSize = (m_maxChunkSize >= m_objectCount / 2) ? UINT32_MAX : m_maxChunkSize * 2;
+
+        m_stablePollCount = 0;
+
+        SWSS_LOG_NOTICE("raising bulk chunk size limit to %u", m_maxChunkSize);
+    }
+
+    auto it = m_cost.find(m_trialChunkSize);
+
+    if (it == m_cost.end())
+    {
+        m_cost[m_trialChunkSize] = (double)totalUs;
+    }
+    else
+    {
+        it->second = COST_EWMA_WEIGHT * (double)totalUs + (1 - COST_EWMA_WEIGHT) * it->second;
+    }
+
+    if (m_trialChunkSize == m_bestChunkSize)
+    {
+        return;
+    }
+
+    auto best = m_cost.find(m_bestChunkSize);
+
+    if (best == m_cost.end() || m_cost[m_trialChunkSize] < best->second * IMPROVEMENT_FACTOR)
+    {
+        SWSS_LOG_INFO("bulk chunk size changed %u -> %u", m_bestChunkSize, m_trialChunkSize);
+
+        m_bestChunkSize = m_trialChunkSize;
+    }
+}
+
+uint32_t AdaptiveChunkSizer::getChunkSize() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_bestChunkSize;
+}
+
+const std::vector<uint64_t>& AdaptiveChunkSizer::getHistogram() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_histogram;
+}
+
+std::vector<swss::FieldValueTuple> AdaptiveChunkSizer::getStats(
+        _In_ const std::string& prefix) const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back(prefix + "_chunk_size", std::to_string(m_bestChunkSize));
+
+    for (size_t idx = 0; idx < m_histogram.size(); idx++)
+    {
+        std::string bucket = (idx < HISTOGRAM_BOUNDS_US.size())
+            ? ("le_" + std::to_string(HISTOGRAM_BOUNDS_US[idx]) + "us")
+            : "inf";
+
+        values.emplace_back(prefix + "_latency_" + bucket, std::to_string(m_histogram[idx]));
+    }
+
+    return values;
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "swss/table.h"
+#include "swss/sal.h"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace syncd
+{
+    /**
+     * @brief Adaptive bulk chunk size selection.
+     *
+     * Measures latency of each bulk call and total time of each poll, and
+     * keeps moving chunk size towards value which minimizes total poll
+     * time. Current best size is used on most polls, and every few polls
+     * half or double size is tried. When vendor fails a chunk, maximum
+     * allowed chunk size is lowered below failed size, and it is raised back
+     * after few polls without failure or when object count changes.
+     */
+    class AdaptiveChunkSizer
+    {
+        public:
+
+            AdaptiveChunkSizer(
+                    _In_ uint32_t minChunkSize = DEFAULT_MIN_CHUNK_SIZE,
+                    _In_ uint32_t exploreInterval = DEFAULT_EXPLORE_INTERVAL,
+                    _In_ uint32_t recoveryInterval = DEFAULT_RECOVERY_INTERVAL);
+
+            virtual ~AdaptiveChunkSizer() = default;
+
+        public:
+
+            static constexpr uint32_t DEFAULT_MIN_CHUNK_SIZE = 16;
+
+            static constexpr uint32_t DEFAULT_EXPLORE_INTERVAL = 4;
+
+            /**
+             * @brief Number of polls without failure after which maximum
+             * chunk size is doubled.
+             */
+            static constexpr uint32_t DEFAULT_RECOVERY_INTERVAL = 16;
+
+            /**
+             * @brief Latency histogram buckets upper bounds in microseconds,
+             * last bucket is unbounded.
+             */
+            static const std::vector<uint64_t> HISTOGRAM_BOUNDS_US;
+
+        public:
+
+            /**
+             * @brief Get chunk size to use in next poll.
+             *
+             * @param objectCount Number of objects polled.
+             */
+            uint32_t startPoll(
+                    _In_ uint32_t objectCount);
+
+            /**
+             * @brief Record bulk call result.
+             *
+             * @param chunkSize Number of objects in bulk call.
+             * @param latencyUs Bulk call latency.
+             * @param success True if bulk call succeeded.
+             * @param objectFailed True if vendor reported failure of
+             * particular object, such failure is not caused by chunk size.
+             */
+            void recordChunk(
+                    _In_ uint32_t chunkSize,
+                    _In_ uint64_t latencyUs,
+                    _In_ bool success,
+                    _In_ bool objectFailed = false);
+
+            void endPoll(
+                    _In_ uint64_t totalUs);
+
+            uint32_t getChunkSize() const;
+
+            const std::vector<uint64_t>& getHistogram() const;
+
+            /**
+             * @brief Get chunk size and latency histogram as field values,
+             * field names are prefixed with given prefix.
+             */
+            std::vector<swss::FieldValueTuple> getStats(
+                    _In_ const std::string& prefix) const;
+
+        private:
+
+            uint32_t clamp(
+                    _In_ uint32_t chunkSize) const;
+
+        private:
+
+            uint32_t m_minChunkSize;
+
+            uint32_t m_exploreInterval;
+
+            uint32_t m_recoveryInterval;
+
+            uint32_t m_objectCount;
+
+            uint32_t m_maxChunkSize;
+
+            uint32_t m_bestChunkSize;
+
+            uint32_t m_trialChunkSize;
+
+            bool m_trialFailed;
+
+            uint64_t m_pollCount;
+
+            /**
+             * @brief Number of polls without failure since maximum chunk size
+             * was last changed.
+             */
+            uint32_t m_stablePollCount;
+
+            bool m_exploreUp;
+
+            /**
+             * @brief Exponentially weighted average of total poll time per
+             * chunk size.
+             */
+            std::map<uint32_t, double> m_cost;
+
+            std::vector<uint64_t> m_histogram;
+    };
+}
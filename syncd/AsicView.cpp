@@ -14,7 +14,8 @@ using namespace syncd;
 using namespace saimeta;
 
 AsicView::AsicView():
-    m_asicOperationId(0)
+    m_asicOperationId(0),
+    m_hasAttributeSignatureIndex(false)
 {
     SWSS_LOG_ENTER();
 
@@ -23,7 +24,8 @@ AsicView::AsicView():
 
 AsicView::AsicView(
         _In_ const swss::TableDump &dump):
-    m_asicOperationId(0)
+    m_asicOperationId(0),
+    m_hasAttributeSignatureIndex(false)
 {
     SWSS_LOG_ENTER();
 
@@ -71,10 +73,9 @@ void AsicView::fromDump(
 
         // TODO we could use sai deserialize object meta key
 
-        o->m_str_object_type  = key.first.substr(0, start);
         o->m_str_object_id    = key.first.substr(start + 1);
 
-        sai_deserialize_object_type(o->m_str_object_type, o->m_meta_key.objecttype);
+        sai_deserialize_object_type(key.first.substr(0, start), o->m_meta_key.objecttype);
 
         o->m_info = sai_metadata_get_object_type_info(o->m_meta_key.objecttype);
 
@@ -95,7 +96,7 @@ void AsicView::fromDump(
                 sai_deserialize_neighbor_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.neighbor_entry);
                 m_soNeighbors[o->m_str_object_id] = o;
 
-                m_neighborsByIp[sai_serialize_ip_address(o->m_meta_key.objectkey.key.neighbor_entry.ip_address)].push_back(o->m_str_object_id);
+                m_neighborsByIp[sai_serialize_ip_address(o->m_meta_key.objectkey.key.neighbor_entry.ip_address)].push_back(o);
 
                 break;
 
@@ -103,7 +104,7 @@ void AsicView::fromDump(
                 sai_deserialize_route_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.route_entry);
                 m_soRoutes[o->m_str_object_id] = o;
 
-                m_routesByPrefix[sai_serialize_ip_prefix(o->m_meta_key.objectkey.key.route_entry.destination)].push_back(o->m_str_object_id);
+                m_routesByPrefix[sai_serialize_ip_prefix(o->m_meta_key.objectkey.key.route_entry.destination)].push_back(o);
 
                 break;
 
@@ -402,6 +403,20 @@ void AsicView::insertNewVidReference(
             sai_serialize_object_id(vid).c_str());
 }
 
+void AsicView::bindExternalReferences(
+        _In_ const std::unordered_map<sai_object_id_t, int>& references)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto& kvp: references)
+    {
+        if (kvp.first == SAI_NULL_OBJECT_ID)
+            continue;
+
+        m_vidReference[kvp.first] += kvp.second;
+    }
+}
+
 /**
  * @brief Gets objects by object type.
  *
@@ -477,6 +492,158 @@ std::vector<std::shared_ptr<SaiObj>> AsicView::getNotProcessedObjectsByObjectTyp
     return list;
 }
 
+void AsicView::releasePreMatchIndexes()
+{
+    SWSS_LOG_ENTER();
+
+    // swap with empty maps to release bucket arrays as well
+
+    std::unordered_map<std::string,std::vector<std::shared_ptr<SaiObj>>>().swap(m_routesByPrefix);
+    std::unordered_map<std::string,std::vector<std::shared_ptr<SaiObj>>>().swap(m_neighborsByIp);
+}
+
+void AsicView::buildAttributeSignatureIndex()
+{
+    SWSS_LOG_ENTER();
+
+    m_attributeSignatureIndex.clear();
+    m_attributeSignatureMaxAttrCount.clear();
+
+    for (const auto &p: m_soOids)
+    {
+        const auto &obj = p.second;
+
+        auto objectType = obj->getObjectType();
+
+        // only VIDs are kept, so removed objects are not held by index
+
+        m_attributeSignatureIndex[objectType][getAttributeSignature(obj)].push_back(obj->getVid());
+
+        size_t attrCount = obj->getAllAttributes().size();
+
+        auto &maxAttrCount = m_attributeSignatureMaxAttrCount[objectType];
+
+        maxAttrCount = std::max(maxAttrCount, attrCount);
+    }
+
+    m_hasAttributeSignatureIndex = true;
+
+    for (const auto &ot: m_attributeSignatureIndex)
+    {
+        SWSS_LOG_INFO("attribute signature index for %s: %zu signatures",
+                sai_serialize_object_type(ot.first).c_str(),
+                ot.second.size());
+    }
+}
+
+void AsicView::releaseAttributeSignatureIndex()
+{
+    SWSS_LOG_ENTER();
+
+    std::map<sai_object_type_t, std::unordered_map<std::string, std::vector<sai_object_id_t>>>().swap(m_attributeSignatureIndex);
+
+    m_attributeSignatureMaxAttrCount.clear();
+
+    m_hasAttributeSignatureIndex = false;
+}
+
+size_t AsicView::getAttributeSignatureMaxAttrCount(
+        _In_ sai_object_type_t object_type) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_attributeSignatureMaxAttrCount.find(object_type);
+
+    if (it == m_attributeSignatureMaxAttrCount.end())
+    {
+        return 0;
+    }
+
+    return it->second;
+}
+
+bool AsicView::hasAttributeSignatureIndex() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_hasAttributeSignatureIndex;
+}
+
+std::vector<std::shared_ptr<SaiObj>> AsicView::getNotProcessedObjectsByAttributeSignature(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string& signature) const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::shared_ptr<SaiObj>> list;
+
+    auto it = m_attributeSignatureIndex.find(object_type);
+
+    if (it == m_attributeSignatureIndex.end())
+    {
+        return list;
+    }
+
+    auto sit = it->second.find(signature);
+
+    if (sit == it->second.end())
+    {
+        return list;
+    }
+
+    for (auto vid: sit->second)
+    {
+        /*
+         * Index is built once, so removed objects can be still on the list,
+         * and processed objects have their status changed.
+         */
+
+        auto oit = m_soOids.find(sai_serialize_object_id(vid));
+
+        if (oit != m_soOids.end() && oit->second->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+        {
+            list.push_back(oit->second);
+        }
+    }
+
+    return list;
+}
+
+std::string AsicView::getAttributeSignature(
+        _In_ const std::shared_ptr<const SaiObj>& obj)
+{
+    SWSS_LOG_ENTER();
+
+    // attributes are kept in hash map, so sort them by id first
+
+    std::map<sai_attr_id_t, std::shared_ptr<SaiAttr>> attrs;
+
+    for (const auto &attr: obj->getAllAttributes())
+    {
+        attrs.insert(attr);
+    }
+
+    std::string signature;
+
+    for (const auto &attr: attrs)
+    {
+        signature += std::to_string(attr.first);
+
+        auto valueType = attr.second->getAttrMetadata()->attrvaluetype;
+
+        if (!attr.second->isObjectIdAttr() &&
+                valueType != SAI_ATTR_VALUE_TYPE_POINTER &&
+                valueType != SAI_ATTR_VALUE_TYPE_QOS_MAP_LIST)
+        {
+            signature += "=" + attr.second->getStrAttrValue();
+        }
+
+        signature += "|";
+    }
+
+    return signature;
+}
+
 /**
  * @brief Gets all not processed objects
  *
@@ -525,7 +692,6 @@ std::shared_ptr<SaiObj> AsicView::createDummyExistingObject(
 
     std::shared_ptr<SaiObj> o = std::make_shared<SaiObj>();
 
-    o->m_str_object_type = sai_serialize_object_type(object_type);
     o->m_str_object_id   = sai_serialize_object_id(vid);
 
     o->m_meta_key.objecttype = object_type;
@@ -566,7 +732,7 @@ void AsicView::asicSetAttribute(
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_INFO("%s: %s -> %s:%s", currentObj->m_str_object_type.c_str(), currentObj->m_str_object_id.c_str(),
+    SWSS_LOG_INFO("%s: %s -> %s:%s", currentObj->getStrObjectType().c_str(), currentObj->m_str_object_id.c_str(),
             attr->getStrAttrId().c_str(), attr->getStrAttrValue().c_str());
 
     m_asicOperationId++;
@@ -620,7 +786,7 @@ void AsicView::asicSetAttribute(
             attr->getSaiAttr(),
             false);
 
-    std::string key = currentObj->m_str_object_type + ":" + currentObj->m_str_object_id;
+    std::string key = currentObj->getStrObjectType() + ":" + currentObj->m_str_object_id;
 
     auto kco = std::make_shared<swss::KeyOpFieldsValuesTuple>(key, "set", entry);
 
@@ -655,7 +821,7 @@ void AsicView::asicCreateObject(
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_INFO("%s: %s", currentObj->m_str_object_type.c_str(), currentObj->m_str_object_id.c_str());
+    SWSS_LOG_INFO("%s: %s", currentObj->getStrObjectType().c_str(), currentObj->m_str_object_id.c_str());
 
     m_asicOperationId++;
 
@@ -751,7 +917,7 @@ void AsicView::asicCreateObject(
         entry.push_back(null);
     }
 
-    std::string key = currentObj->m_str_object_type + ":" + currentObj->m_str_object_id;
+    std::string key = currentObj->getStrObjectType() + ":" + currentObj->m_str_object_id;
 
     auto kco = std::make_shared<swss::KeyOpFieldsValuesTuple>(key, "create", entry);
 
@@ -772,7 +938,7 @@ void AsicView::asicRemoveObject(
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_INFO("%s: %s", currentObj->m_str_object_type.c_str(), currentObj->m_str_object_id.c_str());
+    SWSS_LOG_INFO("%s: %s", currentObj->getStrObjectType().c_str(), currentObj->m_str_object_id.c_str());
 
     if (currentObj->getObjectStatus() != SAI_OBJECT_STATUS_NOT_PROCESSED)
     {
@@ -793,7 +959,7 @@ void AsicView::asicRemoveObject(
         if (count != 0)
         {
             SWSS_LOG_THROW("can't remove existing object %s:%s since reference count is %d, FIXME",
-                    currentObj->m_str_object_type.c_str(),
+                    currentObj->getStrObjectType().c_str(),
                     currentObj->m_str_object_id.c_str(),
                     count);
         }
@@ -878,7 +1044,7 @@ void AsicView::asicRemoveObject(
 
     std::vector<swss::FieldValueTuple> entry;
 
-    std::string key = currentObj->m_str_object_type + ":" + currentObj->m_str_object_id;
+    std::string key = currentObj->getStrObjectType() + ":" + currentObj->m_str_object_id;
 
     auto kco = std::make_shared<swss::KeyOpFieldsValuesTuple>(key, "remove", entry);
 
@@ -1295,7 +1461,7 @@ void AsicView::checkObjectsStatus() const
             const auto &o = *p.second;
 
             SWSS_LOG_ERROR("object was not processed: %s %s, status: %s (ref: %d)",
-                    o.m_str_object_type.c_str(),
+                    o.getStrObjectType().c_str(),
                     o.m_str_object_id.c_str(),
                     ObjectStatus::sai_serialize_object_status(o.getObjectStatus()).c_str(),
                     o.isOidObject() ? getVidReferenceCount(o.getVid()): -1);
@@ -143,6 +143,18 @@ namespace syncd
             void insertNewVidReference(
                     _In_ sai_object_id_t vid);
 
+            /**
+             * @brief Bind references held by entries which are not part of view.
+             *
+             * Entries paired before view was built still use their object
+             * ids, so reference count on those VIDs must be the same as if
+             * entries were loaded to view.
+             *
+             * @param[in] references Reference count per VID to be added.
+             */
+            void bindExternalReferences(
+                    _In_ const std::unordered_map<sai_object_id_t, int>& references);
+
         public:
 
             /**
@@ -171,6 +183,59 @@ namespace syncd
             std::vector<std::shared_ptr<SaiObj>> getNotProcessedObjectsByObjectType(
                     _In_ sai_object_type_t object_type) const;
 
+            /**
+             * @brief Releases memory of indexes used only to create pre match map.
+             */
+            void releasePreMatchIndexes();
+
+            /**
+             * @brief Builds attribute signature index of OID objects.
+             *
+             * Objects with equal signature have the same attribute ids and
+             * the same values of attributes compared by string value, so
+             * object with all attributes equal to given object can be found
+             * by hash lookup instead of comparing all objects of given type.
+             */
+            void buildAttributeSignatureIndex();
+
+            /**
+             * @brief Releases memory of attribute signature index.
+             */
+            void releaseAttributeSignatureIndex();
+
+            bool hasAttributeSignatureIndex() const;
+
+            /**
+             * @brief Gets maximum number of attributes of objects with given
+             * object type at the time when signature index was built.
+             */
+            size_t getAttributeSignatureMaxAttrCount(
+                    _In_ sai_object_type_t object_type) const;
+
+            /**
+             * @brief Gets not processed objects with given attribute signature.
+             *
+             * @param object_type Object type to be used as filter.
+             * @param signature Attribute signature.
+             *
+             * @return List of objects with requested object type, signature and
+             * marked as not processed.
+             */
+            std::vector<std::shared_ptr<SaiObj>> getNotProcessedObjectsByAttributeSignature(
+                    _In_ sai_object_type_t object_type,
+                    _In_ const std::string& signature) const;
+
+            /**
+             * @brief Gets attribute signature of object.
+             *
+             * Signature contains all attribute ids, and values of attributes
+             * which are equal only when serialized values are equal. Values of
+             * object id, pointer and QOS map list attributes are skipped, since
+             * they are compared in different way between views.
+             */
+            static std::string getAttributeSignature(
+                    _In_ const std::shared_ptr<const SaiObj>& obj);
+
             /**
              * @brief Gets all not processed objects
              *
@@ -280,8 +345,13 @@ namespace syncd
             StrObjectIdToSaiObjectHash m_soOids;
             StrObjectIdToSaiObjectHash m_soAll;
 
-            std::unordered_map<std::string,std::vector<std::string>> m_routesByPrefix;
-            std::unordered_map<std::string,std::vector<std::string>> m_neighborsByIp;
+            /*
+             * Used only to create pre match map, and released after that by
+             * releasePreMatchIndexes.
+             */
+
+            std::unordered_map<std::string,std::vector<std::shared_ptr<SaiObj>>> m_routesByPrefix;
+            std::unordered_map<std::string,std::vector<std::shared_ptr<SaiObj>>> m_neighborsByIp;
 
             ObjectIdToSaiObjectHash m_oOids;
 
@@ -354,5 +424,11 @@ namespace syncd
             std::vector<AsicOperation> m_asicRemoveOperationsNonObjectId;
 
             std::map<sai_object_type_t, StrObjectIdToSaiObjectHash> m_sotAll;
+
+            bool m_hasAttributeSignatureIndex;
+
+            std::map<sai_object_type_t, std::unordered_map<std::string, std::vector<sai_object_id_t>>> m_attributeSignatureIndex;
+
+            std::map<sai_object_type_t, size_t> m_attributeSignatureMaxAttrCount;
     };
 }
@@ -68,6 +68,16 @@ namespace syncd
             virtual std::set<sai_object_id_t> getColdVids(
                     _In_ sai_object_id_t switchVid) = 0;
 
+            virtual void saveDiscoveryCache(
+                    _In_ sai_object_id_t switchVid,
+                    _In_ const std::vector<swss::FieldValueTuple>& values) = 0;
+
+            virtual std::unordered_map<std::string, std::string> getDiscoveryCache(
+                    _In_ sai_object_id_t switchVid) = 0;
+
+            virtual void removeDiscoveryCache(
+                    _In_ sai_object_id_t switchVid) = 0;
+
             virtual void setPortLanes(
                     _In_ sai_object_id_t switchVid,
                     _In_ sai_object_id_t portRid,
@@ -171,6 +181,23 @@ namespace syncd
                     _In_ sai_object_id_t portVid,
                     _In_ sai_object_id_t bvId,
                     _In_ sai_fdb_flush_entry_type_t type) = 0;
+
+            /**
+             * @brief Write all buffered ASIC view changes to database.
+             *
+             * Barrier for clients which are buffering database writes, after
+             * this call all previous changes are visible in database.
+             */
+            virtual void flush() = 0;
+
+            /**
+             * @brief Write buffered ASIC view changes if oldest of them
+             * exceeded maximum buffering delay.
+             *
+             * Should be called periodically, since otherwise delay is only
+             * checked when next change is buffered.
+             */
+            virtual void flushExpired() = 0;
     };
 }
 
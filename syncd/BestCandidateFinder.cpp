@@ -14,10 +14,12 @@ using namespace syncd;
 BestCandidateFinder::BestCandidateFinder(
         _In_ const AsicView& currentView,
         _In_ const AsicView& temporaryView,
-        _In_ std::shared_ptr<const SaiSwitchInterface> sw):
+        _In_ std::shared_ptr<const SaiSwitchInterface> sw,
+        _In_ std::shared_ptr<WorkerPool> workerPool):
     m_currentView(currentView),
     m_temporaryView(temporaryView),
-    m_switch(sw)
+    m_switch(sw),
+    m_workerPool(workerPool)
 {
     SWSS_LOG_ENTER();
 
@@ -1465,7 +1467,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjec
     {
         SWSS_LOG_NOTICE("matched object by label '%s' for %s:%s",
             label.c_str(),
-            temporaryObj->m_str_object_type.c_str(),
+            temporaryObj->getStrObjectType().c_str(),
             temporaryObj->m_str_object_id.c_str());
 
         return sameLabel.at(0).obj;
@@ -1473,7 +1475,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjec
 
     SWSS_LOG_WARN("same label '%s' found on multiple objects for %s:%s, selecting one with most common atributes",
             label.c_str(),
-            temporaryObj->m_str_object_type.c_str(),
+            temporaryObj->getStrObjectType().c_str(),
             temporaryObj->m_str_object_id.c_str());
 
     std::sort(sameLabel.begin(), sameLabel.end(), compareByEqualAttributes);
@@ -1571,7 +1573,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjec
 
     int tempCount = findAllChildsInDependencyTreeCount(m_temporaryView, temporaryObj);
 
-    SWSS_LOG_DEBUG("%s count usage: %d", temporaryObj->m_str_object_type.c_str(), tempCount);
+    SWSS_LOG_DEBUG("%s count usage: %d", temporaryObj->getStrObjectType().c_str(), tempCount);
 
     std::vector<int> counts;
 
@@ -1599,13 +1601,111 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjec
     }
 
     SWSS_LOG_WARN("heuristic failed for %s, selecting at random (count: %d, exact match: %d)",
-            temporaryObj->m_str_object_type.c_str(),
+            temporaryObj->getStrObjectType().c_str(),
             tempCount,
             exact);
 
     return selectRandomCandidate(candidateObjects);
 }
 
+bool BestCandidateFinder::hasSpecialCandidateSelection(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Those object types prefer candidates based on label or usage in
+     * graph, even when other candidate has more equal attributes.
+     */
+
+    switch (objectType)
+    {
+        case SAI_OBJECT_TYPE_LAG:
+        case SAI_OBJECT_TYPE_VIRTUAL_ROUTER:
+        case SAI_OBJECT_TYPE_NEXT_HOP_GROUP:
+        case SAI_OBJECT_TYPE_ACL_TABLE_GROUP:
+        case SAI_OBJECT_TYPE_ACL_COUNTER:
+        case SAI_OBJECT_TYPE_ROUTER_INTERFACE:
+        case SAI_OBJECT_TYPE_POLICER:
+        case SAI_OBJECT_TYPE_HOSTIF_TRAP_GROUP:
+        case SAI_OBJECT_TYPE_ACL_TABLE:
+        case SAI_OBJECT_TYPE_BUFFER_POOL:
+        case SAI_OBJECT_TYPE_WRED:
+        case SAI_OBJECT_TYPE_BUFFER_PROFILE:
+        case SAI_OBJECT_TYPE_TUNNEL_MAP:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjectUsingSignature(
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_currentView.hasAttributeSignatureIndex() ||
+            hasSpecialCandidateSelection(temporaryObj->getObjectType()))
+    {
+        return nullptr;
+    }
+
+    if (m_temporaryView.m_preMatchMap.find(temporaryObj->getVid()) != m_temporaryView.m_preMatchMap.end())
+    {
+        return nullptr; // pre match takes precedence
+    }
+
+    size_t attrCount = temporaryObj->getAllAttributes().size();
+
+    if (m_currentView.getAttributeSignatureMaxAttrCount(temporaryObj->getObjectType()) > attrCount)
+    {
+        /*
+         * Current object with more attributes can also have all attributes
+         * of temporary object equal, then exact match would not be the only
+         * candidate with most equal attributes, and comparing all candidates
+         * could select other object, so don't short circuit.
+         */
+
+        return nullptr;
+    }
+
+    const auto bucket = m_currentView.getNotProcessedObjectsByAttributeSignature(
+            temporaryObj->getObjectType(),
+            AsicView::getAttributeSignature(temporaryObj));
+
+    std::shared_ptr<SaiObj> exactMatch;
+
+    for (const auto &currentObj: bucket)
+    {
+        sai_object_compare_info_t soci;
+
+        if (!evaluateCandidateObject(temporaryObj, currentObj, soci) || soci.equal_attributes != attrCount)
+        {
+            continue;
+        }
+
+        if (exactMatch != nullptr)
+        {
+            SWSS_LOG_INFO("multiple exact matches for %s, will compare all candidates",
+                    temporaryObj->m_str_object_id.c_str());
+
+            return nullptr;
+        }
+
+        exactMatch = currentObj;
+    }
+
+    if (exactMatch != nullptr)
+    {
+        SWSS_LOG_INFO("found exact match %s for %s using attribute signature",
+                exactMatch->m_str_object_id.c_str(),
+                temporaryObj->m_str_object_id.c_str());
+    }
+
+    return exactMatch;
+}
+
 std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObject(
         _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
 {
@@ -1679,7 +1779,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjec
     if (!temporaryObj->isOidObject())
     {
         SWSS_LOG_THROW("non object id %s is used in generic method, please implement special case, FIXME",
-                temporaryObj->m_str_object_type.c_str());
+                temporaryObj->getStrObjectType().c_str());
     }
 
     /*
@@ -1689,6 +1789,11 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjec
      * struct entry of object id.
      */
 
+    auto exactMatch = findCurrentBestMatchForGenericObjectUsingSignature(temporaryObj);
+
+    if (exactMatch != nullptr)
+        return exactMatch;
+
     sai_object_type_t object_type = temporaryObj->getObjectType();
 
     const auto notProcessedObjects = m_currentView.getNotProcessedObjectsByObjectType(object_type);
@@ -1703,190 +1808,11 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjec
      */
 
     SWSS_LOG_INFO("not processed objects for %s: %zu, attrs: %zu",
-            temporaryObj->m_str_object_type.c_str(),
+            temporaryObj->getStrObjectType().c_str(),
             notProcessedObjects.size(),
             attrs.size());
 
-    std::vector<sai_object_compare_info_t> candidateObjects;
-
-    for (const auto &currentObj: notProcessedObjects)
-    {
-        SWSS_LOG_INFO("* examing current obj: %s", currentObj->m_str_object_id.c_str());
-
-        sai_object_compare_info_t soci = { 0, currentObj };
-
-        bool has_different_create_only_attr = false;
-
-        /*
-         * NOTE: we only iterate by attributes that are present in temporary
-         * view. It may happen that current view has some additional attributes
-         * set that are create only and value can't be updated then, so in that
-         * case such object must be disqualified from being candidate.
-         */
-
-        for (const auto &attr: attrs)
-        {
-            sai_attr_id_t attrId = attr.first;
-
-            /*
-             * Function hasEqualAttribute check if attribute exists on both objects.
-             */
-
-            if (hasEqualAttribute(m_currentView, m_temporaryView, currentObj, temporaryObj, attrId))
-            {
-                soci.equal_attributes++;
-
-                SWSS_LOG_INFO("ob equal %s %s, %s: %s",
-                        temporaryObj->m_str_object_id.c_str(),
-                        currentObj->m_str_object_id.c_str(),
-                        attr.second->getStrAttrId().c_str(),
-                        attr.second->getStrAttrValue().c_str());
-            }
-            else
-            {
-                SWSS_LOG_INFO("ob not equal %s %s, %s: %s",
-                        temporaryObj->m_str_object_id.c_str(),
-                        currentObj->m_str_object_id.c_str(),
-                        attr.second->getStrAttrId().c_str(),
-                        attr.second->getStrAttrValue().c_str());
-
-                /*
-                 * Function hasEqualAttribute returns true only when both
-                 * attributes are existing and both are equal, so here it
-                 * returned false, so it may mean 2 things:
-                 *
-                 * - attribute doesn't exist in current view, or
-                 * - attributes are different
-                 *
-                 * If we check if attribute also exists in current view and has
-                 * CREATE_ONLY flag then attributes are different and we
-                 * disqualify this object since new temporary object needs to
-                 * pass new different attribute with CREATE_ONLY flag.
-                 *
-                 * Case when attribute doesn't exist is much more complicated
-                 * since it maybe conditional and have default value, we will
-                 * do that check when we select best match.
-                 */
-
-                /*
-                 * Get attribute metadata to see if contains CREATE_ONLY flag.
-                 */
-
-                const sai_attr_metadata_t* meta = attr.second->getAttrMetadata();
-
-                if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && currentObj->hasAttr(attrId))
-                {
-                    has_different_create_only_attr = true;
-
-                    SWSS_LOG_INFO("obj has not equal create only attributes %s",
-                            temporaryObj->m_str_object_id.c_str());
-
-                    /*
-                     * In this case there is no need to compare other
-                     * attributes since we won't be able to update them anyway.
-                     */
-
-                    break;
-                }
-
-                if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !currentObj->hasAttr(attrId))
-                {
-                    /*
-                     * This attribute exists only on temporary view and it's
-                     * create only.  If it has default value, check if it's the
-                     * same as current.
-                     */
-
-                    auto curDefault = getSaiAttrFromDefaultValue(m_currentView, m_switch, *meta);
-
-                    if (curDefault != nullptr)
-                    {
-                        if (curDefault->getStrAttrValue() != attr.second->getStrAttrValue())
-                        {
-                            has_different_create_only_attr = true;
-
-                            SWSS_LOG_INFO("obj has not equal create only attributes %s (default): %s",
-                                    temporaryObj->m_str_object_id.c_str(),
-                                    meta->attridname);
-                            break;
-                        }
-                        else
-                        {
-                            SWSS_LOG_INFO("obj has equal create only value %s (default): %s",
-                                    temporaryObj->m_str_object_id.c_str(),
-                                    meta->attridname);
-                        }
-                    }
-                }
-            }
-        }
-
-        /*
-         * Before we add this object as candidate, see if there are some create
-         * only attributes which are not present in temporary object but
-         * present in current, and if there is default value that is the same.
-         */
-
-        const auto curAttrs = currentObj->getAllAttributes();
-
-        for (auto curAttr: curAttrs)
-        {
-            if (attrs.find(curAttr.first) != attrs.end())
-            {
-                // attr exists in both objects.
-                continue;
-            }
-
-            const sai_attr_metadata_t* meta = curAttr.second->getAttrMetadata();
-
-            if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !temporaryObj->hasAttr(curAttr.first))
-            {
-                /*
-                 * This attribute exists only on current view and it's
-                 * create only.  If it has default value, check if it's the
-                 * same as current.
-                 */
-
-                auto tmpDefault = getSaiAttrFromDefaultValue(m_temporaryView, m_switch, *meta);
-
-                if (tmpDefault != nullptr)
-                {
-                    if (tmpDefault->getStrAttrValue() != curAttr.second->getStrAttrValue())
-                    {
-                        has_different_create_only_attr = true;
-
-                        SWSS_LOG_INFO("obj has not equal create only attributes %s (default): %s",
-                                currentObj->m_str_object_id.c_str(),
-                                meta->attridname);
-                        break;
-                    }
-                    else
-                    {
-                        SWSS_LOG_INFO("obj has equal create only value %s (default): %s",
-                                temporaryObj->m_str_object_id.c_str(),
-                                meta->attridname);
-                    }
-                }
-            }
-        }
-
-        if (has_different_create_only_attr)
-        {
-            /*
-             * Those objects differs with attribute which is marked as
-             * CREATE_ONLY so we will not be able to update current if
-             * necessary using SET operations.
-             */
-
-            continue;
-        }
-
-        SWSS_LOG_INFO("* current obj: %s has equal %lu attributes",
-                currentObj->m_str_object_id.c_str(),
-                soci.equal_attributes);
-
-        candidateObjects.push_back(soci);
-    }
+    std::vector<sai_object_compare_info_t> candidateObjects = findCandidateObjects(temporaryObj, notProcessedObjects);
 
     SWSS_LOG_INFO("number candidate objects for %s is %zu",
             temporaryObj->m_str_object_id.c_str(),
@@ -1999,6 +1925,266 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjec
     return findCurrentBestMatchForGenericObjectUsingHeuristic(temporaryObj, candidateObjects);
 }
 
+bool BestCandidateFinder::evaluateCandidateObject(
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
+        _In_ const std::shared_ptr<SaiObj> &currentObj,
+        _Out_ sai_object_compare_info_t &soci) const
+{
+    SWSS_LOG_ENTER();
+
+    const auto &attrs = temporaryObj->getAllAttributes();
+
+    SWSS_LOG_INFO("* examing current obj: %s", currentObj->m_str_object_id.c_str());
+
+    soci = { 0, currentObj };
+
+    bool has_different_create_only_attr = false;
+
+    /*
+     * NOTE: we only iterate by attributes that are present in temporary
+     * view. It may happen that current view has some additional attributes
+     * set that are create only and value can't be updated then, so in that
+     * case such object must be disqualified from being candidate.
+     */
+
+    for (const auto &attr: attrs)
+    {
+        sai_attr_id_t attrId = attr.first;
+
+        /*
+         * Function hasEqualAttribute check if attribute exists on both objects.
+         */
+
+        if (hasEqualAttribute(m_currentView, m_temporaryView, currentObj, temporaryObj, attrId))
+        {
+            soci.equal_attributes++;
+
+            SWSS_LOG_INFO("ob equal %s %s, %s: %s",
+                    temporaryObj->m_str_object_id.c_str(),
+                    currentObj->m_str_object_id.c_str(),
+                    attr.second->getStrAttrId().c_str(),
+                    attr.second->getStrAttrValue().c_str());
+        }
+        else
+        {
+            SWSS_LOG_INFO("ob not equal %s %s, %s: %s",
+                    temporaryObj->m_str_object_id.c_str(),
+                    currentObj->m_str_object_id.c_str(),
+                    attr.second->getStrAttrId().c_str(),
+                    attr.second->getStrAttrValue().c_str());
+
+            /*
+             * Function hasEqualAttribute returns true only when both
+             * attributes are existing and both are equal, so here it
+             * returned false, so it may mean 2 things:
+             *
+             * - attribute doesn't exist in current view, or
+             * - attributes are different
+             *
+             * If we check if attribute also exists in current view and has
+             * CREATE_ONLY flag then attributes are different and we
+             * disqualify this object since new temporary object needs to
+             * pass new different attribute with CREATE_ONLY flag.
+             *
+             * Case when attribute doesn't exist is much more complicated
+             * since it maybe conditional and have default value, we will
+             * do that check when we select best match.
+             */
+
+            /*
+             * Get attribute metadata to see if contains CREATE_ONLY flag.
+             */
+
+            const sai_attr_metadata_t* meta = attr.second->getAttrMetadata();
+
+            if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && currentObj->hasAttr(attrId))
+            {
+                has_different_create_only_attr = true;
+
+                SWSS_LOG_INFO("obj has not equal create only attributes %s",
+                        temporaryObj->m_str_object_id.c_str());
+
+                /*
+                 * In this case there is no need to compare other
+                 * attributes since we won't be able to update them anyway.
+                 */
+
+                break;
+            }
+
+            if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !currentObj->hasAttr(attrId))
+            {
+                /*
+                 * This attribute exists only on temporary view and it's
+                 * create only.  If it has default value, check if it's the
+                 * same as current.
+                 */
+
+                auto curDefault = getSaiAttrFromDefaultValue(m_currentView, m_switch, *meta);
+
+                if (curDefault != nullptr)
+                {
+                    if (curDefault->getStrAttrValue() != attr.second->getStrAttrValue())
+                    {
+                        has_different_create_only_attr = true;
+
+                        SWSS_LOG_INFO("obj has not equal create only attributes %s (default): %s",
+                                temporaryObj->m_str_object_id.c_str(),
+                                meta->attridname);
+                        break;
+                    }
+                    else
+                    {
+                        SWSS_LOG_INFO("obj has equal create only value %s (default): %s",
+                                temporaryObj->m_str_object_id.c_str(),
+                                meta->attridname);
+                    }
+                }
+            }
+        }
+    }
+
+    /*
+     * Before we add this object as candidate, see if there are some create
+     * only attributes which are not present in temporary object but
+     * present in current, and if there is default value that is the same.
+     */
+
+    const auto curAttrs = currentObj->getAllAttributes();
+
+    for (auto curAttr: curAttrs)
+    {
+        if (attrs.find(curAttr.first) != attrs.end())
+        {
+            // attr exists in both objects.
+            continue;
+        }
+
+        const sai_attr_metadata_t* meta = curAttr.second->getAttrMetadata();
+
+        if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !temporaryObj->hasAttr(curAttr.first))
+        {
+            /*
+             * This attribute exists only on current view and it's
+             * create only.  If it has default value, check if it's the
+             * same as current.
+             */
+
+            auto tmpDefault = getSaiAttrFromDefaultValue(m_temporaryView, m_switch, *meta);
+
+            if (tmpDefault != nullptr)
+            {
+                if (tmpDefault->getStrAttrValue() != curAttr.second->getStrAttrValue())
+                {
+                    has_different_create_only_attr = true;
+
+                    SWSS_LOG_INFO("obj has not equal create only attributes %s (default): %s",
+                            currentObj->m_str_object_id.c_str(),
+                            meta->attridname);
+                    break;
+                }
+                else
+                {
+                    SWSS_LOG_INFO("obj has equal create only value %s (default): %s",
+                            temporaryObj->m_str_object_id.c_str(),
+                            meta->attridname);
+                }
+            }
+        }
+    }
+
+    if (has_different_create_only_attr)
+    {
+        /*
+         * Those objects differs with attribute which is marked as
+         * CREATE_ONLY so we will not be able to update current if
+         * necessary using SET operations.
+         */
+
+        return false;
+    }
+
+    SWSS_LOG_INFO("* current obj: %s has equal %lu attributes",
+            currentObj->m_str_object_id.c_str(),
+            soci.equal_attributes);
+
+    return true;
+}
+
+std::vector<BestCandidateFinder::sai_object_compare_info_t> BestCandidateFinder::findCandidateObjects(
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
+        _In_ const std::vector<std::shared_ptr<SaiObj>> &notProcessedObjects) const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_compare_info_t> candidateObjects;
+
+    if (m_workerPool == nullptr || notProcessedObjects.size() < PARALLEL_CANDIDATES_THRESHOLD)
+    {
+        for (const auto &currentObj: notProcessedObjects)
+        {
+            sai_object_compare_info_t soci;
+
+            if (evaluateCandidateObject(temporaryObj, currentObj, soci))
+            {
+                candidateObjects.push_back(soci);
+            }
+        }
+
+        return candidateObjects;
+    }
+
+    /*
+     * Evaluating candidate only reads both views, so current objects can be
+     * split into ranges evaluated on worker threads. Results are merged in
+     * original order, so candidate list is the same as in serial evaluation.
+     */
+
+    size_t count = notProcessedObjects.size();
+
+    size_t ranges = std::min(count, m_workerPool->getThreadCount() * 4);
+
+    std::vector<sai_object_compare_info_t> results(count);
+
+    std::vector<char> qualified(count, 0);
+
+    std::vector<std::future<void>> futures;
+
+    for (size_t range = 0; range < ranges; range++)
+    {
+        size_t begin = count * range / ranges;
+        size_t end = count * (range + 1) / ranges;
+
+        futures.push_back(m_workerPool->submit([&, begin, end]() {
+
+            for (size_t idx = begin; idx < end; idx++)
+            {
+                qualified[idx] = evaluateCandidateObject(temporaryObj, notProcessedObjects[idx], results[idx]);
+            }
+        }));
+    }
+
+    for (auto& f: futures)
+    {
+        f.wait();
+    }
+
+    for (auto& f: futures)
+    {
+        f.get(); // rethrow exception from worker
+    }
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        if (qualified[idx])
+        {
+            candidateObjects.push_back(results[idx]);
+        }
+    }
+
+    return candidateObjects;
+}
+
 bool BestCandidateFinder::compareByEqualAttributes(
         _In_ const sai_object_compare_info_t &a,
         _In_ const sai_object_compare_info_t &b)
@@ -2485,7 +2671,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatch(
          */
 
         SWSS_LOG_INFO("found best match for %s %s since object status is MATCHED",
-                temporaryObj->m_str_object_type.c_str(),
+                temporaryObj->getStrObjectType().c_str(),
                 temporaryObj->m_str_object_id.c_str());
 
         return m_currentView.m_oOids.at(temporaryObj->getVid());
@@ -2530,7 +2716,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatch(
             if (!temporaryObj->isOidObject())
             {
                 SWSS_LOG_THROW("object %s:%s is non object id, not handled yet, FIXME",
-                        temporaryObj->m_str_object_type.c_str(),
+                        temporaryObj->getStrObjectType().c_str(),
                         temporaryObj->m_str_object_id.c_str());
             }
 
@@ -2554,7 +2740,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findSimilarBestMatch(
     const auto attrs = temporaryObj->getAllAttributes();
 
     SWSS_LOG_INFO("not processed objects for %s: %zu, temp attrs: %zu",
-            temporaryObj->m_str_object_type.c_str(),
+            temporaryObj->getStrObjectType().c_str(),
             notProcessedObjects.size(),
             attrs.size());
 
@@ -2701,7 +2887,7 @@ int BestCandidateFinder::findAllChildsInDependencyTreeCount(
             continue;
         }
 
-        SWSS_LOG_DEBUG("looking for %s on %s", obj->m_str_object_type.c_str(), meta->attridname);
+        SWSS_LOG_DEBUG("looking for %s on %s", obj->getStrObjectType().c_str(), meta->attridname);
 
         auto usageObjects = findUsageCount(view, obj, meta->objecttype, meta->attrid);
 
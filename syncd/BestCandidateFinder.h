@@ -3,6 +3,7 @@
 #include "SaiObj.h"
 #include "AsicView.h"
 #include "SaiSwitchInterface.h"
+#include "WorkerPool.h"
 
 #include <memory>
 
@@ -25,7 +26,8 @@ namespace syncd
             BestCandidateFinder(
                     _In_ const AsicView &currentView,
                     _In_ const AsicView &temporaryView,
-                    _In_ std::shared_ptr<const SaiSwitchInterface> sw);
+                    _In_ std::shared_ptr<const SaiSwitchInterface> sw,
+                    _In_ std::shared_ptr<WorkerPool> workerPool = nullptr);
 
 
             virtual ~BestCandidateFinder() = default;
@@ -108,6 +110,21 @@ namespace syncd
                     _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
                     _In_ const std::vector<sai_object_compare_info_t> &candidateObjects);
 
+            /**
+             * @brief Find not processed current object with all attributes
+             * equal to temporary object using attribute signature index.
+             *
+             * Used only when no current object of given type has more
+             * attributes than temporary object, so exact match is then the
+             * only candidate with most equal attributes, and comparing all
+             * candidates would select the same object.
+             *
+             * @return Current object if exactly one such object exists,
+             * otherwise nullptr and all candidates needs to be compared.
+             */
+            std::shared_ptr<SaiObj> findCurrentBestMatchForGenericObjectUsingSignature(
+                    _In_ const std::shared_ptr<const SaiObj> &temporaryObj);
+
             std::shared_ptr<SaiObj> findCurrentBestMatchForGenericObjectUsingHeuristic(
                     _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
                     _In_ const std::vector<sai_object_compare_info_t> &candidateObjects);
@@ -132,6 +149,31 @@ namespace syncd
             std::shared_ptr<SaiObj> findCurrentBestMatchForInsegEntry(
                     _In_ const std::shared_ptr<const SaiObj> &temporaryObj);
 
+        private:
+
+            /**
+             * @brief Minimal number of not processed objects for which
+             * candidates are evaluated on worker pool.
+             */
+            static constexpr size_t PARALLEL_CANDIDATES_THRESHOLD = 256;
+
+            /**
+             * @brief Evaluate current object as candidate for temporary object.
+             *
+             * Only reads both views, so it's safe to call concurrently.
+             *
+             * @return False if current object can't be candidate because of
+             * different create only attributes.
+             */
+            bool evaluateCandidateObject(
+                    _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
+                    _In_ const std::shared_ptr<SaiObj> &currentObj,
+                    _Out_ sai_object_compare_info_t &soci) const;
+
+            std::vector<sai_object_compare_info_t> findCandidateObjects(
+                    _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
+                    _In_ const std::vector<std::shared_ptr<SaiObj>> &notProcessedObjects) const;
+
         private:
 
             bool exchangeTemporaryVidToCurrentVid(
@@ -139,6 +181,9 @@ namespace syncd
 
         private:
 
+            static bool hasSpecialCandidateSelection(
+                    _In_ sai_object_type_t objectType);
+
             static bool compareByEqualAttributes(
                     _In_ const sai_object_compare_info_t &a,
                     _In_ const sai_object_compare_info_t &b);
@@ -193,6 +238,8 @@ namespace syncd
 
             std::shared_ptr<const SaiSwitchInterface> m_switch;
 
+            std::shared_ptr<WorkerPool> m_workerPool;
+
             std::shared_ptr<const SaiObj> m_temporaryObj;
 
             std::vector<sai_object_compare_info_t> m_candidateObjects;
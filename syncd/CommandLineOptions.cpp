@@ -47,6 +47,26 @@ CommandLineOptions::CommandLineOptions()
     m_supportingBulkCounterGroups = "";
 
     m_enableAttrVersionCheck = false;
+
+    m_requestPipelineDepth = 0;
+
+    m_bulkCoalesceLimit = 0;
+
+    m_notificationRingCapacity = 0;
+
+    m_enableFdbCoalescing = false;
+
+    m_redisWriteBehindBatchSize = 0;
+
+    m_counterPollWorkers = 0;
+
+    m_applyViewWorkers = 0;
+
+    m_enableBatchedDiscovery = false;
+
+    m_enableDiscoveryCache = false;
+
+    m_enableIdenticalEntryFilter = false;
 }
 
 std::string CommandLineOptions::getCommandLineString() const
@@ -71,6 +91,16 @@ std::string CommandLineOptions::getCommandLineString() const
     ss << " WatchdogWarnTimeSpan=" << m_watchdogWarnTimeSpan;
     ss << " SupportingBulkCounters=" << m_supportingBulkCounterGroups;
     ss << " EnableAttrVersionCheck=" << (m_enableAttrVersionCheck ? "YES" : "NO");
+    ss << " RequestPipelineDepth=" << m_requestPipelineDepth;
+    ss << " BulkCoalesceLimit=" << m_bulkCoalesceLimit;
+    ss << " NotificationRingCapacity=" << m_notificationRingCapacity;
+    ss << " EnableFdbCoalescing=" << (m_enableFdbCoalescing ? "YES" : "NO");
+    ss << " RedisWriteBehindBatchSize=" << m_redisWriteBehindBatchSize;
+    ss << " CounterPollWorkers=" << m_counterPollWorkers;
+    ss << " ApplyViewWorkers=" << m_applyViewWorkers;
+    ss << " EnableBatchedDiscovery=" << (m_enableBatchedDiscovery ? "YES" : "NO");
+    ss << " EnableDiscoveryCache=" << (m_enableDiscoveryCache ? "YES" : "NO");
+    ss << " EnableIdenticalEntryFilter=" << (m_enableIdenticalEntryFilter ? "YES" : "NO");
 
 #ifdef SAITHRIFT
 
@@ -101,5 +101,68 @@ namespace syncd
             std::string m_supportingBulkCounterGroups;
 
             bool m_enableAttrVersionCheck;
+
+            /**
+             * Number of ASIC requests that can wait for execution in request
+             * pipeline, zero disables pipeline and all requests are processed
+             * serially.
+             */
+            uint32_t m_requestPipelineDepth;
+
+            /**
+             * Maximum number of consecutive single create/remove non object id
+             * entries which will be coalesced into one vendor bulk call, zero
+             * disables coalescing. Requires SAI bulk support to be enabled.
+             */
+            uint32_t m_bulkCoalesceLimit;
+
+            /**
+             * Number of preallocated slots in lock-free notification ring,
+             * zero selects mutex guarded notification queue.
+             */
+            uint32_t m_notificationRingCapacity;
+
+            /**
+             * When enabled, FDB notification waiting in notification queue
+             * is replaced by newer notification for the same FDB entry.
+             */
+            bool m_enableFdbCoalescing;
+
+            /**
+             * Maximum number of ASIC view changes buffered in redis pipeline
+             * in synchronous mode, zero disables write-behind.
+             */
+            uint32_t m_redisWriteBehindBatchSize;
+
+            /**
+             * Number of worker threads collecting flex counter contexts
+             * concurrently, zero collects contexts serially on each flex
+             * counter thread.
+             */
+            uint32_t m_counterPollWorkers;
+
+            /**
+             * Number of worker threads evaluating best match candidates
+             * during apply view, zero evaluates candidates serially.
+             */
+            uint32_t m_applyViewWorkers;
+
+            /**
+             * When enabled, SAI discovery queries all OID attributes of an
+             * object in single get and objects of the same type in bulk get.
+             */
+            bool m_enableBatchedDiscovery;
+
+            /**
+             * When enabled, discovered objects are saved on warm shutdown and
+             * used on warm boot instead of performing discovery.
+             */
+            bool m_enableDiscoveryCache;
+
+            /**
+             * When enabled, apply view pairs identical non object id entries
+             * of current and temporary view before comparison logic.
+             */
+            bool m_enableIdenticalEntryFilter;
     };
 }
@@ -19,9 +19,9 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
     auto options = std::make_shared<CommandLineOptions>();
 
 #ifdef SAITHRIFT
-    const char* const optstring = "dp:t:g:x:b:B:aw:uSUCsz:lrm:h";
+    const char* const optstring = "dp:t:g:x:b:B:aw:uSUCsz:lP:c:R:FW:k:j:DeIrm:h";
 #else
-    const char* const optstring = "dp:t:g:x:b:B:aw:uSUCsz:lh";
+    const char* const optstring = "dp:t:g:x:b:B:aw:uSUCsz:lP:c:R:FW:k:j:DeIh";
 #endif // SAITHRIFT
 
     while (true)
@@ -44,6 +44,16 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
             { "watchdogWarnTimeSpan",    optional_argument, 0, 'w' },
             { "supportingBulkCounters",  required_argument, 0, 'B' },
             { "enableAttrVersionCheck",  no_argument,       0, 'a' },
+            { "requestPipelineDepth",    required_argument, 0, 'P' },
+            { "bulkCoalesceLimit",       required_argument, 0, 'c' },
+            { "notificationRing",        required_argument, 0, 'R' },
+            { "enableFdbCoalescing",     no_argument,       0, 'F' },
+            { "redisWriteBehind",        required_argument, 0, 'W' },
+            { "counterPollWorkers",      required_argument, 0, 'k' },
+            { "applyViewWorkers",        required_argument, 0, 'j' },
+            { "enableBatchedDiscovery",  no_argument,       0, 'D' },
+            { "enableDiscoveryCache",    no_argument,       0, 'e' },
+            { "enableIdenticalEntryFilter", no_argument,    0, 'I' },
 #ifdef SAITHRIFT
             { "rpcserver",               no_argument,       0, 'r' },
             { "portmap",                 required_argument, 0, 'm' },
@@ -143,6 +153,46 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
                 options->m_enableAttrVersionCheck = true;
                 break;
 
+            case 'P':
+                options->m_requestPipelineDepth = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'c':
+                options->m_bulkCoalesceLimit = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'R':
+                options->m_notificationRingCapacity = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'F':
+                options->m_enableFdbCoalescing = true;
+                break;
+
+            case 'W':
+                options->m_redisWriteBehindBatchSize = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'k':
+                options->m_counterPollWorkers = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'j':
+                options->m_applyViewWorkers = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'D':
+                options->m_enableBatchedDiscovery = true;
+                break;
+
+            case 'e':
+                options->m_enableDiscoveryCache = true;
+                break;
+
+            case 'I':
+                options->m_enableIdenticalEntryFilter = true;
+                break;
+
             case 'h':
                 printUsage();
                 exit(EXIT_SUCCESS);
@@ -166,9 +216,9 @@ void CommandLineOptionsParser::printUsage()
     SWSS_LOG_ENTER();
 
 #ifdef SAITHRIFT
-    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-r] [-m portmap] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-P depth] [-c limit] [-R capacity] [-F] [-W size] [-k workers] [-j workers] [-D] [-e] [-I] [-r] [-m portmap] [-h]" << std::endl;
 #else
-    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-P depth] [-c limit] [-R capacity] [-F] [-W size] [-k workers] [-j workers] [-D] [-e] [-I] [-h]" << std::endl;
 #endif // SAITHRIFT
 
     std::cout << "    -d --diag" << std::endl;
@@ -203,6 +253,26 @@ void CommandLineOptionsParser::printUsage()
     std::cout << "        Counter groups those support bulk polling" << std::endl;
     std::cout << "    -a --enableAttrVersionCheck" << std::endl;
     std::cout << "        Enable attribute SAI version check when performing SAI discovery" << std::endl;
+    std::cout << "    -P --requestPipelineDepth depth" << std::endl;
+    std::cout << "        Enable staged ASIC request pipeline with given depth, default: 0 (disabled)" << std::endl;
+    std::cout << "    -c --bulkCoalesceLimit limit" << std::endl;
+    std::cout << "        Coalesce consecutive create/remove entries into bulk calls (requires -l), default: 0 (disabled)" << std::endl;
+    std::cout << "    -R --notificationRing capacity" << std::endl;
+    std::cout << "        Use lock-free notification ring with given capacity, default: 0 (mutex queue)" << std::endl;
+    std::cout << "    -F --enableFdbCoalescing" << std::endl;
+    std::cout << "        Replace queued FDB notification with newer one for the same FDB entry" << std::endl;
+    std::cout << "    -W --redisWriteBehind size" << std::endl;
+    std::cout << "        Buffer up to size ASIC view changes in redis pipeline in sync mode, default: 0 (disabled)" << std::endl;
+    std::cout << "    -k --counterPollWorkers workers" << std::endl;
+    std::cout << "        Collect flex counter contexts concurrently on given number of threads, default: 0 (serial)" << std::endl;
+    std::cout << "    -j --applyViewWorkers workers" << std::endl;
+    std::cout << "        Evaluate apply view best match candidates on given number of threads, default: 0 (serial)" << std::endl;
+    std::cout << "    -D --enableBatchedDiscovery" << std::endl;
+    std::cout << "        Use multi attribute and bulk get when performing SAI discovery" << std::endl;
+    std::cout << "    -e --enableDiscoveryCache" << std::endl;
+    std::cout << "        Save discovered objects on warm shutdown and use them on warm boot instead of SAI discovery" << std::endl;
+    std::cout << "    -I --enableIdenticalEntryFilter" << std::endl;
+    std::cout << "        Pair identical route, neighbor, FDB and inseg entries before apply view comparison logic" << std::endl;
 
 #ifdef SAITHRIFT
 
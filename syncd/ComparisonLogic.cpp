@@ -13,6 +13,8 @@
 
 #include <inttypes.h>
 
+#include <chrono>
+
 using namespace syncd;
 using namespace saimeta;
 
@@ -29,14 +31,16 @@ ComparisonLogic::ComparisonLogic(
         _In_ std::set<sai_object_id_t> initViewRemovedVids,
         _In_ std::shared_ptr<AsicView> current,
         _In_ std::shared_ptr<AsicView> temp,
-        _In_ std::shared_ptr<BreakConfig> breakConfig):
+        _In_ std::shared_ptr<BreakConfig> breakConfig,
+        _In_ std::shared_ptr<WorkerPool> workerPool):
     m_vendorSai(vendorSai),
     m_switch(sw),
     m_initViewRemovedVids(initViewRemovedVids),
     m_current(current),
     m_temp(temp),
     m_handler(handler),
-    m_breakConfig(breakConfig)
+    m_breakConfig(breakConfig),
+    m_workerPool(workerPool)
 {
     SWSS_LOG_ENTER();
 
@@ -118,10 +122,21 @@ void ComparisonLogic::compareViews()
 
     createPreMatchMap(current, temp);
 
+    current.releasePreMatchIndexes();
+    temp.releasePreMatchIndexes();
+
+    current.buildAttributeSignatureIndex();
+
     logViewObjectCount(current, temp);
 
+    m_bestMatchTimes.clear();
+
     applyViewTransition(current, temp);
 
+    current.releaseAttributeSignatureIndex();
+
+    logBestMatchTimes();
+
     transferNotProcessed(current, temp);
 
     // TODO have a method to check for not processed objects
@@ -217,7 +232,7 @@ void ComparisonLogic::matchOids(
         currentIt->second->setObjectStatus(SAI_OBJECT_STATUS_MATCHED);
 
         SWSS_LOG_INFO("matched %s RID %s VID %s",
-                currentIt->second->m_str_object_type.c_str(),
+                currentIt->second->getStrObjectType().c_str(),
                 sai_serialize_object_id(rid).c_str(),
                 sai_serialize_object_id(vid).c_str());
 
@@ -247,7 +262,7 @@ void ComparisonLogic::matchOids(
                     // No, since OA still hold's the reference to that VID and may use it later.
                     SWSS_LOG_INFO("matched %s VID %s was not in cold boot, possible only GET?",
                             sai_serialize_object_id(vid).c_str(),
-                            currentIt->second->m_str_object_type.c_str());
+                            currentIt->second->getStrObjectType().c_str());
                     break;
             }
         }
@@ -377,7 +392,7 @@ void ComparisonLogic::procesObjectAttributesForViewTransition(
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_INFO("%s %s", temporaryObj->m_str_object_type.c_str(), temporaryObj->m_str_object_id.c_str());
+    SWSS_LOG_INFO("%s %s", temporaryObj->getStrObjectType().c_str(), temporaryObj->m_str_object_id.c_str());
 
     /*
      * First we need to make sure if all attributes of this temporary object
@@ -441,7 +456,7 @@ void ComparisonLogic::procesObjectAttributesForViewTransition(
         sai_object_id_t vid = m->getoid(&temporaryObj->m_meta_key);
 
         SWSS_LOG_INFO("- processing %s (%s) VID %s",
-                temporaryObj->m_str_object_type.c_str(),
+                temporaryObj->getStrObjectType().c_str(),
                 m->membername,
                 sai_serialize_object_id(vid).c_str());
 
@@ -571,7 +586,7 @@ void ComparisonLogic::removeExistingObjectFromCurrentView(
              */
 
             SWSS_LOG_THROW("can't remove existing object %s:%s since reference count is %d, FIXME",
-                    currentObj->m_str_object_type.c_str(),
+                    currentObj->getStrObjectType().c_str(),
                     currentObj->m_str_object_id.c_str(),
                     count);
         }
@@ -847,7 +862,7 @@ void ComparisonLogic::setAttributeOnCurrentObject(
     {
         SWSS_LOG_THROW("can't set attribute %s on current object %s:%s since it's not CREATE_AND_SET",
                 meta->attridname,
-                currentObj->m_str_object_type.c_str(),
+                currentObj->getStrObjectType().c_str(),
                 currentObj->m_str_object_id.c_str());
     }
 
@@ -893,7 +908,7 @@ void ComparisonLogic::createNewObjectFromTemporaryObject(
     SWSS_LOG_ENTER();
 
     SWSS_LOG_INFO("creating object %s:%s",
-                    temporaryObj->m_str_object_type.c_str(),
+                    temporaryObj->getStrObjectType().c_str(),
                     temporaryObj->m_str_object_id.c_str());
 
     /*
@@ -945,7 +960,6 @@ void ComparisonLogic::createNewObjectFromTemporaryObject(
      * TODO Find out better way to do this, copy operator ?
      */
 
-    currentObj->m_str_object_type  = temporaryObj->m_str_object_type;
     currentObj->m_str_object_id    = temporaryObj->m_str_object_id;      // temporary VID / non object id
     currentObj->m_meta_key         = temporaryObj->m_meta_key;           // temporary VID / non object id
     currentObj->m_info             = temporaryObj->m_info;
@@ -1804,7 +1818,7 @@ void ComparisonLogic::processObjectForViewTransition(
         return;
     }
 
-    SWSS_LOG_INFO("processing: %s:%s", temporaryObj->m_str_object_type.c_str(), temporaryObj->m_str_object_id.c_str());
+    SWSS_LOG_INFO("processing: %s:%s", temporaryObj->getStrObjectType().c_str(), temporaryObj->m_str_object_id.c_str());
 
     procesObjectAttributesForViewTransition(currentView, temporaryView, temporaryObj);
 
@@ -1813,10 +1827,19 @@ void ComparisonLogic::processObjectForViewTransition(
      * can try to find current best match.
      */
 
-    auto bcf = std::make_shared<BestCandidateFinder>(currentView, temporaryView, m_switch);
+    auto bcf = std::make_shared<BestCandidateFinder>(currentView, temporaryView, m_switch, m_workerPool);
+
+    auto start = std::chrono::steady_clock::now();
 
     std::shared_ptr<SaiObj> currentBestMatch = bcf->findCurrentBestMatch(temporaryObj);
 
+    auto usec = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    auto& times = m_bestMatchTimes[temporaryObj->getObjectType()];
+
+    times.first++;
+    times.second += (uint64_t)usec;
+
     /*
      * So there will be interesting problem, when we don't find best matching
      * object, but actual object will exist, and it will have the same KEY
@@ -1872,7 +1895,7 @@ void ComparisonLogic::processObjectForViewTransition(
          */
 
         SWSS_LOG_INFO("failed to find best match %s %s in current view, will create new object",
-                temporaryObj->m_str_object_type.c_str(),
+                temporaryObj->getStrObjectType().c_str(),
                 temporaryObj->m_str_object_id.c_str());
 
         /*
@@ -1888,7 +1911,7 @@ void ComparisonLogic::processObjectForViewTransition(
     }
 
     SWSS_LOG_INFO("found best match %s: current: %s temporary: %s",
-            currentBestMatch->m_str_object_type.c_str(),
+            currentBestMatch->getStrObjectType().c_str(),
             currentBestMatch->m_str_object_id.c_str(),
             temporaryObj->m_str_object_id.c_str());
 
@@ -1970,7 +1993,7 @@ void ComparisonLogic::processObjectForViewTransition(
         // created on execute asic and RID will be saved to maps in both views.
 
         SWSS_LOG_INFO("found best match, but set failed: %s: current: %s temporary: %s",
-                currentBestMatch->m_str_object_type.c_str(),
+                currentBestMatch->getStrObjectType().c_str(),
                 currentBestMatch->m_str_object_id.c_str(),
                 temporaryObj->m_str_object_id.c_str());
 
@@ -2193,7 +2216,7 @@ void ComparisonLogic::breakBeforeMake(
         // since maybe only one read only attribute has been changed, and this
         // will automatically result in null best match
 
-        auto bcf = std::make_shared<BestCandidateFinder>(currentView, temporaryView, m_switch);
+        auto bcf = std::make_shared<BestCandidateFinder>(currentView, temporaryView, m_switch, m_workerPool);
 
         std::shared_ptr<SaiObj> similarBestMatch = bcf->findSimilarBestMatch(temporaryObj);
 
@@ -2935,8 +2958,8 @@ void ComparisonLogic::createPreMatchMap(
         if (it->second.size() != 1)
             continue;
 
-        auto& tObj = tmp.m_soAll.at(pk.second.at(0));
-        auto& cObj = cur.m_soAll.at(it->second.at(0));
+        auto& tObj = pk.second.at(0);
+        auto& cObj = it->second.at(0);
 
         createPreMatchMapForObject(cur, tmp, cObj, tObj, processed);
     }
@@ -2958,8 +2981,8 @@ void ComparisonLogic::createPreMatchMap(
         if (it->second.size() != 1)
             continue;
 
-        auto& tObj = tmp.m_soAll.at(pk.second.at(0));
-        auto& cObj = cur.m_soAll.at(it->second.at(0));
+        auto& tObj = pk.second.at(0);
+        auto& cObj = it->second.at(0);
 
         createPreMatchMapForObject(cur, tmp, cObj, tObj, processed);
 
@@ -3051,7 +3074,7 @@ void ComparisonLogic::transferNotProcessed(
             temp.m_oOids.at(vid)->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
 
             SWSS_LOG_WARN("moved %s VID %s RID %s to temporary view, and marked FINAL",
-                    obj->m_str_object_type.c_str(),
+                    obj->getStrObjectType().c_str(),
                     obj->m_str_object_id.c_str(),
                     sai_serialize_object_id(rid).c_str());
 
@@ -3122,7 +3145,7 @@ void ComparisonLogic::applyViewTransition(
             }
 
             SWSS_LOG_INFO("processing explicit pre match: %s:%s",
-                    obj.second->m_str_object_type.c_str(),
+                    obj.second->getStrObjectType().c_str(),
                     obj.second->m_str_object_id.c_str());
 
             processObjectForViewTransition(current, temp, obj.second);
@@ -3322,6 +3345,19 @@ void ComparisonLogic::logViewObjectCount(
     }
 }
 
+void ComparisonLogic::logBestMatchTimes() const
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& kvp: m_bestMatchTimes)
+    {
+        SWSS_LOG_NOTICE("best match for %zu objects of %s took %" PRIu64 " us",
+                kvp.second.first,
+                sai_serialize_object_type(kvp.first).c_str(),
+                kvp.second.second);
+    }
+}
+
 /*
  * Below we will duplicate asic execution logic for asic operations.
  *
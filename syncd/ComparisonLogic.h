@@ -10,8 +10,10 @@ extern "C"{
 #include "VirtualOidTranslator.h"
 #include "NotificationHandler.h"
 #include "BreakConfig.h"
+#include "WorkerPool.h"
 
 #include <set>
+#include <map>
 
 namespace syncd
 {
@@ -26,7 +28,8 @@ namespace syncd
                 _In_ std::set<sai_object_id_t> initViewRemovedVids,
                 _In_ std::shared_ptr<AsicView> current,
                 _In_ std::shared_ptr<AsicView> temp,
-                _In_ std::shared_ptr<BreakConfig> breakConfig);
+                _In_ std::shared_ptr<BreakConfig> breakConfig,
+                _In_ std::shared_ptr<WorkerPool> workerPool = nullptr);
 
             virtual ~ComparisonLogic();;
 
@@ -74,6 +77,8 @@ namespace syncd
                     _In_ const AsicView& cur,
                     _In_ const AsicView& tmp) const;
 
+            void logBestMatchTimes() const;
+
         private:
 
             void checkMap(
@@ -254,5 +259,17 @@ namespace syncd
             std::shared_ptr<NotificationHandler> m_handler;
 
             std::shared_ptr<BreakConfig> m_breakConfig;
+
+            /**
+             * @brief Worker pool used to evaluate best match candidates,
+             * when nullptr candidates are evaluated serially.
+             */
+            std::shared_ptr<WorkerPool> m_workerPool;
+
+            /**
+             * @brief Number of best match searches and total time in
+             * microseconds spent on them per object type.
+             */
+            std::map<sai_object_type_t, std::pair<size_t, uint64_t>> m_bestMatchTimes;
     };
 }
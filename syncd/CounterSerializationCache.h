@@ -0,0 +1,220 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "meta/sai_serialize.h"
+
+#include "swss/table.h"
+#include "swss/logger.h"
+#include "swss/sal.h"
+
+#include <string>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Serialize counter value into existing string.
+     *
+     * String capacity is reused, so no memory is allocated when string
+     * already has capacity for serialized value.
+     */
+    inline void serializeCounterValue(
+            _In_ uint64_t value,
+            _Inout_ std::string& str)
+    {
+        SWSS_LOG_ENTER();
+
+        char buffer[24];
+
+        char* end = buffer + sizeof(buffer);
+        char* ptr = end;
+
+        do
+        {
+            *--ptr = (char)('0' + (value % 10));
+
+            value /= 10;
+        }
+        while (value);
+
+        str.assign(ptr, end - ptr);
+    }
+
+    /**
+     * @brief Cache of serialized counter names and object keys.
+     *
+     * Names and keys are serialized only when counter ids or objects
+     * change, and counter values are serialized into reusable field value
+     * vector, so periodic polling is not allocating memory after first
+     * poll.
+     */
+    class CounterSerializationCache
+    {
+        public:
+
+            CounterSerializationCache() = default;
+
+            virtual ~CounterSerializationCache() = default;
+
+        public:
+
+            /**
+             * @brief Update cache if counter ids or object vids changed.
+             *
+             * @return True if cache was rebuilt.
+             */
+            template <typename StatType, typename Serializer>
+            bool update(
+                    _In_ const std::vector<StatType>& counterIds,
+                    _In_ const std::vector<sai_object_id_t>& objectVids,
+                    _In_ Serializer serializer)
+            {
+                SWSS_LOG_ENTER();
+
+                bool rebuilt = false;
+
+                if (!sameCounterIds(counterIds))
+                {
+                    m_counterIds.assign(counterIds.begin(), counterIds.end());
+
+                    m_values.clear();
+
+                    for (auto id: counterIds)
+                    {
+                        m_values.emplace_back(serializer(id), std::string());
+                    }
+
+                    rebuilt = true;
+                }
+
+                if (objectVids != m_objectVids)
+                {
+                    m_objectVids = objectVids;
+
+                    m_objectKeys.clear();
+
+                    for (auto vid: objectVids)
+                    {
+                        m_objectKeys.push_back(sai_serialize_object_id(vid));
+                    }
+
+                    rebuilt = true;
+                }
+
+                return rebuilt;
+            }
+
+            const std::string& getObjectKey(
+                    _In_ size_t index) const
+            {
+                SWSS_LOG_ENTER();
+
+                return m_objectKeys.at(index);
+            }
+
+            /**
+             * @brief Serialize values of single object.
+             *
+             * @param counters Values in the same order as cached counter ids.
+             *
+             * @return Field values valid until next call.
+             */
+            const std::vector<swss::FieldValueTuple>& serializeValues(
+                    _In_ const uint64_t* counters)
+            {
+                SWSS_LOG_ENTER();
+
+                for (size_t idx = 0; idx < m_values.size(); idx++)
+                {
+                    serializeCounterValue(counters[idx], fvValue(m_values[idx]));
+                }
+
+                return m_values;
+            }
+
+            /**
+             * @brief Serialize only values of single object which changed
+             * since last publish.
+             *
+             * @param counters Values in the same order as cached counter ids.
+             * @param published Last published values, updated with current
+             * values.
+             * @param all Serialize all values regardless of published values.
+             *
+             * @return Field values of changed counters valid until next call.
+             */
+            const std::vector<swss::FieldValueTuple>& serializeChangedValues(
+                    _In_ const uint64_t* counters,
+                    _Inout_ uint64_t* published,
+                    _In_ bool all)
+            {
+                SWSS_LOG_ENTER();
+
+                size_t changed = 0;
+
+                for (size_t idx = 0; idx < m_values.size(); idx++)
+                {
+                    if (!all && counters[idx] == published[idx])
+                    {
+                        continue;
+                    }
+
+                    published[idx] = counters[idx];
+
+                    if (changed == m_changedValues.size())
+                    {
+                        m_changedValues.emplace_back();
+                    }
+
+                    fvField(m_changedValues[changed]) = fvField(m_values[idx]);
+
+                    serializeCounterValue(counters[idx], fvValue(m_changedValues[changed]));
+
+                    changed++;
+                }
+
+                m_changedValues.resize(changed);
+
+                return m_changedValues;
+            }
+
+        private:
+
+            template <typename StatType>
+            bool sameCounterIds(
+                    _In_ const std::vector<StatType>& counterIds) const
+            {
+                SWSS_LOG_ENTER();
+
+                if (counterIds.size() != m_counterIds.size())
+                {
+                    return false;
+                }
+
+                for (size_t idx = 0; idx < counterIds.size(); idx++)
+                {
+                    if ((int32_t)counterIds[idx] != m_counterIds[idx])
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+        private:
+
+            std::vector<int32_t> m_counterIds;
+
+            std::vector<sai_object_id_t> m_objectVids;
+
+            std::vector<std::string> m_objectKeys;
+
+            std::vector<swss::FieldValueTuple> m_values;
+
+            std::vector<swss::FieldValueTuple> m_changedValues;
+    };
+}
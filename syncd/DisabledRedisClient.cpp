@@ -107,6 +107,27 @@ std::set<sai_object_id_t> DisabledRedisClient::getColdVids(
     return {};
 }
 
+void DisabledRedisClient::saveDiscoveryCache(
+        _In_ sai_object_id_t switchVid,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+}
+
+std::unordered_map<std::string, std::string> DisabledRedisClient::getDiscoveryCache(
+        _In_ sai_object_id_t switchVid)
+{
+    SWSS_LOG_ENTER();
+
+    return {};
+}
+
+void DisabledRedisClient::removeDiscoveryCache(
+        _In_ sai_object_id_t switchVid)
+{
+    SWSS_LOG_ENTER();
+}
+
 void DisabledRedisClient::setPortLanes(
         _In_ sai_object_id_t switchVid,
         _In_ sai_object_id_t portRid,
@@ -329,3 +350,12 @@ void DisabledRedisClient::processFlushEvent(
     SWSS_LOG_ENTER();
 }
 
+void DisabledRedisClient::flush()
+{
+    SWSS_LOG_ENTER();
+}
+
+void DisabledRedisClient::flushExpired()
+{
+    SWSS_LOG_ENTER();
+}
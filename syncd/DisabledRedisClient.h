@@ -58,6 +58,16 @@ namespace syncd
             virtual std::set<sai_object_id_t> getColdVids(
                     _In_ sai_object_id_t switchVid) override;
 
+            virtual void saveDiscoveryCache(
+                    _In_ sai_object_id_t switchVid,
+                    _In_ const std::vector<swss::FieldValueTuple>& values) override;
+
+            virtual std::unordered_map<std::string, std::string> getDiscoveryCache(
+                    _In_ sai_object_id_t switchVid) override;
+
+            virtual void removeDiscoveryCache(
+                    _In_ sai_object_id_t switchVid) override;
+
             virtual void setPortLanes(
                     _In_ sai_object_id_t switchVid,
                     _In_ sai_object_id_t portRid,
@@ -161,6 +171,10 @@ namespace syncd
                     _In_ sai_object_id_t portVid,
                     _In_ sai_object_id_t bvId,
                     _In_ sai_fdb_flush_entry_type_t type) override;
+
+            virtual void flush() override;
+
+            virtual void flushExpired() override;
     };
 }
 
@@ -0,0 +1,338 @@
+#include "DiscoveryCache.h"
+
+#include "swss/logger.h"
+#include "swss/tokenize.h"
+
+#include "meta/sai_serialize.h"
+
+#include <algorithm>
+
+#include <string.h>
+
+using namespace syncd;
+
+/**
+ * @def DISCOVERY_CACHE_VERSION
+ *
+ * Version of serialized snapshot, needs to be bumped every time serialization
+ * format changes.
+ */
+#define DISCOVERY_CACHE_VERSION "1"
+
+/**
+ * @def DISCOVERY_CACHE_SPOT_CHECKS
+ *
+ * Number of snapshot objects which existence is checked on the switch.
+ */
+#define DISCOVERY_CACHE_SPOT_CHECKS 64
+
+/**
+ * @def DISCOVERY_CACHE_MAX_PORTS
+ *
+ * Maximum number of ports obtained from the switch when validating snapshot.
+ */
+#define DISCOVERY_CACHE_MAX_PORTS 1024
+
+#define FIELD_VERSION           "VERSION"
+#define FIELD_HARDWARE_INFO     "HARDWARE_INFO"
+#define FIELD_SAI_API_VERSION   "SAI_API_VERSION"
+#define FIELD_SWITCH_RID        "SWITCH_RID"
+
+#define OID_PREFIX "oid:"
+
+DiscoveryCache::DiscoveryCache(
+        _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
+        _In_ sai_object_id_t switchRid,
+        _In_ const std::string& hardwareInfo):
+    m_vendorSai(vendorSai),
+    m_switchRid(switchRid),
+    m_hardwareInfo(hardwareInfo)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+DiscoveryCache::~DiscoveryCache()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+std::string DiscoveryCache::getApiVersion() const
+{
+    SWSS_LOG_ENTER();
+
+    sai_api_version_t version = SAI_VERSION(0,0,0);
+
+    sai_status_t status = m_vendorSai->queryApiVersion(&version);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_WARN("failed to obtain libsai api version: %s",
+                sai_serialize_status(status).c_str());
+    }
+
+    return std::to_string(version);
+}
+
+std::vector<swss::FieldValueTuple> DiscoveryCache::serialize(
+        _In_ const std::set<sai_object_id_t>& rids,
+        _In_ const SaiDiscovery::DefaultOidMap& defaultOidMap) const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back(FIELD_VERSION, DISCOVERY_CACHE_VERSION);
+    values.emplace_back(FIELD_HARDWARE_INFO, m_hardwareInfo);
+    values.emplace_back(FIELD_SAI_API_VERSION, getApiVersion());
+    values.emplace_back(FIELD_SWITCH_RID, sai_serialize_object_id(m_switchRid));
+
+    /*
+     * Each RID is separate field, value contains default OID map entries of
+     * that RID: "attrid=oid:0x0,attrid=oid:0x1" or "NULL" when empty.
+     */
+
+    for (auto rid: rids)
+    {
+        std::string value;
+
+        auto it = defaultOidMap.find(rid);
+
+        if (it != defaultOidMap.end())
+        {
+            for (auto& kvp: it->second)
+            {
+                if (value.size())
+                {
+                    value += ",";
+                }
+
+                value += std::to_string(kvp.first) + "=" + sai_serialize_object_id(kvp.second);
+            }
+        }
+
+        values.emplace_back(sai_serialize_object_id(rid), value.size() ? value : "NULL");
+    }
+
+    return values;
+}
+
+bool DiscoveryCache::checkField(
+        _In_ const std::unordered_map<std::string, std::string>& hash,
+        _In_ const std::string& field,
+        _In_ const std::string& expected) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = hash.find(field);
+
+    if (it == hash.end())
+    {
+        SWSS_LOG_NOTICE("discovery cache is missing %s", field.c_str());
+
+        return false;
+    }
+
+    if (it->second != expected)
+    {
+        SWSS_LOG_NOTICE("discovery cache %s '%s' differs from current '%s'",
+                field.c_str(),
+                it->second.c_str(),
+                expected.c_str());
+
+        return false;
+    }
+
+    return true;
+}
+
+bool DiscoveryCache::deserialize(
+        _In_ const std::unordered_map<std::string, std::string>& hash,
+        _Out_ std::set<sai_object_id_t>& rids,
+        _Out_ SaiDiscovery::DefaultOidMap& defaultOidMap) const
+{
+    SWSS_LOG_ENTER();
+
+    rids.clear();
+
+    defaultOidMap.clear();
+
+    if (hash.empty())
+    {
+        SWSS_LOG_NOTICE("discovery cache is empty");
+
+        return false;
+    }
+
+    if (!checkField(hash, FIELD_VERSION, DISCOVERY_CACHE_VERSION) ||
+            !checkField(hash, FIELD_HARDWARE_INFO, m_hardwareInfo) ||
+            !checkField(hash, FIELD_SAI_API_VERSION, getApiVersion()) ||
+            !checkField(hash, FIELD_SWITCH_RID, sai_serialize_object_id(m_switchRid)))
+    {
+        return false;
+    }
+
+    try
+    {
+        for (auto& kvp: hash)
+        {
+            if (kvp.first.compare(0, strlen(OID_PREFIX), OID_PREFIX) != 0)
+            {
+                continue; // header field
+            }
+
+            sai_object_id_t rid;
+
+            sai_deserialize_object_id(kvp.first, rid);
+
+            rids.insert(rid);
+
+            if (kvp.second == "NULL")
+            {
+                continue;
+            }
+
+            for (auto& entry: swss::tokenize(kvp.second, ','))
+            {
+                auto pos = entry.find('=');
+
+                if (pos == std::string::npos)
+                {
+                    SWSS_LOG_THROW("invalid default oid entry '%s'", entry.c_str());
+                }
+
+                sai_object_id_t oid;
+
+                sai_deserialize_object_id(entry.substr(pos + 1), oid);
+
+                defaultOidMap[rid][(sai_attr_id_t)std::stoul(entry.substr(0, pos))] = oid;
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_WARN("failed to deserialize discovery cache: %s", e.what());
+
+        rids.clear();
+
+        defaultOidMap.clear();
+
+        return false;
+    }
+
+    if (!validate(rids, defaultOidMap))
+    {
+        rids.clear();
+
+        defaultOidMap.clear();
+
+        return false;
+    }
+
+    return true;
+}
+
+bool DiscoveryCache::validate(
+        _In_ const std::set<sai_object_id_t>& rids,
+        _In_ const SaiDiscovery::DefaultOidMap& defaultOidMap) const
+{
+    SWSS_LOG_ENTER();
+
+    if (rids.find(m_switchRid) == rids.end())
+    {
+        SWSS_LOG_NOTICE("switch RID %s missing from discovery cache",
+                sai_serialize_object_id(m_switchRid).c_str());
+
+        return false;
+    }
+
+    // read only attributes like default virtual router or CPU port can't change
+
+    auto it = defaultOidMap.find(m_switchRid);
+
+    if (it != defaultOidMap.end())
+    {
+        for (auto& kvp: it->second)
+        {
+            auto md = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_SWITCH, kvp.first);
+
+            if (md == NULL || !SAI_HAS_FLAG_READ_ONLY(md->flags))
+            {
+                continue;
+            }
+
+            sai_attribute_t attr;
+
+            attr.id = kvp.first;
+
+            sai_status_t status = m_vendorSai->get(SAI_OBJECT_TYPE_SWITCH, m_switchRid, 1, &attr);
+
+            if (status != SAI_STATUS_SUCCESS || attr.value.oid != kvp.second)
+            {
+                SWSS_LOG_NOTICE("%s differs from discovery cache", md->attridname);
+
+                return false;
+            }
+        }
+    }
+
+    // ports could be changed by breakout
+
+    std::vector<sai_object_id_t> ports(DISCOVERY_CACHE_MAX_PORTS);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_PORT_LIST;
+    attr.value.objlist.count = (uint32_t)ports.size();
+    attr.value.objlist.list = ports.data();
+
+    sai_status_t status = m_vendorSai->get(SAI_OBJECT_TYPE_SWITCH, m_switchRid, 1, &attr);
+
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        for (uint32_t idx = 0; idx < attr.value.objlist.count; idx++)
+        {
+            if (rids.find(ports[idx]) == rids.end())
+            {
+                SWSS_LOG_NOTICE("port RID %s missing from discovery cache",
+                        sai_serialize_object_id(ports[idx]).c_str());
+
+                return false;
+            }
+        }
+    }
+    else
+    {
+        SWSS_LOG_INFO("failed to get port list: %s, skipping ports check",
+                sai_serialize_status(status).c_str());
+    }
+
+    // sample of objects evenly spread over snapshot must still exist
+
+    size_t step = std::max((size_t)1, rids.size() / DISCOVERY_CACHE_SPOT_CHECKS);
+
+    size_t idx = 0;
+
+    for (auto rid: rids)
+    {
+        if (idx++ % step)
+        {
+            continue;
+        }
+
+        if (m_vendorSai->objectTypeQuery(rid) == SAI_OBJECT_TYPE_NULL)
+        {
+            SWSS_LOG_NOTICE("RID %s from discovery cache does not exist",
+                    sai_serialize_object_id(rid).c_str());
+
+            return false;
+        }
+    }
+
+    SWSS_LOG_NOTICE("discovery cache with %zu objects passed spot checks", rids.size());
+
+    return true;
+}
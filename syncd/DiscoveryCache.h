@@ -0,0 +1,92 @@
+#pragma once
+
+#include "meta/SaiInterface.h"
+
+#include "SaiDiscovery.h"
+
+#include "swss/table.h"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Snapshot of objects discovered on the switch.
+     *
+     * Snapshot contains discovered RIDs and default OID map, it is saved on
+     * warm shutdown and used on warm boot instead of running discovery again.
+     *
+     * Snapshot is bound to switch RID, hardware info and libsai API version,
+     * and before it is used it's validated by spot checks against the switch.
+     * If any check fails, full discovery must be performed.
+     */
+    class DiscoveryCache
+    {
+        private:
+
+            DiscoveryCache(const DiscoveryCache&) = delete;
+            DiscoveryCache& operator=(const DiscoveryCache&) = delete;
+
+        public:
+
+            DiscoveryCache(
+                    _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
+                    _In_ sai_object_id_t switchRid,
+                    _In_ const std::string& hardwareInfo);
+
+            virtual ~DiscoveryCache();
+
+        public:
+
+            std::vector<swss::FieldValueTuple> serialize(
+                    _In_ const std::set<sai_object_id_t>& rids,
+                    _In_ const SaiDiscovery::DefaultOidMap& defaultOidMap) const;
+
+            /**
+             * @brief Deserialize and validate snapshot.
+             *
+             * @param[in] hash Serialized snapshot.
+             * @param[out] rids Discovered objects.
+             * @param[out] defaultOidMap Default OID map.
+             *
+             * @return True if snapshot belongs to this switch and passed all
+             * spot checks, false otherwise.
+             */
+            bool deserialize(
+                    _In_ const std::unordered_map<std::string, std::string>& hash,
+                    _Out_ std::set<sai_object_id_t>& rids,
+                    _Out_ SaiDiscovery::DefaultOidMap& defaultOidMap) const;
+
+        private:
+
+            std::string getApiVersion() const;
+
+            bool checkField(
+                    _In_ const std::unordered_map<std::string, std::string>& hash,
+                    _In_ const std::string& field,
+                    _In_ const std::string& expected) const;
+
+            /**
+             * @brief Spot checks snapshot against the switch.
+             *
+             * Read only switch OID attributes must have the same values, all
+             * switch ports must be present in snapshot and sample of objects
+             * must still exist on the switch.
+             */
+            bool validate(
+                    _In_ const std::set<sai_object_id_t>& rids,
+                    _In_ const SaiDiscovery::DefaultOidMap& defaultOidMap) const;
+
+        private:
+
+            std::shared_ptr<sairedis::SaiInterface> m_vendorSai;
+
+            sai_object_id_t m_switchRid;
+
+            std::string m_hardwareInfo;
+    };
+}
@@ -4,9 +4,13 @@
 #include <vector>
 #include <string>
 #include <mutex>
+#include <algorithm>
 
 #include "FlexCounter.h"
 #include "VidManager.h"
+#include "sairediscommon.h"
+#include "CounterSerializationCache.h"
+#include "AdaptiveChunkSizer.h"
 
 #include "meta/sai_serialize.h"
 
@@ -207,6 +211,9 @@ struct BulkStatsContext
     std::string name;
     uint32_t default_bulk_chunk_size;
     std::unordered_set<sai_object_id_t> object_vids_set;
+    CounterSerializationCache serialization_cache;
+    std::vector<uint64_t> published_counters;
+    std::shared_ptr<AdaptiveChunkSizer> chunk_sizer;
 };
 
 // TODO: use if const expression when cpp17 is supported
@@ -1280,16 +1287,34 @@ private:
         auto statsMode = m_groupStatsMode == SAI_STATS_MODE_READ ? SAI_STATS_MODE_BULK_READ : SAI_STATS_MODE_BULK_READ_AND_CLEAR;
         uint32_t bulk_chunk_size = ctx.default_bulk_chunk_size;
         uint32_t size = static_cast<uint32_t>(ctx.object_keys.size());
+
+        if (adaptive_bulk_chunk_size)
+        {
+            if (!ctx.chunk_sizer)
+            {
+                ctx.chunk_sizer = std::make_shared<AdaptiveChunkSizer>();
+            }
+
+            bulk_chunk_size = ctx.chunk_sizer->startPoll(size);
+        }
+        else
+        {
+            ctx.chunk_sizer = nullptr;
+        }
+
         if (bulk_chunk_size > size || bulk_chunk_size == 0)
         {
             bulk_chunk_size = size;
         }
         uint32_t current = 0;
+        auto poll_start = std::chrono::steady_clock::now();
 
         SWSS_LOG_INFO("Before getting bulk %s %s %s size %u bulk chunk size %u current %u", m_instanceId.c_str(), m_name.c_str(), ctx.name.c_str(), size, bulk_chunk_size, current);
 
         while (current < size)
         {
+            auto chunk_start = std::chrono::steady_clock::now();
+
             sai_status_t status = m_vendorSai->bulkGetStats(
                 SAI_NULL_OBJECT_ID,
                 m_objectType,
@@ -1300,6 +1325,24 @@ private:
                 statsMode,
                 ctx.object_statuses.data() + current,
                 ctx.counters.data() + current * ctx.counter_ids.size());
+
+            if (ctx.chunk_sizer)
+            {
+                auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - chunk_start).count();
+
+                // when only some objects failed, failure is caused by them and
+                // not by chunk size
+
+                auto statuses = ctx.object_statuses.begin() + current;
+
+                uint32_t failedCount = static_cast<uint32_t>(std::count_if(statuses, statuses + bulk_chunk_size,
+                        [](sai_status_t objectStatus) { return objectStatus != SAI_STATUS_SUCCESS; }));
+
+                bool objectFailed = failedCount > 0 && failedCount < bulk_chunk_size;
+
+                ctx.chunk_sizer->recordChunk(bulk_chunk_size, latency, SAI_STATUS_SUCCESS == status, objectFailed);
+            }
+
             if (SAI_STATUS_SUCCESS != status)
             {
                 SWSS_LOG_WARN("Failed to bulk get stats for %s %s %s %s starting object %u bulk chunk size %u: %d",
@@ -1317,9 +1360,34 @@ private:
 
         SWSS_LOG_INFO("After getting bulk %s %s %s total %u objects", m_instanceId.c_str(), m_name.c_str(), ctx.name.c_str(), size);
 
+        if (ctx.chunk_sizer)
+        {
+            auto total = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - poll_start).count();
+
+            ctx.chunk_sizer->endPoll(total);
+        }
+
         auto time_stamp = std::chrono::steady_clock::now().time_since_epoch().count();
 
-        std::vector<swss::FieldValueTuple> values;
+        // counter names and object keys are serialized only when changed
+
+        auto &cache = ctx.serialization_cache;
+
+        bool rebuilt = cache.update(ctx.counter_ids, ctx.object_vids, [](StatType stat) { return serializeStat(stat); });
+
+        // in delta mode all counters are published after objects or counter ids changed
+
+        bool publishAll = !publish_delta || rebuilt || ctx.published_counters.size() != ctx.counters.size();
+
+        if (publish_delta)
+        {
+            ctx.published_counters.resize(ctx.counters.size());
+        }
+        else
+        {
+            ctx.published_counters.clear();
+        }
+
         for (size_t i = 0; i < ctx.object_keys.size(); i++)
         {
             if (SAI_STATUS_SUCCESS != ctx.object_statuses[i])
@@ -1327,17 +1395,25 @@ private:
                 SWSS_LOG_ERROR("Failed to get stats of %s 0x%" PRIx64 " 0x%" PRIx64 ": %d", m_name.c_str(), ctx.object_vids[i], ctx.object_keys[i].key.object_id, ctx.object_statuses[i]);
                 continue;
             }
-            const auto &vid = ctx.object_vids[i];
 
-            for (size_t j = 0; j < ctx.counter_ids.size(); j++)
+            size_t offset = i * ctx.counter_ids.size();
+
+            if (!publish_delta)
             {
-                values.emplace_back(serializeStat(ctx.counter_ids[j]), std::to_string(ctx.counters[i * ctx.counter_ids.size() + j]));
+                countersTable.set(cache.getObjectKey(i), cache.serializeValues(ctx.counters.data() + offset), "");
+                continue;
             }
 
-            countersTable.set(sai_serialize_object_id(vid), values, "");
-            values.clear();
+            auto& changed = cache.serializeChangedValues(ctx.counters.data() + offset, ctx.published_counters.data() + offset, publishAll);
+
+            if (changed.size())
+            {
+                countersTable.set(cache.getObjectKey(i), changed, "");
+            }
         }
 
+        std::vector<swss::FieldValueTuple> values;
+
         // First generate the key, then replace spaces with underscores to avoid issues when Lua plugins handle the timestamp
         std::string timestamp_key = m_instanceId + "_" + m_name + "_time_stamp";
         std::replace(timestamp_key.begin(), timestamp_key.end(), ' ', '_');
@@ -1345,6 +1421,14 @@ private:
         values.emplace_back(timestamp_key, std::to_string(time_stamp));
         countersTable.set("TIME_STAMP", values, "");
 
+        if (ctx.chunk_sizer)
+        {
+            std::string prefix = m_instanceId + "_" + m_name + "_" + ctx.name;
+            std::replace(prefix.begin(), prefix.end(), ' ', '_');
+
+            countersTable.set("BULK_CHUNK_STATS", ctx.chunk_sizer->getStats(prefix), "");
+        }
+
         SWSS_LOG_DEBUG("After pushing db %s %s %s", m_instanceId.c_str(), m_name.c_str(), ctx.name.c_str());
     }
 
@@ -2091,18 +2175,22 @@ FlexCounter::FlexCounter(
         _In_ const std::string& instanceId,
         _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
         _In_ const std::string& dbCounters,
-        _In_ const bool noDoubleCheckBulkCapability):
+        _In_ const bool noDoubleCheckBulkCapability,
+        _In_ std::shared_ptr<WorkerPool> workerPool):
     m_readyToPoll(false),
     m_pollInterval(0),
     m_instanceId(instanceId),
     m_vendorSai(vendorSai),
     m_dbCounters(dbCounters),
-    m_noDoubleCheckBulkCapability(noDoubleCheckBulkCapability)
+    m_noDoubleCheckBulkCapability(noDoubleCheckBulkCapability),
+    m_workerPool(workerPool)
 {
     SWSS_LOG_ENTER();
 
     m_enable = false;
     m_isDiscarded = false;
+    m_publishDelta = false;
+    m_adaptiveBulkChunkSize = false;
 
     startFlexCounterThread();
 }
@@ -2170,6 +2258,41 @@ void FlexCounter::setStatsMode(
     }
 }
 
+void FlexCounter::setPublishMode(
+        _In_ const std::string& mode)
+{
+    SWSS_LOG_ENTER();
+
+    bool publishDelta;
+
+    if (mode == PUBLISH_MODE_DELTA)
+    {
+        publishDelta = true;
+    }
+    else if (mode == PUBLISH_MODE_FULL)
+    {
+        publishDelta = false;
+    }
+    else
+    {
+        SWSS_LOG_WARN("Input value %s is not supported for Flex counter publish mode, enter %s or %s",
+                mode.c_str(), PUBLISH_MODE_FULL, PUBLISH_MODE_DELTA);
+        return;
+    }
+
+    if (m_publishDelta != publishDelta)
+    {
+        m_publishDelta = publishDelta;
+
+        for (auto &context : m_counterContext)
+        {
+            context.second->publish_delta = m_publishDelta;
+        }
+
+        SWSS_LOG_INFO("Set PUBLISH MODE %s for FC %s", mode.c_str(), m_instanceId.c_str());
+    }
+}
+
 void FlexCounter::removeDataFromCountersDB(
         _In_ sai_object_id_t vid,
         _In_ const std::string &ratePrefix)
@@ -2227,7 +2350,9 @@ void FlexCounter::addCounterPlugin(
         }
         else if (field == BULK_CHUNK_SIZE_FIELD)
         {
-            if (value != "NULL")
+            m_adaptiveBulkChunkSize = (value == BULK_CHUNK_SIZE_AUTO);
+
+            if (value != "NULL" && !m_adaptiveBulkChunkSize)
             {
                 try
                 {
@@ -2242,6 +2367,7 @@ void FlexCounter::addCounterPlugin(
             {
                 SWSS_LOG_NOTICE("Set counter context %s %s bulk size %u", m_instanceId.c_str(), COUNTER_TYPE_PORT.c_str(), bulkChunkSize);
                 context.second->setBulkChunkSize(bulkChunkSize);
+                context.second->adaptive_bulk_chunk_size = m_adaptiveBulkChunkSize;
             }
         }
         else if (field == BULK_CHUNK_SIZE_PER_PREFIX_FIELD)
@@ -2261,6 +2387,10 @@ void FlexCounter::addCounterPlugin(
         {
             setStatsMode(value);
         }
+        else if (field == PUBLISH_MODE_FIELD)
+        {
+            setPublishMode(value);
+        }
         else
         {
             auto counterTypeRef = m_plugIn2CounterType.find(field);
@@ -2499,6 +2629,9 @@ std::shared_ptr<BaseCounterContext> FlexCounter::getCounterContext(
 
     auto counterContext = createCounterContext(name, m_instanceId);
 
+    counterContext->publish_delta = m_publishDelta;
+    counterContext->adaptive_bulk_chunk_size = m_adaptiveBulkChunkSize;
+
     if (m_noDoubleCheckBulkCapability)
     {
         counterContext->setNoDoubleCheckBulkCapability(true);
@@ -2545,6 +2678,55 @@ void FlexCounter::collectCounters(
     countersTable.flush();
 }
 
+void FlexCounter::collectCountersParallel(
+        _In_ swss::DBConnector& db,
+        _In_ swss::Table &countersTable)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::future<void>> futures;
+
+    size_t idx = 0;
+
+    for (const auto &it : m_counterContext)
+    {
+        if (!it.second->hasObject())
+        {
+            continue;
+        }
+
+        if (idx == m_collectTables.size())
+        {
+            auto pipeline = std::make_shared<swss::RedisPipeline>(&db);
+
+            m_collectPipelines.push_back(pipeline);
+            m_collectTables.push_back(std::make_shared<swss::Table>(pipeline.get(), COUNTERS_TABLE, true));
+        }
+
+        auto context = it.second;
+        auto table = m_collectTables[idx++];
+
+        futures.push_back(m_workerPool->submit([context, table]() { context->collectData(*table); }));
+    }
+
+    for (auto& future: futures)
+    {
+        future.wait();
+    }
+
+    for (size_t i = 0; i < idx; i++)
+    {
+        m_collectTables[i]->flush();
+    }
+
+    countersTable.flush();
+
+    for (auto& future: futures)
+    {
+        future.get(); // rethrow exception from collect
+    }
+}
+
 void FlexCounter::runPlugins(
         _In_ swss::DBConnector& counters_db)
 {
@@ -2579,7 +2761,14 @@ void FlexCounter::flexCounterThreadRunFunction()
         {
             auto start = std::chrono::steady_clock::now();
 
-            collectCounters(countersTable);
+            if (m_workerPool && m_counterContext.size() > 1)
+            {
+                collectCountersParallel(db, countersTable);
+            }
+            else
+            {
+                collectCounters(countersTable);
+            }
 
             runPlugins(db);
 
@@ -2606,6 +2795,9 @@ void FlexCounter::flexCounterThreadRunFunction()
         // nothing to collect, wait until notified
         waitPoll();
     }
+
+    m_collectTables.clear();
+    m_collectPipelines.clear();
 }
 
 void FlexCounter::startFlexCounterThread()
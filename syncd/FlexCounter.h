@@ -4,9 +4,12 @@ extern "C" {
 #include "sai.h"
 }
 
+#include "WorkerPool.h"
+
 #include "meta/SaiInterface.h"
 
 #include "swss/table.h"
+#include "swss/redispipeline.h"
 
 #include <vector>
 #include <set>
@@ -74,6 +77,8 @@ namespace syncd
         bool double_confirm_supported_counters = false;
         bool no_double_check_bulk_capability = false;
         bool dont_clear_support_counter  = false;
+        bool publish_delta = false;
+        bool adaptive_bulk_chunk_size = false;
         uint32_t default_bulk_chunk_size = 0;
     };
     class FlexCounter
@@ -86,7 +91,8 @@ namespace syncd
                     _In_ const std::string& instanceId,
                     _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
                     _In_ const std::string& dbCounters,
-                    _In_ const bool noDoubleCheckBulkCapability=false);
+                    _In_ const bool noDoubleCheckBulkCapability=false,
+                    _In_ std::shared_ptr<WorkerPool> workerPool=nullptr);
 
             virtual ~FlexCounter();
 
@@ -125,6 +131,9 @@ namespace syncd
             void setStatsMode(
                     _In_ const std::string& mode);
 
+            void setPublishMode(
+                    _In_ const std::string& mode);
+
         private:
             bool allIdsEmpty() const;
 
@@ -152,6 +161,16 @@ namespace syncd
             void collectCounters(
                     _In_ swss::Table &countersTable);
 
+            /**
+             * @brief Collect counter contexts concurrently on worker pool.
+             *
+             * Each context is writing to its own redis pipeline, all
+             * pipelines are flushed when all contexts are collected.
+             */
+            void collectCountersParallel(
+                    _In_ swss::DBConnector& db,
+                    _In_ swss::Table &countersTable);
+
             void runPlugins(
                     _In_ swss::DBConnector& db);
 
@@ -187,6 +206,18 @@ namespace syncd
 
             sai_stats_mode_t m_statsMode;
 
+            /**
+             * @brief When true, only counters changed since last poll are
+             * written to COUNTERS_DB.
+             */
+            bool m_publishDelta;
+
+            /**
+             * @brief When true, bulk chunk size is selected at runtime based
+             * on measured bulk call latency.
+             */
+            bool m_adaptiveBulkChunkSize;
+
             bool m_enable;
 
             std::shared_ptr<sairedis::SaiInterface> m_vendorSai;
@@ -199,6 +230,16 @@ namespace syncd
 
             bool m_noDoubleCheckBulkCapability;
 
+            std::shared_ptr<WorkerPool> m_workerPool;
+
+            /**
+             * @brief Per context collect tables used by parallel collection,
+             * accessed only by flex counter thread.
+             */
+            std::vector<std::shared_ptr<swss::RedisPipeline>> m_collectPipelines;
+
+            std::vector<std::shared_ptr<swss::Table>> m_collectTables;
+
             static const std::map<std::string, std::string> m_plugIn2CounterType;
 
             static const std::map<std::tuple<sai_object_type_t, std::string>, std::string> m_objectTypeField2CounterType;
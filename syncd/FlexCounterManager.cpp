@@ -10,14 +10,18 @@ using namespace syncd;
 FlexCounterManager::FlexCounterManager(
         _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
         _In_ const std::string& dbCounters,
-        _In_ const std::string& supportingBulkInstances):
+        _In_ const std::string& supportingBulkInstances,
+        _In_ uint32_t pollWorkers):
     m_vendorSai(vendorSai),
     m_dbCounters(dbCounters),
     m_supportingBulkGroups(supportingBulkInstances)
 {
     SWSS_LOG_ENTER();
 
-    // empty
+    if (pollWorkers)
+    {
+        m_workerPool = std::make_shared<WorkerPool>(pollWorkers);
+    }
 }
 
 std::shared_ptr<FlexCounter> FlexCounterManager::getInstance(
@@ -30,7 +34,7 @@ std::shared_ptr<FlexCounter> FlexCounterManager::getInstance(
     if (m_flexCounters.count(instanceId) == 0)
     {
         bool supportingBulk = (m_supportingBulkGroups.find(instanceId) != std::string::npos);
-        auto counter = std::make_shared<FlexCounter>(instanceId, m_vendorSai, m_dbCounters, supportingBulk);
+        auto counter = std::make_shared<FlexCounter>(instanceId, m_vendorSai, m_dbCounters, supportingBulk, m_workerPool);
 
         m_flexCounters[instanceId] = counter;
     }
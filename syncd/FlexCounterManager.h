@@ -11,7 +11,8 @@ namespace syncd
             FlexCounterManager(
                     _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
                     _In_ const std::string& dbCounters,
-                    _In_ const std::string& supportingBulkInstances);
+                    _In_ const std::string& supportingBulkInstances,
+                    _In_ uint32_t pollWorkers = 0);
 
             virtual ~FlexCounterManager() = default;
 
@@ -58,6 +59,12 @@ namespace syncd
 
                 std::string m_dbCounters;
 
+                /**
+                 * @brief Worker pool shared by all flex counter instances,
+                 * nullptr when counter contexts are collected serially.
+                 */
+                std::shared_ptr<WorkerPool> m_workerPool;
+
                 std::string m_supportingBulkGroups;
     };
 }
@@ -0,0 +1,335 @@
+#include "IdenticalEntryFilter.h"
+
+#include "swss/logger.h"
+
+#include "meta/sai_serialize.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+using namespace syncd;
+
+#define OID_PREFIX "oid:"
+
+swss::TableDump IdenticalEntryFilter::filter(
+        _Inout_ swss::TableDump& current,
+        _Inout_ swss::TableDump& temp)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("identical entries filter");
+
+    auto currentIds = getObjectIds(current);
+    auto tempIds = getObjectIds(temp);
+
+    struct Candidate
+    {
+        swss::TableDump::iterator current;
+        swss::TableDump::iterator temp;
+        std::string group;
+    };
+
+    std::vector<Candidate> candidates;
+
+    std::unordered_map<std::string, size_t> candidateGroups;
+
+    // both dumps are sorted by key, so walk them together
+
+    auto cit = current.begin();
+    auto tit = temp.begin();
+
+    while (cit != current.end() && tit != temp.end())
+    {
+        int cmp = cit->first.compare(tit->first);
+
+        if (cmp < 0)
+        {
+            ++cit;
+            continue;
+        }
+
+        if (cmp > 0)
+        {
+            ++tit;
+            continue;
+        }
+
+        if (cit->second == tit->second && canBePaired(*tit, currentIds, tempIds))
+        {
+            auto group = getPreMatchGroup(tit->first);
+
+            if (group.size())
+            {
+                candidateGroups[group]++;
+            }
+
+            candidates.push_back({cit, tit, group});
+        }
+
+        ++cit;
+        ++tit;
+    }
+
+    std::unordered_map<std::string, size_t> currentGroups;
+    std::unordered_map<std::string, size_t> tempGroups;
+
+    if (candidateGroups.size())
+    {
+        currentGroups = getPreMatchGroupCounts(current);
+        tempGroups = getPreMatchGroupCounts(temp);
+    }
+
+    swss::TableDump identical;
+
+    for (auto& candidate: candidates)
+    {
+        if (candidate.group.size())
+        {
+            size_t count = candidateGroups.at(candidate.group);
+
+            if (currentGroups.at(candidate.group) != count || tempGroups.at(candidate.group) != count)
+            {
+                // other entries with this prefix (IP) are compared, pairing
+                // would change which of them are unique for pre match map
+
+                continue;
+            }
+        }
+
+        identical.emplace_hint(identical.end(), candidate.temp->first, std::move(candidate.temp->second));
+
+        current.erase(candidate.current);
+        temp.erase(candidate.temp);
+    }
+
+    SWSS_LOG_NOTICE("paired %zu identical entries, left for comparison: current %zu, temporary %zu",
+            identical.size(),
+            current.size(),
+            temp.size());
+
+    return identical;
+}
+
+std::unordered_map<sai_object_id_t, int> IdenticalEntryFilter::getReferences(
+        _In_ const swss::TableDump& entries)
+{
+    SWSS_LOG_ENTER();
+
+    std::unordered_map<sai_object_id_t, int> references;
+
+    auto count = [&](const std::string& str) {
+
+        size_t pos = 0;
+
+        while ((pos = str.find(OID_PREFIX, pos)) != std::string::npos)
+        {
+            pos += strlen(OID_PREFIX);
+
+            sai_object_id_t vid = strtoull(str.c_str() + pos, NULL, 16);
+
+            if (vid != SAI_NULL_OBJECT_ID)
+            {
+                references[vid]++;
+            }
+        }
+    };
+
+    // same as AsicView, each object id in entry key and attributes counts
+
+    for (const auto& entry: entries)
+    {
+        count(entry.first);
+
+        for (const auto& field: entry.second)
+        {
+            count(field.second);
+        }
+    }
+
+    return references;
+}
+
+std::string IdenticalEntryFilter::getPreMatchGroup(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto pos = key.find(':');
+
+    if (pos == std::string::npos)
+    {
+        return "";
+    }
+
+    sai_object_type_t objectType;
+
+    sai_deserialize_object_type(key.substr(0, pos), objectType);
+
+    switch (objectType)
+    {
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+            {
+                sai_route_entry_t routeEntry;
+
+                sai_deserialize_route_entry(key.substr(pos + 1), routeEntry);
+
+                return "route:" + sai_serialize_ip_prefix(routeEntry.destination);
+            }
+
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+            {
+                sai_neighbor_entry_t neighborEntry;
+
+                sai_deserialize_neighbor_entry(key.substr(pos + 1), neighborEntry);
+
+                return "neighbor:" + sai_serialize_ip_address(neighborEntry.ip_address);
+            }
+
+        default:
+            return "";
+    }
+}
+
+std::unordered_map<std::string, size_t> IdenticalEntryFilter::getPreMatchGroupCounts(
+        _In_ const swss::TableDump& dump)
+{
+    SWSS_LOG_ENTER();
+
+    std::unordered_map<std::string, size_t> groups;
+
+    for (const auto& kvp: dump)
+    {
+        auto group = getPreMatchGroup(kvp.first);
+
+        if (group.size())
+        {
+            groups[group]++;
+        }
+    }
+
+    return groups;
+}
+
+std::unordered_set<sai_object_id_t> IdenticalEntryFilter::getObjectIds(
+        _In_ const swss::TableDump& dump)
+{
+    SWSS_LOG_ENTER();
+
+    std::unordered_set<sai_object_id_t> ids;
+
+    for (const auto& kvp: dump)
+    {
+        auto pos = kvp.first.find(':');
+
+        if (pos == std::string::npos || kvp.first.compare(pos + 1, strlen(OID_PREFIX), OID_PREFIX) != 0)
+        {
+            continue; // non object id
+        }
+
+        sai_object_id_t vid;
+
+        sai_deserialize_object_id(kvp.first.substr(pos + 1), vid);
+
+        ids.insert(vid);
+    }
+
+    return ids;
+}
+
+bool IdenticalEntryFilter::hasOnlyCommonObjectIds(
+        _In_ const std::string& str,
+        _In_ const std::unordered_set<sai_object_id_t>& current,
+        _In_ const std::unordered_set<sai_object_id_t>& temp)
+{
+    SWSS_LOG_ENTER();
+
+    // object ids can be in entry key, in attribute value and in lists
+
+    size_t pos = 0;
+
+    while ((pos = str.find(OID_PREFIX, pos)) != std::string::npos)
+    {
+        pos += strlen(OID_PREFIX);
+
+        sai_object_id_t vid = strtoull(str.c_str() + pos, NULL, 16);
+
+        if (vid == SAI_NULL_OBJECT_ID)
+            continue;
+
+        if (current.find(vid) == current.end() || temp.find(vid) == temp.end())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool IdenticalEntryFilter::canBePaired(
+        _In_ const swss::TableDump::value_type& entry,
+        _In_ const std::unordered_set<sai_object_id_t>& current,
+        _In_ const std::unordered_set<sai_object_id_t>& temp)
+{
+    SWSS_LOG_ENTER();
+
+    auto& key = entry.first;
+
+    auto pos = key.find(':');
+
+    if (pos == std::string::npos)
+    {
+        return false;
+    }
+
+    sai_object_type_t objectType;
+
+    sai_deserialize_object_type(key.substr(0, pos), objectType);
+
+    switch (objectType)
+    {
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+        case SAI_OBJECT_TYPE_INSEG_ENTRY:
+            break;
+
+        default:
+
+            // object id objects are always compared, NAT entries have hit
+            // bit attributes ignored when loaded to view
+
+            return false;
+    }
+
+    if (!hasOnlyCommonObjectIds(key, current, temp))
+    {
+        return false;
+    }
+
+    for (const auto& field: entry.second)
+    {
+        if (field.first == "NULL")
+            continue; // object without attributes
+
+        auto meta = sai_metadata_get_attr_metadata_by_attr_id_name(field.first.c_str());
+
+        if (meta == NULL)
+        {
+            return false;
+        }
+
+        if (meta->isenum && meta->enummetadata->ignorevalues)
+        {
+            return false;
+        }
+
+        if (!hasOnlyCommonObjectIds(field.second, current, temp))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
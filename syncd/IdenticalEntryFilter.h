@@ -0,0 +1,103 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "swss/table.h"
+
+#include <string>
+#include <unordered_set>
+#include <unordered_map>
+
+namespace syncd
+{
+    /**
+     * @brief Apply view pre pass on table dumps.
+     *
+     * Route, neighbor, FDB and inseg entries which have the same key and the
+     * same attributes in both current and temporary view, and which reference
+     * only object ids present in both views, don't need any ASIC operation, so
+     * they can be paired directly and removed from both dumps before views are
+     * built and compared. This saves parsing and comparing those entries,
+     * which are the majority of ASIC view in warm boot case.
+     *
+     * Object ids present in both views have the same VID and RID, so they are
+     * matched by comparison logic and never removed. To keep matching of
+     * remaining objects unchanged, views must bind references returned by
+     * getReferences, and routes (neighbors) are paired only when all entries
+     * with given prefix (IP) are paired, so pre match map created from unique
+     * prefixes (IPs) is the same.
+     */
+    class IdenticalEntryFilter
+    {
+        private:
+
+            IdenticalEntryFilter() = delete;
+
+            ~IdenticalEntryFilter() = delete;
+
+        public:
+
+            /**
+             * @brief Moves identical entries out of current and temporary dump.
+             *
+             * @param[in,out] current Current view dump.
+             * @param[in,out] temp Temporary view dump.
+             *
+             * @return Entries removed from both dumps.
+             */
+            static swss::TableDump filter(
+                    _Inout_ swss::TableDump& current,
+                    _Inout_ swss::TableDump& temp);
+
+            /**
+             * @brief Gets object id reference count held by given entries.
+             *
+             * @param[in] entries Entries returned by filter.
+             *
+             * @return Reference count per VID.
+             */
+            static std::unordered_map<sai_object_id_t, int> getReferences(
+                    _In_ const swss::TableDump& entries);
+
+        private:
+
+            static std::unordered_set<sai_object_id_t> getObjectIds(
+                    _In_ const swss::TableDump& dump);
+
+            /**
+             * @brief Gets pre match group of entry.
+             *
+             * Routes are grouped by prefix and neighbors by IP, the same way
+             * as they are indexed in AsicView for pre match map.
+             *
+             * @return Group name or empty string for other entries.
+             */
+            static std::string getPreMatchGroup(
+                    _In_ const std::string& key);
+
+            static std::unordered_map<std::string, size_t> getPreMatchGroupCounts(
+                    _In_ const swss::TableDump& dump);
+
+            /**
+             * @brief Tells whether all object ids in given string are present
+             * in both views.
+             */
+            static bool hasOnlyCommonObjectIds(
+                    _In_ const std::string& str,
+                    _In_ const std::unordered_set<sai_object_id_t>& current,
+                    _In_ const std::unordered_set<sai_object_id_t>& temp);
+
+            /**
+             * @brief Tells whether entry can be paired without comparison logic.
+             *
+             * Attributes which values could be translated or ignored when
+             * loaded to view are left for comparison logic.
+             */
+            static bool canBePaired(
+                    _In_ const swss::TableDump::value_type& entry,
+                    _In_ const std::unordered_set<sai_object_id_t>& current,
+                    _In_ const std::unordered_set<sai_object_id_t>& temp);
+    };
+}
@@ -0,0 +1,72 @@
+#include "MemoryUsage.h"
+
+#include "swss/logger.h"
+
+#include <fstream>
+#include <sstream>
+
+using namespace syncd;
+
+uint64_t MemoryUsage::getResidentSetSize()
+{
+    SWSS_LOG_ENTER();
+
+    return getStatusValue("VmRSS:");
+}
+
+uint64_t MemoryUsage::getPeakResidentSetSize()
+{
+    SWSS_LOG_ENTER();
+
+    return getStatusValue("VmHWM:");
+}
+
+bool MemoryUsage::resetPeakResidentSetSize()
+{
+    SWSS_LOG_ENTER();
+
+    // writing 5 to clear_refs resets VmHWM, supported since linux 4.0
+
+    std::ofstream ofs("/proc/self/clear_refs");
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_WARN("failed to open /proc/self/clear_refs");
+
+        return false;
+    }
+
+    ofs << "5";
+
+    ofs.flush();
+
+    return ofs.good();
+}
+
+uint64_t MemoryUsage::getStatusValue(
+        _In_ const std::string& name)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream ifs("/proc/self/status");
+
+    std::string line;
+
+    while (std::getline(ifs, line))
+    {
+        if (line.compare(0, name.size(), name) != 0)
+            continue;
+
+        std::istringstream iss(line.substr(name.size()));
+
+        uint64_t value = 0;
+
+        iss >> value;
+
+        return value;
+    }
+
+    SWSS_LOG_WARN("%s not found in /proc/self/status", name.c_str());
+
+    return 0;
+}
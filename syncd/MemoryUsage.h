@@ -0,0 +1,49 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <stdint.h>
+#include <string>
+
+namespace syncd
+{
+    /**
+     * @brief Memory usage of current process.
+     *
+     * Values are read from /proc/self/status and are in kB. When value is
+     * not available, zero is returned.
+     */
+    class MemoryUsage
+    {
+        private:
+
+            MemoryUsage() = delete;
+
+            ~MemoryUsage() = delete;
+
+        public:
+
+            /**
+             * @brief Gets current resident set size (VmRSS).
+             */
+            static uint64_t getResidentSetSize();
+
+            /**
+             * @brief Gets peak resident set size (VmHWM).
+             */
+            static uint64_t getPeakResidentSetSize();
+
+            /**
+             * @brief Resets peak resident set size to current resident set
+             * size, so peak of following operation can be measured.
+             *
+             * @return True on success.
+             */
+            static bool resetPeakResidentSetSize();
+
+        private:
+
+            static uint64_t getStatusValue(
+                    _In_ const std::string& name);
+    };
+}
@@ -232,7 +232,7 @@ void NotificationHandler::enqueueNotification(
 
     swss::KeyOpFieldsValuesTuple item(op, data, entry);
 
-    if (m_notificationQueue->enqueue(item))
+    if (m_notificationQueue->enqueue(std::move(item)))
     {
         m_processor->signal();
     }
@@ -17,7 +17,9 @@ using namespace saimeta;
 NotificationProcessor::NotificationProcessor(
         _In_ std::shared_ptr<NotificationProducerBase> producer,
         _In_ std::shared_ptr<BaseRedisClient> client,
-        _In_ std::function<void(const swss::KeyOpFieldsValuesTuple&)> synchronizer):
+        _In_ std::function<void(const swss::KeyOpFieldsValuesTuple&)> synchronizer,
+        _In_ size_t notificationRingCapacity,
+        _In_ bool fdbCoalescing):
     m_synchronizer(synchronizer),
     m_client(client),
     m_notifications(producer)
@@ -26,7 +28,11 @@ NotificationProcessor::NotificationProcessor(
 
     m_runThread = false;
 
-    m_notificationQueue = std::make_shared<NotificationQueue>();
+    m_notificationQueue = std::make_shared<NotificationQueue>(
+            DEFAULT_NOTIFICATION_QUEUE_SIZE_LIMIT,
+            DEFAULT_NOTIFICATION_CONSECUTIVE_THRESHOLD,
+            notificationRingCapacity,
+            fdbCoalescing);
 }
 
 NotificationProcessor::~NotificationProcessor()
@@ -1085,6 +1091,11 @@ void NotificationProcessor::stopNotificationsProcessingThread()
     if (m_ntf_process_thread != nullptr)
     {
         m_ntf_process_thread->join();
+
+        SWSS_LOG_NOTICE("notification queue high water mark: %zu, dropped: %zu, coalesced: %zu",
+                m_notificationQueue->getHighWaterMark(),
+                m_notificationQueue->getDropCount(),
+                m_notificationQueue->getCoalescedCount());
     }
 
     m_ntf_process_thread = nullptr;
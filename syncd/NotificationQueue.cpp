@@ -1,6 +1,8 @@
 #include "NotificationQueue.h"
 #include "sairediscommon.h"
 
+#include <nlohmann/json.hpp>
+
 #define NOTIFICATION_QUEUE_DROP_COUNT_INDICATOR (1000)
 
 using namespace syncd;
@@ -9,16 +11,39 @@ using namespace syncd;
 
 NotificationQueue::NotificationQueue(
         _In_ size_t queueLimit,
-        _In_ size_t consecutiveThresholdLimit):
+        _In_ size_t consecutiveThresholdLimit,
+        _In_ size_t ringCapacity,
+        _In_ bool fdbCoalescing):
     m_queueSizeLimit(queueLimit),
     m_thresholdLimit(consecutiveThresholdLimit),
     m_dropCount(0),
     m_lastEventCount(0),
-    m_lastEvent(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT)
+    m_lastEvent(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT),
+    m_highWaterMark(0),
+    m_fdbCoalescing(fdbCoalescing),
+    m_frontSequence(0),
+    m_coalescedCount(0),
+    m_ringLastEventHash(std::hash<std::string>()(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT)),
+    m_ringLastEventCount(0),
+    m_ringOverflowSize(0)
 {
     SWSS_LOG_ENTER();
 
-    m_queue = std::make_shared<std::queue<swss::KeyOpFieldsValuesTuple>>();
+    m_queue = std::make_shared<std::deque<swss::KeyOpFieldsValuesTuple>>();
+
+    if (ringCapacity)
+    {
+        m_ring = std::make_shared<saimeta::MpscRingBuffer<swss::KeyOpFieldsValuesTuple>>(ringCapacity);
+
+        SWSS_LOG_NOTICE("using lock-free notification ring with %zu slots", m_ring->capacity());
+
+        if (m_fdbCoalescing)
+        {
+            SWSS_LOG_WARN("FDB coalescing is not supported by notification ring, disabling");
+
+            m_fdbCoalescing = false;
+        }
+    }
 }
 
 NotificationQueue::~NotificationQueue()
@@ -31,10 +56,25 @@ NotificationQueue::~NotificationQueue()
 bool NotificationQueue::enqueue(
         _In_ const swss::KeyOpFieldsValuesTuple& item)
 {
-    MUTEX;
+    SWSS_LOG_ENTER();
 
+    swss::KeyOpFieldsValuesTuple copy = item;
+
+    return enqueue(std::move(copy));
+}
+
+bool NotificationQueue::enqueue(
+        _In_ swss::KeyOpFieldsValuesTuple&& item)
+{
     SWSS_LOG_ENTER();
 
+    if (m_ring)
+    {
+        return enqueueRing(std::move(item));
+    }
+
+    MUTEX;
+
     bool candidateToDrop = false;
 
     std::string currentEvent;
@@ -53,6 +93,18 @@ bool NotificationQueue::enqueue(
      */
     auto queueSize = m_queue->size();
 
+    std::string fdbEntry;
+
+    if (m_fdbCoalescing && tryCoalesceFdb(item, fdbEntry))
+    {
+        /*
+         * Notification replaced already queued one, queue size didn't
+         * change, so there is no need to apply drop policy.
+         */
+
+        return true;
+    }
+
     currentEvent = kfvKey(item);
 
     if (currentEvent == m_lastEvent)
@@ -88,39 +140,223 @@ bool NotificationQueue::enqueue(
 
     if (!candidateToDrop)
     {
-        m_queue->push(item);
+        m_queue->push_back(std::move(item));
+
+        if (fdbEntry.size())
+        {
+            m_fdbIndex[fdbEntry] = m_frontSequence + queueSize;
+        }
+
+        updateHighWaterMark(queueSize + 1);
+
+        return true;
+    }
+
+    onDrop(queueSize, m_lastEventCount, m_lastEvent);
+
+    return false;
+}
+
+bool NotificationQueue::tryCoalesceFdb(
+        _Inout_ swss::KeyOpFieldsValuesTuple& item,
+        _Out_ std::string& fdbEntry)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Only single LEARNED, AGED and MOVE notifications are coalesced, since
+     * they describe complete state of single FDB entry. Any other notification
+     * (FDB flush, notification with multiple entries or other event type) is
+     * a barrier, after which new notifications are queued again, so relative
+     * order of different notification types is preserved.
+     */
+
+    fdbEntry.clear();
+
+    if (kfvKey(item) == SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT)
+    {
+        try
+        {
+            auto j = nlohmann::json::parse(kfvOp(item));
+
+            if (j.is_array() && j.size() == 1)
+            {
+                const std::string event = j[0]["fdb_event"];
+
+                if (event == "SAI_FDB_EVENT_LEARNED" ||
+                        event == "SAI_FDB_EVENT_AGED" ||
+                        event == "SAI_FDB_EVENT_MOVE")
+                {
+                    fdbEntry = j[0]["fdb_entry"];
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_WARN("failed to parse fdb notification: %s", e.what());
+        }
+    }
+
+    if (fdbEntry.empty())
+    {
+        m_fdbIndex.clear();
+
+        return false;
+    }
+
+    auto it = m_fdbIndex.find(fdbEntry);
+
+    if (it != m_fdbIndex.end() && it->second >= m_frontSequence)
+    {
+        m_queue->at(it->second - m_frontSequence) = std::move(item);
+
+        m_coalescedCount++;
 
         return true;
     }
 
-    m_dropCount++;
+    return false; // caller will index notification when queued
+}
+
+bool NotificationQueue::enqueueRing(
+        _In_ swss::KeyOpFieldsValuesTuple&& item)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Same drop policy as mutex guarded queue, but consecutive event tracking
+     * is done on hash of event name using atomics, so when multiple producers
+     * are racing, consecutive count can be approximate.
+     */
+
+    const std::string& currentEvent = kfvKey(item);
+
+    size_t hash = std::hash<std::string>()(currentEvent);
+
+    size_t lastEventCount;
 
-    if (!(m_dropCount % NOTIFICATION_QUEUE_DROP_COUNT_INDICATOR))
+    if (m_ringLastEventHash.exchange(hash) == hash)
+    {
+        lastEventCount = ++m_ringLastEventCount;
+    }
+    else
+    {
+        m_ringLastEventCount = 1;
+
+        lastEventCount = 1;
+    }
+
+    auto queueSize = m_ring->size() + m_ringOverflowSize.load();
+
+    bool candidateToDrop = false;
+
+    if (queueSize >= m_queueSizeLimit)
+    {
+        if (currentEvent == SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT || lastEventCount >= m_thresholdLimit)
+        {
+            candidateToDrop = true;
+        }
+    }
+
+    if (candidateToDrop)
+    {
+        onDrop(queueSize, lastEventCount, currentEvent);
+
+        return false;
+    }
+
+    // item is moved only when enqueue succeeds
+
+    if (m_ringOverflowSize.load() == 0 && m_ring->tryEnqueue(std::move(item)))
+    {
+        updateHighWaterMark(queueSize + 1);
+
+        return true;
+    }
+
+    /*
+     * Ring is full, or there are already notifications in overflow queue, so
+     * to keep notifications in order, queue this one after them.
+     */
+
+    MUTEX;
+
+    m_queue->push_back(std::move(item));
+
+    m_ringOverflowSize++;
+
+    updateHighWaterMark(queueSize + 1);
+
+    return true;
+}
+
+void NotificationQueue::updateHighWaterMark(
+        _In_ size_t queueSize)
+{
+    SWSS_LOG_ENTER();
+
+    size_t hwm = m_highWaterMark.load(std::memory_order_relaxed);
+
+    while (queueSize > hwm && !m_highWaterMark.compare_exchange_weak(hwm, queueSize, std::memory_order_relaxed))
+    {
+        // hwm was updated by compare exchange, try again
+    }
+}
+
+void NotificationQueue::onDrop(
+        _In_ size_t queueSize,
+        _In_ size_t lastEventCount,
+        _In_ const std::string& lastEvent)
+{
+    SWSS_LOG_ENTER();
+
+    size_t dropCount = ++m_dropCount;
+
+    if (!(dropCount % NOTIFICATION_QUEUE_DROP_COUNT_INDICATOR))
     {
         SWSS_LOG_NOTICE(
-                "Too many messages in queue (%zu), dropped (%zu), lastEventCount (%zu) Dropping %s !",
+                "Too many messages in queue (%zu), dropped (%zu), lastEventCount (%zu) Dropping %s ! (high water mark %zu)",
                 queueSize,
-                m_dropCount, m_lastEventCount, m_lastEvent.c_str());
+                dropCount, lastEventCount, lastEvent.c_str(),
+                m_highWaterMark.load());
     }
-
-    return false;
 }
 
 bool NotificationQueue::tryDequeue(
         _Out_ swss::KeyOpFieldsValuesTuple& item)
 {
-    MUTEX;
-
     SWSS_LOG_ENTER();
 
+    if (m_ring)
+    {
+        if (m_ring->tryDequeue(item))
+        {
+            return true;
+        }
+
+        if (m_ringOverflowSize.load() == 0)
+        {
+            return false;
+        }
+    }
+
+    MUTEX;
+
     if (m_queue->empty())
     {
         return false;
     }
 
-    item = m_queue->front();
+    item = std::move(m_queue->front());
+
+    m_queue->pop_front();
+
+    m_frontSequence++;
 
-    m_queue->pop();
+    if (m_ring)
+    {
+        m_ringOverflowSize--;
+    }
 
     if (m_queue->empty())
     {
@@ -143,7 +379,9 @@ bool NotificationQueue::tryDequeue(
          */
         m_queue = nullptr;
 
-        m_queue = std::make_shared<std::queue<swss::KeyOpFieldsValuesTuple>>();
+        m_queue = std::make_shared<std::deque<swss::KeyOpFieldsValuesTuple>>();
+
+        m_fdbIndex.clear();
     }
 
     return true;
@@ -151,9 +389,42 @@ bool NotificationQueue::tryDequeue(
 
 size_t NotificationQueue::getQueueSize()
 {
+    SWSS_LOG_ENTER();
+
+    if (m_ring)
+    {
+        return m_ring->size() + m_ringOverflowSize.load();
+    }
+
     MUTEX;
 
+    return m_queue->size();
+}
+
+size_t NotificationQueue::getDropCount() const
+{
     SWSS_LOG_ENTER();
 
-    return m_queue->size();
+    return m_dropCount;
+}
+
+size_t NotificationQueue::getHighWaterMark() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_highWaterMark;
+}
+
+bool NotificationQueue::isLockFree() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_ring != nullptr;
+}
+
+size_t NotificationQueue::getCoalescedCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_coalescedCount;
 }
@@ -5,11 +5,15 @@ extern "C" {
 #include <saimetadata.h>
 }
 
+#include "meta/MpscRingBuffer.h"
+
 #include "swss/table.h"
 
-#include <queue>
+#include <deque>
+#include <unordered_map>
 #include <mutex>
 #include <memory>
+#include <atomic>
 
 /**
  * @brief Default notification queue size limit.
@@ -35,9 +39,29 @@ namespace syncd
     {
         public:
 
+            /**
+             * @brief Notification queue constructor.
+             *
+             * @param limit Queue size limit after which events start to drop.
+             * @param consecutiveThresholdLimit Number of consecutive same
+             * events after which non FDB events start to drop when queue
+             * is over limit.
+             * @param ringCapacity When non zero, queue will use lock-free ring
+             * buffer backend with given number of preallocated slots instead
+             * of mutex guarded queue. When ring is full, notifications are
+             * queued on mutex guarded overflow queue, so drop policy is the
+             * same for both backends. Only one thread can dequeue from ring
+             * backend.
+             * @param fdbCoalescing When true, FDB notification for FDB entry
+             * which already has notification waiting in the queue will
+             * replace that notification instead of being queued again. Not
+             * supported by ring backend.
+             */
             NotificationQueue(
                     _In_ size_t limit = DEFAULT_NOTIFICATION_QUEUE_SIZE_LIMIT,
-                    _In_ size_t consecutiveThresholdLimit = DEFAULT_NOTIFICATION_CONSECUTIVE_THRESHOLD);
+                    _In_ size_t consecutiveThresholdLimit = DEFAULT_NOTIFICATION_CONSECUTIVE_THRESHOLD,
+                    _In_ size_t ringCapacity = 0,
+                    _In_ bool fdbCoalescing = false);
 
             virtual ~NotificationQueue();
 
@@ -46,25 +70,110 @@ namespace syncd
             bool enqueue(
                     _In_ const swss::KeyOpFieldsValuesTuple& msg);
 
+            bool enqueue(
+                    _In_ swss::KeyOpFieldsValuesTuple&& msg);
+
             bool tryDequeue(
                     _Out_ swss::KeyOpFieldsValuesTuple& msg);
 
             size_t getQueueSize();
 
+            size_t getDropCount() const;
+
+            /**
+             * @brief Get maximum queue size observed since queue creation.
+             */
+            size_t getHighWaterMark() const;
+
+            bool isLockFree() const;
+
+            /**
+             * @brief Get number of FDB notifications merged into already
+             * queued notification.
+             */
+            size_t getCoalescedCount() const;
+
+        private:
+
+            bool enqueueRing(
+                    _In_ swss::KeyOpFieldsValuesTuple&& msg);
+
+            /**
+             * @brief Try to merge FDB notification into queued one.
+             *
+             * Must be called under mutex.
+             *
+             * @param msg Notification, moved out when merged.
+             * @param fdbEntry Serialized FDB entry of coalescable
+             * notification, or empty string.
+             *
+             * @return True if notification was merged and should not be
+             * queued.
+             */
+            bool tryCoalesceFdb(
+                    _Inout_ swss::KeyOpFieldsValuesTuple& msg,
+                    _Out_ std::string& fdbEntry);
+
+            void updateHighWaterMark(
+                    _In_ size_t queueSize);
+
+            void onDrop(
+                    _In_ size_t queueSize,
+                    _In_ size_t lastEventCount,
+                    _In_ const std::string& lastEvent);
+
         private:
 
             std::mutex m_mutex;
 
-            std::shared_ptr<std::queue<swss::KeyOpFieldsValuesTuple>> m_queue;
+            std::shared_ptr<std::deque<swss::KeyOpFieldsValuesTuple>> m_queue;
 
             size_t m_queueSizeLimit;
 
             size_t m_thresholdLimit;
 
-            size_t m_dropCount;
+            std::atomic<size_t> m_dropCount;
 
             size_t m_lastEventCount;
 
             std::string m_lastEvent;
+
+            std::atomic<size_t> m_highWaterMark;
+
+        private: // FDB coalescing
+
+            bool m_fdbCoalescing;
+
+            /**
+             * @brief Sequence number of notification at the front of the queue.
+             */
+            uint64_t m_frontSequence;
+
+            /**
+             * @brief Map serialized FDB entry to sequence number of queued
+             * notification for that entry.
+             *
+             * Entries are not removed on dequeue, entry with sequence number
+             * lower than front sequence is stale. Map is cleared on each
+             * non coalescable notification, so notifications are never
+             * reordered around FDB flush or other event types.
+             */
+            std::unordered_map<std::string, uint64_t> m_fdbIndex;
+
+            std::atomic<size_t> m_coalescedCount;
+
+        private: // lock-free ring backend
+
+            std::shared_ptr<saimeta::MpscRingBuffer<swss::KeyOpFieldsValuesTuple>> m_ring;
+
+            std::atomic<size_t> m_ringLastEventHash;
+
+            std::atomic<size_t> m_ringLastEventCount;
+
+            /**
+             * @brief Number of notifications in overflow queue (m_queue),
+             * while it's non zero, new notifications are not put on ring.
+             */
+            std::atomic<size_t> m_ringOverflowSize;
     };
 }
@@ -8,6 +8,8 @@
 #include "swss/logger.h"
 #include "swss/redisapi.h"
 
+#include <inttypes.h>
+
 using namespace syncd;
 
 // vid and rid maps contains objects from all switches
@@ -18,10 +20,12 @@ using namespace syncd;
 #define LANES                       "LANES"
 #define HIDDEN                      "HIDDEN"
 #define COLDVIDS                    "COLDVIDS"
+#define DISCOVERY                   "DISCOVERY"
 
 RedisClient::RedisClient(
         _In_ std::shared_ptr<swss::DBConnector> dbAsic):
-    m_dbAsic(dbAsic)
+    m_dbAsic(dbAsic),
+    m_writeBehindMaxDelay(DEFAULT_REDIS_WRITE_BEHIND_MAX_DELAY_MS)
 {
     SWSS_LOG_ENTER();
 
@@ -34,7 +38,100 @@ RedisClient::~RedisClient()
 {
     SWSS_LOG_ENTER();
 
-    // empty
+    try
+    {
+        asicViewBarrier();
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to flush write-behind buffer: %s", e.what());
+    }
+}
+
+void RedisClient::setWriteBehind(
+        _In_ size_t batchSize,
+        _In_ uint64_t maxDelayMs)
+{
+    SWSS_LOG_ENTER();
+
+    asicViewBarrier();
+
+    m_writeBehindMaxDelay = std::chrono::milliseconds(maxDelayMs);
+
+    if (batchSize == 0)
+    {
+        m_writeBehindPipeline = nullptr;
+
+        SWSS_LOG_NOTICE("redis write-behind disabled");
+        return;
+    }
+
+    m_writeBehindPipeline = std::make_shared<swss::RedisPipeline>(m_dbAsic.get(), batchSize);
+
+    SWSS_LOG_NOTICE("redis write-behind enabled, batch size %zu, max delay %" PRIu64 " ms", batchSize, maxDelayMs);
+}
+
+size_t RedisClient::getWriteBehindBufferedCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_writeBehindPipeline ? m_writeBehindPipeline->size() : 0;
+}
+
+void RedisClient::flush()
+{
+    SWSS_LOG_ENTER();
+
+    asicViewBarrier();
+}
+
+void RedisClient::flushExpired()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_writeBehindPipeline && m_writeBehindPipeline->size() &&
+            (std::chrono::steady_clock::now() - m_writeBehindOldest) >= m_writeBehindMaxDelay)
+    {
+        m_writeBehindPipeline->flush();
+    }
+}
+
+void RedisClient::writeBehind(
+        _In_ const swss::RedisCommand& command) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_writeBehindPipeline == nullptr)
+    {
+        swss::RedisReply r(m_dbAsic.get(), command, REDIS_REPLY_INTEGER);
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (m_writeBehindPipeline->size() == 0)
+    {
+        m_writeBehindOldest = now;
+    }
+
+    // pipeline is flushed automatically when it reaches batch size
+
+    m_writeBehindPipeline->push(command, REDIS_REPLY_INTEGER);
+
+    if (m_writeBehindPipeline->size() && (now - m_writeBehindOldest) >= m_writeBehindMaxDelay)
+    {
+        m_writeBehindPipeline->flush();
+    }
+}
+
+void RedisClient::asicViewBarrier() const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_writeBehindPipeline && m_writeBehindPipeline->size())
+    {
+        m_writeBehindPipeline->flush();
+    }
 }
 
 bool RedisClient::isRedisEnabled() const
@@ -227,6 +324,8 @@ void RedisClient::setDummyAsicStateObject(
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     sai_object_type_t objectType = VidManager::objectTypeQuery(objectVid);
 
     std::string strObjectType = sai_serialize_object_type(objectType);
@@ -244,6 +343,8 @@ void RedisClient::setDummyAsicStateObjects(
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     swss::RedisPipeline pipe(m_dbAsic.get(), count);
 
     for (size_t idx = 0; idx < count; idx++)
@@ -407,6 +508,53 @@ std::set<sai_object_id_t> RedisClient::getColdVids(
     return coldVids;
 }
 
+std::string RedisClient::getRedisDiscoveryKey(
+        _In_ sai_object_id_t switchVid) const
+{
+    SWSS_LOG_ENTER();
+
+    // each switch will have it's own discovery cache: DISCOVERY:oid:0xYYYYYYYY
+
+    return (DISCOVERY ":") + sai_serialize_object_id(switchVid);
+}
+
+void RedisClient::saveDiscoveryCache(
+        _In_ sai_object_id_t switchVid,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    auto key = getRedisDiscoveryKey(switchVid);
+
+    m_dbAsic->del(key);
+
+    std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> hash;
+
+    hash[key] = values;
+
+    m_dbAsic->hmset(hash);
+}
+
+std::unordered_map<std::string, std::string> RedisClient::getDiscoveryCache(
+        _In_ sai_object_id_t switchVid)
+{
+    SWSS_LOG_ENTER();
+
+    auto key = getRedisDiscoveryKey(switchVid);
+
+    return m_dbAsic->hgetall(key);
+}
+
+void RedisClient::removeDiscoveryCache(
+        _In_ sai_object_id_t switchVid)
+{
+    SWSS_LOG_ENTER();
+
+    auto key = getRedisDiscoveryKey(switchVid);
+
+    m_dbAsic->del(key);
+}
+
 void RedisClient::setPortLanes(
         _In_ sai_object_id_t switchVid,
         _In_ sai_object_id_t portRid,
@@ -430,6 +578,8 @@ size_t RedisClient::getAsicObjectsSize(
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     // NOTE: this goes over all objects, and if we have N switches then it will
     // go N times on every switch and it can be slow, we need to find better
     // way to do this
@@ -500,7 +650,9 @@ void RedisClient::removeAsicObject(
 
     SWSS_LOG_INFO("removing ASIC DB key: %s", key.c_str());
 
-    m_dbAsic->del(key);
+    swss::RedisCommand del;
+    del.formatDEL(key);
+    writeBehind(del);
 }
 
 void RedisClient::removeAsicObject(
@@ -510,7 +662,9 @@ void RedisClient::removeAsicObject(
 
     std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
-    m_dbAsic->del(key);
+    swss::RedisCommand del;
+    del.formatDEL(key);
+    writeBehind(del);
 }
 
 void RedisClient::removeTempAsicObject(
@@ -520,7 +674,9 @@ void RedisClient::removeTempAsicObject(
 
     std::string key = (TEMP_PREFIX ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
-    m_dbAsic->del(key);
+    swss::RedisCommand del;
+    del.formatDEL(key);
+    writeBehind(del);
 }
 
 void RedisClient::removeAsicObjects(
@@ -528,6 +684,8 @@ void RedisClient::removeAsicObjects(
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     std::vector<std::string> prefixKeys;
 
     // we need to rewrite keys to add table prefix
@@ -544,6 +702,8 @@ void RedisClient::removeTempAsicObjects(
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     std::vector<std::string> prefixKeys;
 
     // we need to rewrite keys to add table prefix
@@ -564,7 +724,9 @@ void RedisClient::setAsicObject(
 
     std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
-    m_dbAsic->hset(key, attr, value);
+    swss::RedisCommand hset;
+    hset.formatHSET(key, attr, value);
+    writeBehind(hset);
 }
 
 void RedisClient::setTempAsicObject(
@@ -576,7 +738,9 @@ void RedisClient::setTempAsicObject(
 
     std::string key = (TEMP_PREFIX ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
-    m_dbAsic->hset(key, attr, value);
+    swss::RedisCommand hset;
+    hset.formatHSET(key, attr, value);
+    writeBehind(hset);
 }
 
 void RedisClient::createAsicObject(
@@ -587,16 +751,18 @@ void RedisClient::createAsicObject(
 
     std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
+    swss::RedisCommand hset;
+
     if (attrs.size() == 0)
     {
-        m_dbAsic->hset(key, "NULL", "NULL");
-        return;
+        hset.formatHSET(key, "NULL", "NULL");
     }
-
-    for (const auto& e: attrs)
+    else
     {
-        m_dbAsic->hset(key, fvField(e), fvValue(e));
+        hset.formatHSET(key, attrs.begin(), attrs.end());
     }
+
+    writeBehind(hset);
 }
 
 void RedisClient::createTempAsicObject(
@@ -607,16 +773,18 @@ void RedisClient::createTempAsicObject(
 
     std::string key = (TEMP_PREFIX ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
+    swss::RedisCommand hset;
+
     if (attrs.size() == 0)
     {
-        m_dbAsic->hset(key, "NULL", "NULL");
-        return;
+        hset.formatHSET(key, "NULL", "NULL");
     }
-
-    for (const auto& e: attrs)
+    else
     {
-        m_dbAsic->hset(key, fvField(e), fvValue(e));
+        hset.formatHSET(key, attrs.begin(), attrs.end());
     }
+
+    writeBehind(hset);
 }
 
 void RedisClient::createAsicObjects(
@@ -624,6 +792,8 @@ void RedisClient::createAsicObjects(
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> hash;
 
     // we need to rewrite hash to add table prefix
@@ -645,6 +815,8 @@ void RedisClient::createTempAsicObjects(
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> hash;
 
     // we need to rewrite hash to add table prefix
@@ -683,6 +855,8 @@ std::vector<std::string> RedisClient::getAsicStateKeys() const
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     return m_dbAsic->keys(ASIC_STATE_TABLE ":*");
 }
 
@@ -690,6 +864,8 @@ std::vector<std::string> RedisClient::getAsicStateSwitchesKeys() const
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     return m_dbAsic->keys(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_SWITCH:*");
 }
 
@@ -710,6 +886,8 @@ std::unordered_map<std::string, std::string> RedisClient::getAttributesFromAsicK
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     std::unordered_map<std::string, std::string> map;
     m_dbAsic->hgetall(key, std::inserter(map, map.end()));
     return map;
@@ -887,6 +1065,8 @@ void RedisClient::removeAsicStateTable()
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     const auto &asicStateKeys = m_dbAsic->keys(ASIC_STATE_TABLE ":*");
 
     for (const auto &key: asicStateKeys)
@@ -899,6 +1079,8 @@ void RedisClient::removeTempAsicStateTable()
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     const auto &tempAsicStateKeys = m_dbAsic->keys(TEMP_PREFIX ASIC_STATE_TABLE ":*");
 
     for (const auto &key: tempAsicStateKeys)
@@ -926,6 +1108,8 @@ std::map<sai_object_id_t, swss::TableDump> RedisClient::getAsicView(
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     SWSS_LOG_TIMER("get asic view from %s", tableName.c_str());
 
     swss::Table table(m_dbAsic.get(), tableName);
@@ -967,6 +1151,8 @@ void RedisClient::processFlushEvent(
 {
     SWSS_LOG_ENTER();
 
+    asicViewBarrier();
+
     // TODO this must be per switch if we will have multiple switches, needs to be filtered by switch ID also
 
     /*
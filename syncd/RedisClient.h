@@ -3,12 +3,20 @@
 #include "BaseRedisClient.h"
 
 #include "swss/dbconnector.h"
+#include "swss/redispipeline.h"
 
 #include <string>
 #include <unordered_map>
 #include <set>
 #include <memory>
 #include <vector>
+#include <chrono>
+
+/**
+ * @brief Default maximum time ASIC view change can wait in write-behind
+ * buffer before it is flushed to database.
+ */
+#define DEFAULT_REDIS_WRITE_BEHIND_MAX_DELAY_MS (100)
 
 namespace syncd
 {
@@ -21,6 +29,34 @@ namespace syncd
 
             virtual ~RedisClient();
 
+        public:
+
+            /**
+             * @brief Enable write-behind mode.
+             *
+             * When enabled, ASIC_STATE and TEMP ASIC_STATE create, set and
+             * remove operations are buffered in redis pipeline instead of
+             * being executed one by one. Buffer is flushed when it reaches
+             * batch size, when oldest buffered change is older than max
+             * delay, before any other access to ASIC view and on explicit
+             * flush() call.
+             *
+             * @param batchSize Maximum number of buffered commands, zero
+             * disables write-behind mode.
+             * @param maxDelayMs Maximum time in milliseconds change can be
+             * buffered, checked when next change is buffered and on
+             * flushExpired() call.
+             */
+            void setWriteBehind(
+                    _In_ size_t batchSize,
+                    _In_ uint64_t maxDelayMs = DEFAULT_REDIS_WRITE_BEHIND_MAX_DELAY_MS);
+
+            size_t getWriteBehindBufferedCount() const;
+
+            virtual void flush() override;
+
+            virtual void flushExpired() override;
+
         public:
 
             virtual bool isRedisEnabled() const override;
@@ -68,6 +104,16 @@ namespace syncd
             virtual std::set<sai_object_id_t> getColdVids(
                     _In_ sai_object_id_t switchVid) override;
 
+            virtual void saveDiscoveryCache(
+                    _In_ sai_object_id_t switchVid,
+                    _In_ const std::vector<swss::FieldValueTuple>& values) override;
+
+            virtual std::unordered_map<std::string, std::string> getDiscoveryCache(
+                    _In_ sai_object_id_t switchVid) override;
+
+            virtual void removeDiscoveryCache(
+                    _In_ sai_object_id_t switchVid) override;
+
             virtual void setPortLanes(
                     _In_ sai_object_id_t switchVid,
                     _In_ sai_object_id_t portRid,
@@ -186,13 +232,38 @@ namespace syncd
             std::string getRedisHiddenKey(
                     _In_ sai_object_id_t switchVid) const;
 
+            std::string getRedisDiscoveryKey(
+                    _In_ sai_object_id_t switchVid) const;
+
             std::unordered_map<sai_object_id_t, sai_object_id_t> getObjectMap(
                     _In_ const std::string& key) const;
 
+            /**
+             * @brief Execute or buffer ASIC view modification.
+             */
+            void writeBehind(
+                    _In_ const swss::RedisCommand& command) const;
+
+            /**
+             * @brief Flush buffered ASIC view modifications before accessing
+             * ASIC view directly on database connector.
+             */
+            void asicViewBarrier() const;
+
         private:
 
             std::shared_ptr<swss::DBConnector> m_dbAsic;
 
             std::string m_fdbFlushSha;
+
+            /**
+             * @brief Write-behind pipeline, nullptr when write-behind mode is
+             * disabled.
+             */
+            std::shared_ptr<swss::RedisPipeline> m_writeBehindPipeline;
+
+            std::chrono::milliseconds m_writeBehindMaxDelay;
+
+            mutable std::chrono::steady_clock::time_point m_writeBehindOldest;
     };
 }
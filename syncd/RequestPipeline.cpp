@@ -0,0 +1,186 @@
+#include "RequestPipeline.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+PipelineRequest::PipelineRequest(
+        _In_ sai_common_api_t api,
+        _In_ const swss::KeyOpFieldsValuesTuple& kco):
+    m_api(api),
+    m_kco(kco),
+    m_status(SAI_STATUS_NOT_EXECUTED),
+    m_exception(nullptr)
+{
+    SWSS_LOG_ENTER();
+
+    m_metaKey.objecttype = SAI_OBJECT_TYPE_NULL;
+    m_metaKey.objectkey.key.object_id = SAI_NULL_OBJECT_ID;
+}
+
+RequestPipeline::RequestPipeline(
+        _In_ size_t depth,
+        _In_ ExecuteCallback callback):
+    m_depth(depth),
+    m_callback(callback),
+    m_run(true),
+    m_inFlight(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_depth == 0)
+    {
+        SWSS_LOG_THROW("pipeline depth must be positive");
+    }
+
+    if (m_callback == nullptr)
+    {
+        SWSS_LOG_THROW("execute callback can't be nullptr");
+    }
+
+    m_thread = std::make_shared<std::thread>(&RequestPipeline::executeThreadFunction, this);
+
+    SWSS_LOG_NOTICE("request pipeline started with depth %zu", m_depth);
+}
+
+RequestPipeline::~RequestPipeline()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_run = false;
+    }
+
+    m_pendingCv.notify_all();
+
+    m_thread->join();
+}
+
+void RequestPipeline::push(
+        _In_ std::shared_ptr<PipelineRequest> request)
+{
+    SWSS_LOG_ENTER();
+
+    if (request == nullptr)
+    {
+        SWSS_LOG_THROW("request can't be nullptr");
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_spaceCv.wait(lock, [&]{ return m_pending.size() < m_depth; });
+
+    m_pending.push(request);
+
+    m_inFlight++;
+
+    lock.unlock();
+
+    m_pendingCv.notify_one();
+}
+
+std::shared_ptr<PipelineRequest> RequestPipeline::tryPop()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_executed.empty())
+    {
+        return nullptr;
+    }
+
+    auto request = m_executed.front();
+
+    m_executed.pop();
+
+    m_inFlight--;
+
+    return request;
+}
+
+std::shared_ptr<PipelineRequest> RequestPipeline::pop()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (m_inFlight == 0)
+    {
+        return nullptr;
+    }
+
+    m_executedCv.wait(lock, [&]{ return !m_executed.empty(); });
+
+    auto request = m_executed.front();
+
+    m_executed.pop();
+
+    m_inFlight--;
+
+    return request;
+}
+
+size_t RequestPipeline::getInFlightCount()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_inFlight;
+}
+
+size_t RequestPipeline::getDepth() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_depth;
+}
+
+void RequestPipeline::executeThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("starting request pipeline execute thread");
+
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_pendingCv.wait(lock, [&]{ return !m_pending.empty() || !m_run; });
+
+        if (m_pending.empty())
+        {
+            break; // m_run is false and there is nothing more to execute
+        }
+
+        auto request = m_pending.front();
+
+        m_pending.pop();
+
+        lock.unlock();
+
+        m_spaceCv.notify_one();
+
+        try
+        {
+            m_callback(*request);
+        }
+        catch (...)
+        {
+            request->m_exception = std::current_exception();
+        }
+
+        lock.lock();
+
+        m_executed.push(request);
+
+        lock.unlock();
+
+        m_executedCv.notify_one();
+    }
+
+    SWSS_LOG_NOTICE("ending request pipeline execute thread");
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "meta/SaiAttributeList.h"
+
+#include "swss/table.h"
+#include "swss/sal.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+#include <memory>
+#include <functional>
+#include <exception>
+
+namespace syncd
+{
+    /**
+     * @brief Single ASIC request travelling through request pipeline.
+     *
+     * Request is decoded on main thread, executed on pipeline execute thread
+     * and then returned back to main thread to send response and update
+     * redis database.
+     */
+    class PipelineRequest
+    {
+        public:
+
+            PipelineRequest(
+                    _In_ sai_common_api_t api,
+                    _In_ const swss::KeyOpFieldsValuesTuple& kco);
+
+            virtual ~PipelineRequest() = default;
+
+        public:
+
+            sai_common_api_t m_api;
+
+            swss::KeyOpFieldsValuesTuple m_kco;
+
+            sai_object_meta_key_t m_metaKey;
+
+            std::string m_strObjectId;
+
+            std::shared_ptr<saimeta::SaiAttributeList> m_attributes;
+
+            sai_status_t m_status;
+
+            /**
+             * @brief Exception thrown during execute stage.
+             *
+             * Exception will be re-thrown on main thread when request will be
+             * taken out of the pipeline.
+             */
+            std::exception_ptr m_exception;
+    };
+
+    /**
+     * @brief Request pipeline.
+     *
+     * Decouples decode, execute and response stages of ASIC requests, so
+     * vendor SAI call of request N can overlap with decoding of request N+1
+     * and with redis write back of request N-1.
+     *
+     * Execute stage runs on a single dedicated thread, and requests are
+     * executed and returned in the same order as they were pushed, so
+     * ordering of operations on the same object is preserved.
+     */
+    class RequestPipeline
+    {
+        private:
+
+            RequestPipeline(const RequestPipeline&) = delete;
+            RequestPipeline& operator=(const RequestPipeline&) = delete;
+
+        public:
+
+            typedef std::function<void(PipelineRequest&)> ExecuteCallback;
+
+            RequestPipeline(
+                    _In_ size_t depth,
+                    _In_ ExecuteCallback callback);
+
+            virtual ~RequestPipeline();
+
+        public:
+
+            /**
+             * @brief Push request to execute stage.
+             *
+             * Blocks when there are already "depth" requests waiting for
+             * execution.
+             */
+            void push(
+                    _In_ std::shared_ptr<PipelineRequest> request);
+
+            /**
+             * @brief Get next executed request.
+             *
+             * @return Executed request or nullptr if next request in order is
+             * still executing.
+             */
+            std::shared_ptr<PipelineRequest> tryPop();
+
+            /**
+             * @brief Get next executed request.
+             *
+             * Blocks until next request in order will be executed.
+             *
+             * @return Executed request or nullptr if there are no requests
+             * in the pipeline.
+             */
+            std::shared_ptr<PipelineRequest> pop();
+
+            /**
+             * @brief Get number of requests pushed but not yet popped.
+             */
+            size_t getInFlightCount();
+
+            size_t getDepth() const;
+
+        private:
+
+            void executeThreadFunction();
+
+        private:
+
+            size_t m_depth;
+
+            ExecuteCallback m_callback;
+
+            bool m_run;
+
+            size_t m_inFlight;
+
+            std::queue<std::shared_ptr<PipelineRequest>> m_pending;
+
+            std::queue<std::shared_ptr<PipelineRequest>> m_executed;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_pendingCv;
+
+            std::condition_variable m_spaceCv;
+
+            std::condition_variable m_executedCv;
+
+            std::shared_ptr<std::thread> m_thread;
+    };
+}
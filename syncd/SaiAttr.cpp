@@ -3,14 +3,16 @@
 #include "swss/logger.h"
 #include "meta/sai_serialize.h"
 
+#include <unordered_map>
+
 using namespace syncd;
 
 SaiAttr::SaiAttr(
         _In_ const std::string &str_attr_id,
         _In_ const std::string &str_attr_value):
-    m_str_attr_id(str_attr_id),
-    m_str_attr_value(str_attr_value),
-    m_meta(NULL)
+    m_meta(deserializeAttrId(str_attr_id)),
+    m_str_attr_id(getInternedAttrId(m_meta)),
+    m_str_attr_value(str_attr_value)
 {
     SWSS_LOG_ENTER();
 
@@ -20,8 +22,6 @@ SaiAttr::SaiAttr(
      * to free this memory.
      */
 
-    sai_deserialize_attr_id(str_attr_id, &m_meta);
-
     m_attr.id = m_meta->attrid;
 
     sai_deserialize_attr_value(str_attr_value, *m_meta, m_attr, false);
@@ -46,6 +46,46 @@ SaiAttr::SaiAttr(
     }
 }
 
+const sai_attr_metadata_t* SaiAttr::deserializeAttrId(
+        _In_ const std::string &str_attr_id)
+{
+    SWSS_LOG_ENTER();
+
+    const sai_attr_metadata_t* meta = NULL;
+
+    sai_deserialize_attr_id(str_attr_id, &meta);
+
+    return meta;
+}
+
+const std::string& SaiAttr::getInternedAttrId(
+        _In_ const sai_attr_metadata_t* meta)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Attribute ids are bounded by metadata, so each attribute name string is
+     * created only once and shared by all attributes in all views, instead of
+     * having separate copy in each attribute.
+     */
+
+    static const std::unordered_map<const sai_attr_metadata_t*, std::string> names = []() {
+
+        std::unordered_map<const sai_attr_metadata_t*, std::string> map;
+
+        for (size_t idx = 0; idx < sai_metadata_attr_sorted_by_id_name_count; ++idx)
+        {
+            auto md = sai_metadata_attr_sorted_by_id_name[idx];
+
+            map[md] = md->attridname;
+        }
+
+        return map;
+    }();
+
+    return names.at(meta);
+}
+
 SaiAttr::~SaiAttr()
 {
     SWSS_LOG_ENTER();
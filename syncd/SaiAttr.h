@@ -89,12 +89,24 @@ namespace syncd
 
         private:
 
-            const std::string m_str_attr_id;
+            static const sai_attr_metadata_t* deserializeAttrId(
+                    _In_ const std::string &str_attr_id);
 
-            std::string m_str_attr_value;
+            /**
+             * @brief Gets attribute id string shared by all attributes with
+             * the same metadata.
+             */
+            static const std::string& getInternedAttrId(
+                    _In_ const sai_attr_metadata_t* meta);
+
+        private:
 
             const sai_attr_metadata_t* m_meta;
 
+            const std::string& m_str_attr_id;
+
+            std::string m_str_attr_value;
+
             sai_attribute_t m_attr;
     };
 }
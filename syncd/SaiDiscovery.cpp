@@ -5,6 +5,11 @@
 
 #include "meta/sai_serialize.h"
 
+#include <algorithm>
+#include <chrono>
+
+#include <inttypes.h>
+
 using namespace syncd;
 
 /**
@@ -19,11 +24,23 @@ using namespace syncd;
  */
 #define SAI_DISCOVERY_LIST_MAX_ELEMENTS 1024
 
+/**
+ * @def SAI_DISCOVERY_BULK_MAX_OBJECTS
+ *
+ * Defines maximum objects of the same type that will be queried in single
+ * bulk get when performing batched discovery. Each object needs its own list
+ * buffers, so this value limits memory used by single bulk get.
+ */
+#define SAI_DISCOVERY_BULK_MAX_OBJECTS 64
+
 SaiDiscovery::SaiDiscovery(
         _In_ std::shared_ptr<sairedis::SaiInterface> sai,
         _In_ Flags flags):
     m_sai(sai),
-    m_flags(flags)
+    m_flags(flags),
+    m_getCount(0),
+    m_bulkGetCount(0),
+    m_objectTypeQueryCount(0)
 {
     SWSS_LOG_ENTER();
 
@@ -37,6 +54,11 @@ SaiDiscovery::SaiDiscovery(
 
         // TODO check vso for null
 
+        if (vso->m_batchedDiscovery)
+        {
+            m_flags = m_flags | Flags::BatchedAttributes;
+        }
+
         m_attrVersionChecker.enable(vso->m_checkAttrVersion);
         m_attrVersionChecker.setSaiApiVersion(version);
 
@@ -85,6 +107,8 @@ void SaiDiscovery::discover(
         return;
     }
 
+    m_objectTypeQueryCount++;
+
     sai_object_type_t ot = m_sai->objectTypeQuery(rid);
 
     if (ot == SAI_OBJECT_TYPE_NULL)
@@ -128,61 +152,22 @@ void SaiDiscovery::discover(
     {
         const sai_attr_metadata_t *md = info->attrmetadata[idx];
 
-        /*
-         * Note that we don't care about ACL object id's since
-         * we assume that there are no ACLs on switch after init.
-         */
+        if (!isDiscoverableAttribute(md))
+        {
+            continue;
+        }
 
         sai_attribute_t attr;
 
         attr.id = md->attrid;
 
-        if (!m_attrVersionChecker.isSufficientVersion(md))
-        {
-            continue;
-        }
-
         if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
         {
-            if (md->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_CONST)
-            {
-                /*
-                 * This means that default value for this object is
-                 * SAI_NULL_OBJECT_ID, since this is discovery after
-                 * create, we don't need to query this attribute.
-                 */
-
-                if (m_flags & Flags::SkipDefaultEmptyAttributes)
-                {
-                    continue;
-                }
-            }
-
-            if (md->objecttype == SAI_OBJECT_TYPE_STP &&
-                    md->attrid == SAI_STP_ATTR_BRIDGE_ID)
-            {
-                // XXX workaround (for mlnx)
-                SWSS_LOG_WARN("skipping since it causes crash: %s", md->attridname);
-                continue;
-            }
-
-            if (md->objecttype == SAI_OBJECT_TYPE_BRIDGE_PORT)
-            {
-                if (md->attrid == SAI_BRIDGE_PORT_ATTR_TUNNEL_ID ||
-                        md->attrid == SAI_BRIDGE_PORT_ATTR_RIF_ID)
-                {
-                    /*
-                     * We know that bridge port is bound on PORT, no need
-                     * to query those attributes.
-                     */
-
-                    continue;
-                }
-            }
-
             SWSS_LOG_DEBUG("getting %s for %s", md->attridname,
                     sai_serialize_object_id(rid).c_str());
 
+            m_getCount++;
+
             sai_status_t status = m_sai->get(mk.objecttype, mk.objectkey.key.object_id, 1, &attr);
 
             if (status != SAI_STATUS_SUCCESS)
@@ -208,6 +193,8 @@ void SaiDiscovery::discover(
 
             if (attr.value.oid != SAI_NULL_OBJECT_ID)
             {
+                m_objectTypeQueryCount++;
+
                 ot = m_sai->objectTypeQuery(attr.value.oid);
 
                 if (ot == SAI_OBJECT_TYPE_NULL)
@@ -222,22 +209,8 @@ void SaiDiscovery::discover(
 
             discover(attr.value.oid, discovered); // recursion
         }
-        else if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_LIST)
+        else
         {
-            if (md->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_EMPTY_LIST)
-            {
-                /*
-                 * This means that default value for this object is
-                 * empty list, since this is discovery after
-                 * create, we don't need to query this attribute.
-                 */
-
-                if (m_flags & Flags::SkipDefaultEmptyAttributes)
-                {
-                    continue;
-                }
-            }
-
             SWSS_LOG_DEBUG("getting %s for %s", md->attridname,
                     sai_serialize_object_id(rid).c_str());
 
@@ -246,6 +219,8 @@ void SaiDiscovery::discover(
             attr.value.objlist.count = SAI_DISCOVERY_LIST_MAX_ELEMENTS;
             attr.value.objlist.list = local;
 
+            m_getCount++;
+
             sai_status_t status = m_sai->get(mk.objecttype, mk.objectkey.key.object_id, 1, &attr);
 
             if (status != SAI_STATUS_SUCCESS)
@@ -268,6 +243,8 @@ void SaiDiscovery::discover(
             {
                 sai_object_id_t oid = attr.value.objlist.list[i];
 
+                m_objectTypeQueryCount++;
+
                 ot = m_sai->objectTypeQuery(oid);
 
                 if (ot == SAI_OBJECT_TYPE_NULL)
@@ -285,6 +262,380 @@ void SaiDiscovery::discover(
     }
 }
 
+bool SaiDiscovery::isDiscoverableAttribute(
+        _In_ const sai_attr_metadata_t *md)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Note that we don't care about ACL object id's since
+     * we assume that there are no ACLs on switch after init.
+     */
+
+    if (!m_attrVersionChecker.isSufficientVersion(md))
+    {
+        return false;
+    }
+
+    if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
+    {
+        if (md->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_CONST)
+        {
+            /*
+             * This means that default value for this object is
+             * SAI_NULL_OBJECT_ID, since this is discovery after
+             * create, we don't need to query this attribute.
+             */
+
+            if (m_flags & Flags::SkipDefaultEmptyAttributes)
+            {
+                return false;
+            }
+        }
+
+        if (md->objecttype == SAI_OBJECT_TYPE_STP &&
+                md->attrid == SAI_STP_ATTR_BRIDGE_ID)
+        {
+            // XXX workaround (for mlnx)
+            SWSS_LOG_WARN("skipping since it causes crash: %s", md->attridname);
+            return false;
+        }
+
+        if (md->objecttype == SAI_OBJECT_TYPE_BRIDGE_PORT)
+        {
+            if (md->attrid == SAI_BRIDGE_PORT_ATTR_TUNNEL_ID ||
+                    md->attrid == SAI_BRIDGE_PORT_ATTR_RIF_ID)
+            {
+                /*
+                 * We know that bridge port is bound on PORT, no need
+                 * to query those attributes.
+                 */
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_LIST)
+    {
+        if (md->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_EMPTY_LIST)
+        {
+            /*
+             * This means that default value for this object is
+             * empty list, since this is discovery after
+             * create, we don't need to query this attribute.
+             */
+
+            if (m_flags & Flags::SkipDefaultEmptyAttributes)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+const std::vector<const sai_attr_metadata_t*>& SaiDiscovery::getDiscoverableAttributes(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_discoverableAttributes.find(objectType);
+
+    if (it != m_discoverableAttributes.end())
+    {
+        return it->second;
+    }
+
+    auto& mds = m_discoverableAttributes[objectType];
+
+    const sai_object_type_info_t *info = sai_metadata_get_object_type_info(objectType);
+
+    for (int idx = 0; info->attrmetadata[idx] != NULL; ++idx)
+    {
+        if (isDiscoverableAttribute(info->attrmetadata[idx]))
+        {
+            mds.push_back(info->attrmetadata[idx]);
+        }
+    }
+
+    return mds;
+}
+
+void SaiDiscovery::prepareAttributes(
+        _In_ const std::vector<const sai_attr_metadata_t*>& mds,
+        _Out_ std::vector<sai_attribute_t>& attrs,
+        _Out_ std::vector<sai_object_id_t>& lists)
+{
+    SWSS_LOG_ENTER();
+
+    size_t listCount = 0;
+
+    for (auto md: mds)
+    {
+        if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_LIST)
+        {
+            listCount++;
+        }
+    }
+
+    attrs.resize(mds.size());
+
+    lists.resize(listCount * SAI_DISCOVERY_LIST_MAX_ELEMENTS);
+
+    size_t listIdx = 0;
+
+    for (size_t idx = 0; idx < mds.size(); idx++)
+    {
+        attrs[idx].id = mds[idx]->attrid;
+
+        if (mds[idx]->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_LIST)
+        {
+            attrs[idx].value.objlist.count = SAI_DISCOVERY_LIST_MAX_ELEMENTS;
+            attrs[idx].value.objlist.list = lists.data() + SAI_DISCOVERY_LIST_MAX_ELEMENTS * listIdx++;
+        }
+        else
+        {
+            attrs[idx].value.oid = SAI_NULL_OBJECT_ID;
+        }
+    }
+}
+
+void SaiDiscovery::enqueue(
+        _In_ const sai_attr_metadata_t *md,
+        _In_ sai_object_id_t rid,
+        _In_ sai_object_id_t oid,
+        _Inout_ std::set<sai_object_id_t> &discovered,
+        _Inout_ std::set<sai_object_id_t> &visited,
+        _Inout_ std::map<sai_object_type_t, std::vector<sai_object_id_t>> &pending)
+{
+    SWSS_LOG_ENTER();
+
+    if (visited.find(oid) != visited.end())
+    {
+        return;
+    }
+
+    m_objectTypeQueryCount++;
+
+    sai_object_type_t ot = m_sai->objectTypeQuery(oid);
+
+    if (ot == SAI_OBJECT_TYPE_NULL)
+    {
+        if (md == NULL)
+        {
+            SWSS_LOG_THROW("objectTypeQuery: rid %s returned NULL object type",
+                    sai_serialize_object_id(oid).c_str());
+        }
+
+        SWSS_LOG_THROW("when query %s (on %s RID %s) got value %s objectTypeQuery returned NULL object type",
+                md->attridname,
+                sai_serialize_object_type(md->objecttype).c_str(),
+                sai_serialize_object_id(rid).c_str(),
+                sai_serialize_object_id(oid).c_str());
+    }
+
+    visited.insert(oid);
+
+    // XXX workaround, see recursive discover
+
+    if (ot != SAI_OBJECT_TYPE_STP_PORT)
+    {
+        discovered.insert(oid);
+    }
+
+    pending[ot].push_back(oid);
+}
+
+void SaiDiscovery::processAttribute(
+        _In_ const sai_attr_metadata_t *md,
+        _In_ sai_object_id_t rid,
+        _In_ const sai_attribute_t &attr,
+        _Inout_ std::set<sai_object_id_t> &discovered,
+        _Inout_ std::set<sai_object_id_t> &visited,
+        _Inout_ std::map<sai_object_type_t, std::vector<sai_object_id_t>> &pending)
+{
+    SWSS_LOG_ENTER();
+
+    if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
+    {
+        m_defaultOidMap[rid][attr.id] = attr.value.oid;
+
+        if (attr.value.oid != SAI_NULL_OBJECT_ID)
+        {
+            enqueue(md, rid, attr.value.oid, discovered, visited, pending);
+        }
+
+        return;
+    }
+
+    SWSS_LOG_DEBUG("list count %s %u", md->attridname, attr.value.objlist.count);
+
+    for (uint32_t i = 0; i < attr.value.objlist.count; ++i)
+    {
+        enqueue(md, rid, attr.value.objlist.list[i], discovered, visited, pending);
+    }
+}
+
+void SaiDiscovery::discoverBatched(
+        _In_ size_t count,
+        _In_ const sai_object_id_t* rids,
+        _Inout_ std::set<sai_object_id_t> &discovered)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Objects can be reached from multiple objects, visited set contains also
+     * STP ports which are not inserted to discovered set.
+     */
+
+    std::set<sai_object_id_t> visited;
+
+    std::map<sai_object_type_t, std::vector<sai_object_id_t>> pending;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        if (rids[idx] != SAI_NULL_OBJECT_ID)
+        {
+            enqueue(NULL, SAI_NULL_OBJECT_ID, rids[idx], discovered, visited, pending);
+        }
+    }
+
+    while (pending.size())
+    {
+        std::map<sai_object_type_t, std::vector<sai_object_id_t>> level;
+
+        level.swap(pending);
+
+        for (auto& kvp: level)
+        {
+            discoverBatched(kvp.first, kvp.second, discovered, visited, pending);
+        }
+    }
+}
+
+void SaiDiscovery::discoverBatched(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<sai_object_id_t>& rids,
+        _Inout_ std::set<sai_object_id_t> &discovered,
+        _Inout_ std::set<sai_object_id_t> &visited,
+        _Inout_ std::map<sai_object_type_t, std::vector<sai_object_id_t>> &pending)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& mds = getDiscoverableAttributes(objectType);
+
+    if (mds.empty())
+    {
+        return;
+    }
+
+    for (size_t offset = 0; offset < rids.size(); offset += SAI_DISCOVERY_BULK_MAX_OBJECTS)
+    {
+        size_t count = std::min(rids.size() - offset, (size_t)SAI_DISCOVERY_BULK_MAX_OBJECTS);
+
+        std::vector<std::vector<sai_attribute_t>> attrs(count);
+        std::vector<std::vector<sai_object_id_t>> lists(count);
+
+        std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            prepareAttributes(mds, attrs[idx], lists[idx]);
+        }
+
+        if (count > 1 && m_bulkGetUnsupported.find(objectType) == m_bulkGetUnsupported.end())
+        {
+            std::vector<uint32_t> attrCounts(count, (uint32_t)mds.size());
+            std::vector<sai_attribute_t*> attrLists;
+
+            for (auto& a: attrs)
+            {
+                attrLists.push_back(a.data());
+            }
+
+            m_bulkGetCount++;
+
+            sai_status_t status = m_sai->bulkGet(
+                    objectType,
+                    (uint32_t)count,
+                    rids.data() + offset,
+                    attrCounts.data(),
+                    attrLists.data(),
+                    SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                    statuses.data());
+
+            if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+            {
+                SWSS_LOG_INFO("bulk get not supported on %s, using get",
+                        sai_serialize_object_type(objectType).c_str());
+
+                m_bulkGetUnsupported.insert(objectType);
+
+                std::fill(statuses.begin(), statuses.end(), SAI_STATUS_NOT_EXECUTED);
+            }
+        }
+
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            sai_object_id_t rid = rids[offset + idx];
+
+            if (statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                // bulk get was not executed or failed on this object
+
+                prepareAttributes(mds, attrs[idx], lists[idx]);
+
+                m_getCount++;
+
+                statuses[idx] = m_sai->get(objectType, rid, (uint32_t)mds.size(), attrs[idx].data());
+            }
+
+            if (statuses[idx] == SAI_STATUS_SUCCESS)
+            {
+                for (size_t i = 0; i < mds.size(); i++)
+                {
+                    processAttribute(mds[i], rid, attrs[idx][i], discovered, visited, pending);
+                }
+
+                continue;
+            }
+
+            // some attribute failed, query each attribute separately
+
+            prepareAttributes(mds, attrs[idx], lists[idx]);
+
+            for (size_t i = 0; i < mds.size(); i++)
+            {
+                m_getCount++;
+
+                sai_status_t status = m_sai->get(objectType, rid, 1, &attrs[idx][i]);
+
+                if (status != SAI_STATUS_SUCCESS)
+                {
+                    /*
+                     * We failed to get value, maybe it's not supported ?
+                     */
+
+                    SWSS_LOG_INFO("%s: %s on %s",
+                            mds[i]->attridname,
+                            sai_serialize_status(status).c_str(),
+                            sai_serialize_object_id(rid).c_str());
+
+                    continue;
+                }
+
+                processAttribute(mds[i], rid, attrs[idx][i], discovered, visited, pending);
+            }
+        }
+    }
+}
+
 std::set<sai_object_id_t> SaiDiscovery::discover(
         _In_ sai_object_id_t startRid)
 {
@@ -308,23 +659,45 @@ std::set<sai_object_id_t> SaiDiscovery::discover(
 
     m_attrVersionChecker.reset();
 
+    m_discoverableAttributes.clear();
+
+    m_getCount = 0;
+    m_bulkGetCount = 0;
+    m_objectTypeQueryCount = 0;
+
     std::set<sai_object_id_t> discovered_rids;
 
-    {
-        SWSS_LOG_TIMER("discover");
+    auto start = std::chrono::steady_clock::now();
 
+    {
         auto levels = getApiLogLevel();
 
         setApiLogLevel(SAI_LOG_LEVEL_CRITICAL);
 
-        for (size_t idx = 0; idx < count; idx++)
+        if (m_flags & Flags::BatchedAttributes)
+        {
+            discoverBatched(count, rids, discovered_rids);
+        }
+        else
         {
-            discover(rids[idx], discovered_rids);
+            for (size_t idx = 0; idx < count; idx++)
+            {
+                discover(rids[idx], discovered_rids);
+            }
         }
 
         setApiLogLevel(levels);
     }
 
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    SWSS_LOG_NOTICE("discover (%s) took %ld ms, get calls: %" PRIu64 ", bulk get calls: %" PRIu64 ", object type queries: %" PRIu64,
+            (m_flags & Flags::BatchedAttributes) ? "batched" : "recursive",
+            (long)duration.count(),
+            m_getCount,
+            m_bulkGetCount,
+            m_objectTypeQueryCount);
+
     SWSS_LOG_NOTICE("discovered objects count: %zu", discovered_rids.size());
 
     std::map<sai_object_type_t, int> map;
@@ -8,6 +8,7 @@
 #include <set>
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 #include "swss/logger.h"
 
@@ -26,6 +27,13 @@ namespace syncd
             {
                 None = 0,
                 SkipDefaultEmptyAttributes = 1 << 0,
+
+                /**
+                 * Query all OID attributes of an object in a single get, and
+                 * objects of the same type in a single bulk get, falling back
+                 * to per attribute get on failure.
+                 */
+                BatchedAttributes = 1 << 1,
             };
 
             friend inline Flags operator|(Flags a, Flags b)
@@ -71,6 +79,72 @@ namespace syncd
                     _In_ sai_object_id_t rid,
                     _Inout_ std::set<sai_object_id_t> &processed);
 
+            /**
+             * @brief Discover objects on the switch level by level.
+             *
+             * Objects discovered on the same level are grouped by object type
+             * and their OID attributes are obtained using bulk get, or single
+             * multi attribute get per object if bulk get is not supported.
+             *
+             * @param count Number of objects to discover other objects.
+             * @param rids Objects to discover other objects.
+             * @param processed Set of already processed objects.
+             */
+            void discoverBatched(
+                    _In_ size_t count,
+                    _In_ const sai_object_id_t* rids,
+                    _Inout_ std::set<sai_object_id_t> &processed);
+
+            void discoverBatched(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<sai_object_id_t>& rids,
+                    _Inout_ std::set<sai_object_id_t> &processed,
+                    _Inout_ std::set<sai_object_id_t> &visited,
+                    _Inout_ std::map<sai_object_type_t, std::vector<sai_object_id_t>> &pending);
+
+            /**
+             * @brief Adds object to pending objects if it was not visited yet.
+             *
+             * @param md Attribute metadata in which object was obtained, or
+             * NULL when object is starting object.
+             */
+            void enqueue(
+                    _In_ const sai_attr_metadata_t *md,
+                    _In_ sai_object_id_t rid,
+                    _In_ sai_object_id_t oid,
+                    _Inout_ std::set<sai_object_id_t> &processed,
+                    _Inout_ std::set<sai_object_id_t> &visited,
+                    _Inout_ std::map<sai_object_type_t, std::vector<sai_object_id_t>> &pending);
+
+            void processAttribute(
+                    _In_ const sai_attr_metadata_t *md,
+                    _In_ sai_object_id_t rid,
+                    _In_ const sai_attribute_t &attr,
+                    _Inout_ std::set<sai_object_id_t> &processed,
+                    _Inout_ std::set<sai_object_id_t> &visited,
+                    _Inout_ std::map<sai_object_type_t, std::vector<sai_object_id_t>> &pending);
+
+            /**
+             * @brief Tells whether attribute should be queried during discovery.
+             */
+            bool isDiscoverableAttribute(
+                    _In_ const sai_attr_metadata_t *md);
+
+            /**
+             * @brief Gets discoverable attributes of given object type.
+             */
+            const std::vector<const sai_attr_metadata_t*>& getDiscoverableAttributes(
+                    _In_ sai_object_type_t objectType);
+
+            /**
+             * @brief Prepares attributes for get, object list attributes will
+             * point to given list buffer.
+             */
+            static void prepareAttributes(
+                    _In_ const std::vector<const sai_attr_metadata_t*>& mds,
+                    _Out_ std::vector<sai_attribute_t>& attrs,
+                    _Out_ std::vector<sai_object_id_t>& lists);
+
             void setApiLogLevel(
                     _In_ sai_log_level_t logLevel);
 
@@ -88,5 +162,15 @@ namespace syncd
             DefaultOidMap m_defaultOidMap;
 
             AttrVersionChecker m_attrVersionChecker;
+
+            std::map<sai_object_type_t, std::vector<const sai_attr_metadata_t*>> m_discoverableAttributes;
+
+            std::set<sai_object_type_t> m_bulkGetUnsupported;
+
+            uint64_t m_getCount;
+
+            uint64_t m_bulkGetCount;
+
+            uint64_t m_objectTypeQueryCount;
     };
 }
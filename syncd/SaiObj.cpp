@@ -135,3 +135,22 @@ sai_object_id_t SaiObj::getVid() const
 
     SWSS_LOG_THROW("object %s it not object id type", m_str_object_id.c_str());
 }
+
+const std::string& SaiObj::getStrObjectType() const
+{
+    SWSS_LOG_ENTER();
+
+    static const std::unordered_map<int, std::string> names = []() {
+
+        std::unordered_map<int, std::string> map;
+
+        for (size_t idx = 0; idx < sai_metadata_enum_sai_object_type_t.valuescount; ++idx)
+        {
+            map[sai_metadata_enum_sai_object_type_t.values[idx]] = sai_metadata_enum_sai_object_type_t.valuesnames[idx];
+        }
+
+        return map;
+    }();
+
+    return names.at(m_meta_key.objecttype);
+}
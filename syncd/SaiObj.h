@@ -125,6 +125,15 @@ namespace syncd
 
             sai_object_id_t getVid() const;
 
+            /**
+             * @brief Gets object type as string.
+             *
+             * String is shared by all objects of the same type.
+             *
+             * @return Serialized object type
+             */
+            const std::string& getStrObjectType() const;
+
             /*
              * NOTE: We need dependency tree if we want to remove objects which
              * have reference count not zero. Currently we just iterate on removed
@@ -133,7 +142,6 @@ namespace syncd
 
         public: // TODO to private
 
-            std::string m_str_object_type;
             std::string m_str_object_id;
 
             sai_object_meta_key_t m_meta_key;
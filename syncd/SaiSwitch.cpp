@@ -1,6 +1,8 @@
 #include "SaiSwitch.h"
 #include "VendorSai.h"
 #include "SaiDiscovery.h"
+#include "DiscoveryCache.h"
+#include "VendorSaiOptions.h"
 #include "VidManager.h"
 #include "GlobalSwitchId.h"
 #include "RedisClient.h"
@@ -705,10 +707,68 @@ bool SaiSwitch::isNonRemovableRid(
     return true;
 }
 
+bool SaiSwitch::isDiscoveryCacheEnabled() const
+{
+    SWSS_LOG_ENTER();
+
+    auto vso = std::dynamic_pointer_cast<VendorSaiOptions>(m_vendorSai->getOptions(VendorSaiOptions::OPTIONS_KEY));
+
+    return vso && vso->m_discoveryCache;
+}
+
+bool SaiSwitch::helperLoadDiscoveryCache()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("load discovery cache");
+
+    auto hash = m_client->getDiscoveryCache(m_switch_vid);
+
+    // cache is valid only for boot right after warm shutdown
+
+    m_client->removeDiscoveryCache(m_switch_vid);
+
+    DiscoveryCache cache(m_vendorSai, m_switch_rid, m_hardware_info);
+
+    if (!cache.deserialize(hash, m_discovered_rids, m_defaultOidMap))
+    {
+        SWSS_LOG_NOTICE("discovery cache not usable, performing discovery");
+
+        return false;
+    }
+
+    SWSS_LOG_NOTICE("using discovery cache, %zu discovered objects", m_discovered_rids.size());
+
+    return true;
+}
+
+void SaiSwitch::saveDiscoveryCache()
+{
+    SWSS_LOG_ENTER();
+
+    if (!isDiscoveryCacheEnabled())
+    {
+        return;
+    }
+
+    SWSS_LOG_TIMER("save discovery cache");
+
+    DiscoveryCache cache(m_vendorSai, m_switch_rid, m_hardware_info);
+
+    m_client->saveDiscoveryCache(m_switch_vid, cache.serialize(m_discovered_rids, m_defaultOidMap));
+
+    SWSS_LOG_NOTICE("saved discovery cache with %zu objects", m_discovered_rids.size());
+}
+
 void SaiSwitch::helperDiscover()
 {
     SWSS_LOG_ENTER();
 
+    if (m_warmBoot && isDiscoveryCacheEnabled() && helperLoadDiscoveryCache())
+    {
+        return;
+    }
+
     SaiDiscovery sd(m_vendorSai);
 
     m_discovered_rids = sd.discover(m_switch_rid);
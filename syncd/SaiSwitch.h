@@ -301,6 +301,17 @@ namespace syncd
              */
             void helperDiscover();
 
+            bool isDiscoveryCacheEnabled() const;
+
+            /**
+             * @brief Load discovered objects from snapshot saved on warm shutdown.
+             *
+             * Snapshot is removed from database after loading.
+             *
+             * @return True if snapshot was valid and was loaded.
+             */
+            bool helperLoadDiscoveryCache();
+
             void helperSaveDiscoveredObjectsToRedis();
 
             void helperInternalOids();
@@ -316,6 +327,14 @@ namespace syncd
 
             bool isWarmBoot() const;
 
+            /**
+             * @brief Save discovered objects snapshot to database.
+             *
+             * Should be called on warm shutdown, on next warm boot snapshot
+             * will be used instead of discovery, if discovery cache is enabled.
+             */
+            void saveDiscoveryCache();
+
             void checkWarmBootDiscoveredRids();
 
             sai_switch_type_t getSwitchType() const;
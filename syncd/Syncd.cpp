@@ -14,6 +14,8 @@
 #include "ZeroMQNotificationProducer.h"
 #include "WatchdogScope.h"
 #include "VendorSaiOptions.h"
+#include "MemoryUsage.h"
+#include "IdenticalEntryFilter.h"
 
 #include "sairediscommon.h"
 
@@ -38,6 +40,7 @@
 
 #include <iterator>
 #include <algorithm>
+#include <exception>
 
 #define DEF_SAI_WARM_BOOT_DATA_FILE "/var/warmboot/sai-warmboot.bin"
 #define SAI_FAILURE_DUMP_SCRIPT "/usr/bin/sai_failure_dump.sh"
@@ -115,9 +118,17 @@ Syncd::Syncd(
 
     vso->m_checkAttrVersion = m_commandLineOptions->m_enableAttrVersionCheck;
 
+    vso->m_batchedDiscovery = m_commandLineOptions->m_enableBatchedDiscovery;
+
+    vso->m_discoveryCache = m_commandLineOptions->m_enableDiscoveryCache;
+
     m_vendorSai->setOptions(VendorSaiOptions::OPTIONS_KEY, vso);
 
-    m_manager = std::make_shared<FlexCounterManager>(m_vendorSai, m_contextConfig->m_dbCounters, m_commandLineOptions->m_supportingBulkCounterGroups);
+    m_manager = std::make_shared<FlexCounterManager>(
+            m_vendorSai,
+            m_contextConfig->m_dbCounters,
+            m_commandLineOptions->m_supportingBulkCounterGroups,
+            m_commandLineOptions->m_counterPollWorkers);
 
     loadProfileMap();
 
@@ -159,13 +170,57 @@ Syncd::Syncd(
     if (m_contextConfig->m_zmqEnable && !isVirtualSwitch)
     {
         m_client = std::make_shared<DisabledRedisClient>();
+
+        m_pipelineClient = m_client;
+    }
+    else if (m_commandLineOptions->m_requestPipelineDepth)
+    {
+        /*
+         * When request pipeline is enabled, VID/RID translation is executed on
+         * pipeline thread using m_client, while selectable channel and
+         * response stage are using m_dbAsic on main thread, so we need
+         * separate redis connection here.
+         */
+
+        auto dbAsic = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbAsic, 0);
+
+        auto client = std::make_shared<RedisClient>(dbAsic);
+
+        auto pipelineClient = std::make_shared<RedisClient>(m_dbAsic);
+
+        if (m_enableSyncMode)
+        {
+            client->setWriteBehind(m_commandLineOptions->m_redisWriteBehindBatchSize);
+
+            pipelineClient->setWriteBehind(m_commandLineOptions->m_redisWriteBehindBatchSize);
+        }
+
+        m_client = client;
+
+        m_pipelineClient = pipelineClient;
     }
     else
     {
-        m_client = std::make_shared<RedisClient>(m_dbAsic);
+        auto client = std::make_shared<RedisClient>(m_dbAsic);
+
+        if (m_enableSyncMode)
+        {
+            // in async mode consumer table is modifying ASIC view directly
+
+            client->setWriteBehind(m_commandLineOptions->m_redisWriteBehindBatchSize);
+        }
+
+        m_client = client;
+
+        m_pipelineClient = m_client;
     }
 
-    m_processor = std::make_shared<NotificationProcessor>(m_notifications, m_client, std::bind(&Syncd::syncProcessNotification, this, _1));
+    m_processor = std::make_shared<NotificationProcessor>(
+            m_notifications,
+            m_client,
+            std::bind(&Syncd::syncProcessNotification, this, _1),
+            m_commandLineOptions->m_notificationRingCapacity,
+            m_commandLineOptions->m_enableFdbCoalescing);
     m_handler = std::make_shared<NotificationHandler>(m_processor);
 
     m_sn.onFdbEvent = std::bind(&NotificationHandler::onFdbEvent, m_handler.get(), _1, _2);
@@ -248,6 +303,13 @@ Syncd::Syncd(
 
     m_breakConfig = BreakConfigParser::parseBreakConfig(m_commandLineOptions->m_breakConfig);
 
+    if (m_commandLineOptions->m_requestPipelineDepth)
+    {
+        m_pipeline = std::make_shared<RequestPipeline>(
+                m_commandLineOptions->m_requestPipelineDepth,
+                std::bind(&Syncd::executePipelineRequest, this, _1));
+    }
+
     SWSS_LOG_NOTICE("syncd started");
 }
 
@@ -345,6 +407,16 @@ void Syncd::processEvent(
 
     std::lock_guard<std::mutex> lock(m_mutex);
 
+    if (m_pipeline)
+    {
+        processEventPipelined(consumer);
+
+        flushRedis();
+        return;
+    }
+
+    std::vector<swss::KeyOpFieldsValuesTuple> batch;
+
     do
     {
         swss::KeyOpFieldsValuesTuple kco;
@@ -357,9 +429,490 @@ void Syncd::processEvent(
 
         consumer.pop(kco, isInitViewMode());
 
+        popRequestSequence(kco);
+
+        if (coalesceEvent(batch, kco))
+        {
+            continue;
+        }
+
+        processCoalescedEvents(batch);
+
         processSingleEvent(kco);
     }
     while (!consumer.empty());
+
+    processCoalescedEvents(batch);
+
+    flushRedis();
+}
+
+void Syncd::flushRedis()
+{
+    SWSS_LOG_ENTER();
+
+    m_client->flush();
+
+    if (m_pipelineClient != m_client)
+    {
+        m_pipelineClient->flush();
+    }
+}
+
+void Syncd::flushExpiredRedis()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_client->flushExpired();
+
+    if (m_pipelineClient != m_client)
+    {
+        m_pipelineClient->flushExpired();
+    }
+}
+
+void Syncd::processEventPipelined(
+        _In_ sairedis::SelectableChannel& consumer)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Caller must hold m_mutex. Mutex is held until pipeline is drained, so
+     * notification thread will not use m_client and m_translator while
+     * execute stage is running on pipeline thread.
+     */
+
+    std::vector<swss::KeyOpFieldsValuesTuple> batch;
+
+    try
+    {
+        do
+        {
+            swss::KeyOpFieldsValuesTuple kco;
+
+            consumer.pop(kco, isInitViewMode());
+
+            popRequestSequence(kco);
+
+            if (isCoalescableEvent(kco))
+            {
+                // coalesced events are executed on this thread
+
+                drainPipeline();
+
+                coalesceEvent(batch, kco);
+
+                continue;
+            }
+
+            auto request = decodePipelineRequest(kco);
+
+            if (request == nullptr)
+            {
+                // request can't be pipelined, it acts as a barrier
+
+                drainPipeline();
+
+                processCoalescedEvents(batch);
+
+                processSingleEvent(kco);
+
+                continue;
+            }
+
+            // pipeline is empty when there is pending batch
+
+            processCoalescedEvents(batch);
+
+            m_pipeline->push(request);
+
+            while (auto executed = m_pipeline->tryPop())
+            {
+                completePipelineRequest(*executed);
+            }
+        }
+        while (!consumer.empty());
+
+        drainPipeline();
+
+        processCoalescedEvents(batch);
+    }
+    catch (...)
+    {
+        // make sure nothing is executing when we will leave the mutex
+
+        while (m_pipeline->pop())
+        {
+        }
+
+        throw;
+    }
+}
+
+bool Syncd::isCoalescableEvent(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_commandLineOptions->m_bulkCoalesceLimit == 0 || !m_commandLineOptions->m_enableSaiBulkSupport)
+    {
+        return false;
+    }
+
+    if (isInitViewMode())
+    {
+        return false;
+    }
+
+    auto& op = kfvOp(kco);
+
+    if (op != REDIS_ASIC_STATE_COMMAND_CREATE && op != REDIS_ASIC_STATE_COMMAND_REMOVE)
+    {
+        return false;
+    }
+
+    auto& key = kfvKey(kco);
+
+    auto pos = key.find(":");
+
+    if (pos == std::string::npos)
+    {
+        return false;
+    }
+
+    sai_object_type_t objectType;
+    sai_deserialize_object_type(key.substr(0, pos), objectType);
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    return info && info->isnonobjectid;
+}
+
+bool Syncd::coalesceEvent(
+        _Inout_ std::vector<swss::KeyOpFieldsValuesTuple>& batch,
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    if (!isCoalescableEvent(kco))
+    {
+        return false;
+    }
+
+    if (batch.size())
+    {
+        auto& front = batch.front();
+
+        auto& key = kfvKey(kco);
+        auto& frontKey = kfvKey(front);
+
+        // same operation on the same object type
+
+        bool same = kfvOp(front) == kfvOp(kco) &&
+            frontKey.compare(0, frontKey.find(":"), key, 0, key.find(":")) == 0;
+
+        if (!same)
+        {
+            processCoalescedEvents(batch);
+        }
+    }
+
+    batch.push_back(kco);
+
+    if (batch.size() >= m_commandLineOptions->m_bulkCoalesceLimit)
+    {
+        processCoalescedEvents(batch);
+    }
+
+    return true;
+}
+
+void Syncd::processCoalescedEvents(
+        _Inout_ std::vector<swss::KeyOpFieldsValuesTuple>& batch)
+{
+    SWSS_LOG_ENTER();
+
+    if (batch.empty())
+    {
+        return;
+    }
+
+    if (batch.size() == 1)
+    {
+        processSingleEvent(batch.front());
+
+        batch.clear();
+
+        return;
+    }
+
+    // move batch out, since processing can throw in async mode
+
+    std::vector<swss::KeyOpFieldsValuesTuple> events;
+
+    events.swap(batch);
+
+    auto& front = events.front();
+
+    const std::string& frontKey = kfvKey(front);
+
+    sai_object_type_t objectType;
+    sai_deserialize_object_type(frontKey.substr(0, frontKey.find(":")), objectType);
+
+    const bool isCreate = kfvOp(front) == REDIS_ASIC_STATE_COMMAND_CREATE;
+
+    sai_common_api_t api = isCreate ? SAI_COMMON_API_CREATE : SAI_COMMON_API_REMOVE;
+    sai_common_api_t bulkApi = isCreate ? SAI_COMMON_API_BULK_CREATE : SAI_COMMON_API_BULK_REMOVE;
+
+    std::vector<std::string> objectIds;
+    std::vector<std::shared_ptr<SaiAttributeList>> attributes;
+    std::vector<std::vector<swss::FieldValueTuple>> strAttributes;
+
+    for (auto& kco: events)
+    {
+        auto& key = kfvKey(kco);
+
+        objectIds.push_back(key.substr(key.find(":") + 1));
+
+        strAttributes.push_back(kfvFieldsValues(kco));
+
+        auto list = std::make_shared<SaiAttributeList>(objectType, kfvFieldsValues(kco), false);
+
+        m_translator->translateVidToRid(objectType, list->get_attr_count(), list->get_attr_list());
+
+        attributes.push_back(list);
+    }
+
+    SWSS_LOG_INFO("coalesced %zu %s %s events into bulk",
+            events.size(),
+            kfvOp(front).c_str(),
+            sai_serialize_object_type(objectType).c_str());
+
+    std::vector<sai_status_t> statuses(events.size());
+
+    sai_status_t all;
+
+    {
+        WatchdogScope ws(m_timerWatchdog, "coalesced " + kfvOp(front) + ":" + sai_serialize_object_type(objectType));
+
+        if (isCreate)
+            all = processBulkCreateEntry(objectType, objectIds, attributes, statuses);
+        else
+            all = processBulkRemoveEntry(objectType, objectIds, statuses);
+    }
+
+    if (all == SAI_STATUS_NOT_SUPPORTED || all == SAI_STATUS_NOT_IMPLEMENTED)
+    {
+        SWSS_LOG_INFO("vendor bulk not supported for %s, executing one by one",
+                sai_serialize_object_type(objectType).c_str());
+
+        // execute all events, even if one of them failed
+
+        std::exception_ptr failure;
+
+        for (auto& kco: events)
+        {
+            try
+            {
+                processSingleEvent(kco);
+            }
+            catch (const std::exception&)
+            {
+                if (!failure)
+                {
+                    failure = std::current_exception();
+                }
+            }
+        }
+
+        if (failure)
+        {
+            std::rethrow_exception(failure);
+        }
+
+        return;
+    }
+
+    // split bulk statuses back into per request responses
+
+    size_t failedIndex = events.size();
+
+    for (size_t idx = 0; idx < events.size(); idx++)
+    {
+        sai_status_t status = statuses[idx];
+
+        sendApiResponse(api, status);
+
+        if (status == SAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        for (const auto &v: kfvFieldsValues(events[idx]))
+        {
+            SWSS_LOG_ERROR("attr: %s: %s", fvField(v).c_str(), fvValue(v).c_str());
+        }
+
+        if (failedIndex == events.size())
+        {
+            failedIndex = idx;
+        }
+    }
+
+    // successful entries are written even if some entries failed
+
+    syncUpdateRedisBulkQuadEvent(bulkApi, statuses, objectType, objectIds, strAttributes);
+
+    if (failedIndex != events.size() && !m_enableSyncMode)
+    {
+        // throw only when sync mode is not enabled
+
+        auto& kco = events[failedIndex];
+
+        SWSS_LOG_THROW("failed to execute api: %s, key: %s, status: %s",
+                kfvOp(kco).c_str(),
+                kfvKey(kco).c_str(),
+                sai_serialize_status(statuses[failedIndex]).c_str());
+    }
+}
+
+std::shared_ptr<PipelineRequest> Syncd::decodePipelineRequest(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    auto& key = kfvKey(kco);
+    auto& op = kfvOp(kco);
+
+    if (key.length() == 0 || isInitViewMode())
+    {
+        return nullptr;
+    }
+
+    sai_common_api_t api;
+
+    if (op == REDIS_ASIC_STATE_COMMAND_CREATE)
+        api = SAI_COMMON_API_CREATE;
+    else if (op == REDIS_ASIC_STATE_COMMAND_REMOVE)
+        api = SAI_COMMON_API_REMOVE;
+    else if (op == REDIS_ASIC_STATE_COMMAND_SET)
+        api = SAI_COMMON_API_SET;
+    else
+        return nullptr;
+
+    sai_object_meta_key_t metaKey;
+    sai_deserialize_object_meta_key(key, metaKey);
+
+    if (!sai_metadata_is_object_type_valid(metaKey.objecttype))
+    {
+        return nullptr;
+    }
+
+    switch (metaKey.objecttype)
+    {
+        case SAI_OBJECT_TYPE_SWITCH:
+        case SAI_OBJECT_TYPE_PORT:
+
+            // those objects are modifying switch state, process them serially
+
+            return nullptr;
+
+        default:
+            break;
+    }
+
+    auto request = std::make_shared<PipelineRequest>(api, kco);
+
+    request->m_metaKey = metaKey;
+    request->m_strObjectId = key.substr(key.find(":") + 1);
+    request->m_attributes = std::make_shared<SaiAttributeList>(metaKey.objecttype, kfvFieldsValues(kco), false);
+
+    return request;
+}
+
+void Syncd::executePipelineRequest(
+        _Inout_ PipelineRequest& request)
+{
+    SWSS_LOG_ENTER();
+
+    auto& kco = request.m_kco;
+
+    WatchdogScope ws(m_timerWatchdog, kfvOp(kco) + ":" + kfvKey(kco), &kco);
+
+    sai_attribute_t *attr_list = request.m_attributes->get_attr_list();
+    uint32_t attr_count = request.m_attributes->get_attr_count();
+
+    m_translator->translateVidToRid(request.m_metaKey.objecttype, attr_count, attr_list);
+
+    auto info = sai_metadata_get_object_type_info(request.m_metaKey.objecttype);
+
+    if (info->isnonobjectid)
+    {
+        request.m_status = processEntry(request.m_metaKey, request.m_api, attr_count, attr_list);
+    }
+    else
+    {
+        request.m_status = processOid(request.m_metaKey.objecttype, request.m_strObjectId, request.m_api, attr_count, attr_list);
+    }
+
+    if (request.m_status != SAI_STATUS_SUCCESS && info->isobjectid && request.m_api == SAI_COMMON_API_SET)
+    {
+        // translator can only be used on this thread
+
+        sai_object_id_t vid = request.m_metaKey.objectkey.key.object_id;
+        sai_object_id_t rid = m_translator->translateVidToRid(vid);
+
+        SWSS_LOG_ERROR("VID: %s RID: %s",
+                sai_serialize_object_id(vid).c_str(),
+                sai_serialize_object_id(rid).c_str());
+    }
+}
+
+void Syncd::completePipelineRequest(
+        _In_ const PipelineRequest& request)
+{
+    SWSS_LOG_ENTER();
+
+    if (request.m_exception)
+    {
+        std::rethrow_exception(request.m_exception);
+    }
+
+    auto& kco = request.m_kco;
+
+    sendApiResponse(request.m_api, request.m_status);
+
+    if (request.m_status != SAI_STATUS_SUCCESS)
+    {
+        for (const auto &v: kfvFieldsValues(kco))
+        {
+            SWSS_LOG_ERROR("attr: %s: %s", fvField(v).c_str(), fvValue(v).c_str());
+        }
+
+        if (!m_enableSyncMode)
+        {
+            // throw only when sync mode is not enabled
+
+            SWSS_LOG_THROW("failed to execute api: %s, key: %s, status: %s",
+                    kfvOp(kco).c_str(),
+                    kfvKey(kco).c_str(),
+                    sai_serialize_status(request.m_status).c_str());
+        }
+    }
+
+    syncUpdateRedisQuadEvent(request.m_status, request.m_api, kco, *m_pipelineClient);
+}
+
+void Syncd::drainPipeline()
+{
+    SWSS_LOG_ENTER();
+
+    while (auto executed = m_pipeline->pop())
+    {
+        completePipelineRequest(*executed);
+    }
 }
 
 sai_status_t Syncd::processSingleEvent(
@@ -452,6 +1005,22 @@ sai_status_t Syncd::processAttrCapabilityQuery(
 {
     SWSS_LOG_ENTER();
 
+    auto& values = kfvFieldsValues(kco);
+
+    if (values.size() == 1 && fvField(values[0]) == REDIS_ASIC_STATE_SYNC_WINDOW_HANDSHAKE_FIELD)
+    {
+        // client asks if windowed requests are supported, responses carry
+        // request sequence only in sync mode
+
+        sai_status_t status = m_enableSyncMode ? SAI_STATUS_SUCCESS : SAI_STATUS_NOT_SUPPORTED;
+
+        SWSS_LOG_NOTICE("sync window handshake: %s", sai_serialize_status(status).c_str());
+
+        m_selectableChannel->set(sai_serialize_status(status), values, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
+
+        return status;
+    }
+
     auto& strSwitchVid = kfvKey(kco);
 
     sai_object_id_t switchVid;
@@ -459,8 +1028,6 @@ sai_status_t Syncd::processAttrCapabilityQuery(
 
     sai_object_id_t switchRid = m_translator->translateVidToRid(switchVid);
 
-    auto& values = kfvFieldsValues(kco);
-
     if (values.size() != 2)
     {
         SWSS_LOG_ERROR("Invalid input: expected 2 arguments, received %zu", values.size());
@@ -2988,6 +3555,28 @@ sai_status_t Syncd::processQuadInInitViewModeGet(
     return status;
 }
 
+void Syncd::popRequestSequence(
+        _Inout_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    auto& values = kfvFieldsValues(kco);
+
+    // sequence is always added as last field
+
+    if (values.empty() || fvField(values.back()) != REDIS_ASIC_STATE_SEQUENCE_FIELD)
+    {
+        return;
+    }
+
+    if (m_enableSyncMode)
+    {
+        m_responseSequences.push_back(fvValue(values.back()));
+    }
+
+    values.pop_back();
+}
+
 void Syncd::sendApiResponse(
         _In_ sai_common_api_t api,
         _In_ sai_status_t status,
@@ -3039,6 +3628,13 @@ void Syncd::sendApiResponse(
         entry.push_back(fvt);
     }
 
+    if (m_responseSequences.size())
+    {
+        entry.emplace_back(REDIS_ASIC_STATE_SEQUENCE_FIELD, m_responseSequences.front());
+
+        m_responseSequences.pop_front();
+    }
+
     std::string strStatus = sai_serialize_status(status);
 
     SWSS_LOG_INFO("sending response for %s api with status: %s",
@@ -3257,6 +3853,17 @@ void Syncd::syncUpdateRedisQuadEvent(
 {
     SWSS_LOG_ENTER();
 
+    syncUpdateRedisQuadEvent(status, api, kco, *m_client);
+}
+
+void Syncd::syncUpdateRedisQuadEvent(
+        _In_ sai_status_t status,
+        _In_ sai_common_api_t api,
+        _In_ const swss::KeyOpFieldsValuesTuple &kco,
+        _In_ BaseRedisClient& client)
+{
+    SWSS_LOG_ENTER();
+
     if (!m_enableSyncMode)
     {
         return;
@@ -3291,9 +3898,9 @@ void Syncd::syncUpdateRedisQuadEvent(
 
             {
                 if (initView)
-                    m_client->createTempAsicObject(metaKey, values);
+                    client.createTempAsicObject(metaKey, values);
                 else
-                    m_client->createAsicObject(metaKey, values);
+                    client.createAsicObject(metaKey, values);
 
                 break;
             }
@@ -3302,9 +3909,9 @@ void Syncd::syncUpdateRedisQuadEvent(
 
             {
                 if (initView)
-                    m_client->removeTempAsicObject(metaKey);
+                    client.removeTempAsicObject(metaKey);
                 else
-                    m_client->removeAsicObject(metaKey);
+                    client.removeAsicObject(metaKey);
 
                 break;
             }
@@ -3318,9 +3925,9 @@ void Syncd::syncUpdateRedisQuadEvent(
                 auto& value = fvValue(first);
 
                 if (initView)
-                    m_client->setTempAsicObject(metaKey, attr, value);
+                    client.setTempAsicObject(metaKey, attr, value);
                 else
-                    m_client->setAsicObject(metaKey, attr, value);
+                    client.setAsicObject(metaKey, attr, value);
 
                 break;
             }
@@ -4703,6 +5310,10 @@ sai_status_t Syncd::applyView()
 
     SWSS_LOG_TIMER("apply");
 
+    // both views must be complete in database before comparison
+
+    flushRedis();
+
     /*
      * We assume that there will be no case that we will move from 1 to 0, also
      * if at the beginning there is no switch, then when user will send create,
@@ -4735,6 +5346,10 @@ sai_status_t Syncd::applyView()
      * sorted.
      */
 
+    bool peakReset = MemoryUsage::resetPeakResidentSetSize();
+
+    SWSS_LOG_NOTICE("memory usage before apply view: RSS %" PRIu64 " kB", MemoryUsage::getResidentSetSize());
+
     // Read current and temporary views from REDIS.
 
     auto currentMap = m_client->getAsicView();
@@ -4775,6 +5390,15 @@ sai_status_t Syncd::applyView()
     std::vector<std::shared_ptr<AsicView>> tempViews;
     std::vector<std::shared_ptr<ComparisonLogic>> cls;
 
+    std::vector<swss::TableDump> identicalEntries;
+
+    std::shared_ptr<WorkerPool> workerPool;
+
+    if (m_commandLineOptions->m_applyViewWorkers)
+    {
+        workerPool = std::make_shared<WorkerPool>(m_commandLineOptions->m_applyViewWorkers);
+    }
+
     try
     {
         for (auto& kvp: m_switches)
@@ -4791,10 +5415,38 @@ sai_status_t Syncd::applyView()
              * Each ASIC view at this point will contain only 1 switch.
              */
 
+            swss::TableDump identical;
+
+            if (m_commandLineOptions->m_enableIdenticalEntryFilter)
+            {
+                // pair identical non object id entries, only residue is compared
+
+                identical = IdenticalEntryFilter::filter(currentMap.at(switchVid), temporaryMap.at(switchVid));
+            }
+
             auto current = std::make_shared<AsicView>(currentMap.at(switchVid));
+
+            // views hold their own copy of data, so release dump right away
+
+            currentMap.erase(switchVid);
+
             auto temp = std::make_shared<AsicView>(temporaryMap.at(switchVid));
 
-            auto cl = std::make_shared<ComparisonLogic>(m_vendorSai, sw, m_handler, m_initViewRemovedVidSet, current, temp, m_breakConfig);
+            temporaryMap.erase(switchVid);
+
+            if (identical.size())
+            {
+                // paired entries still use their object ids
+
+                auto references = IdenticalEntryFilter::getReferences(identical);
+
+                current->bindExternalReferences(references);
+                temp->bindExternalReferences(references);
+            }
+
+            identicalEntries.push_back(std::move(identical));
+
+            auto cl = std::make_shared<ComparisonLogic>(m_vendorSai, sw, m_handler, m_initViewRemovedVidSet, current, temp, m_breakConfig, workerPool);
 
             cl->compareViews();
 
@@ -4820,6 +5472,11 @@ sai_status_t Syncd::applyView()
      * fail, then we will have inconsistent state in ASIC.
      */
 
+    SWSS_LOG_NOTICE("memory usage after views comparison: RSS %" PRIu64 " kB, peak RSS %s %" PRIu64 " kB",
+            MemoryUsage::getResidentSetSize(),
+            peakReset ? "during apply view" : "of process",
+            MemoryUsage::getPeakResidentSetSize());
+
     if (m_commandLineOptions->m_enableUnittests)
     {
         dumpComparisonLogicOutput(currentViews);
@@ -4830,7 +5487,7 @@ sai_status_t Syncd::applyView()
         cl->executeOperationsOnAsic(); // can throw, if so asic will be in inconsistent state
     }
 
-    updateRedisDatabase(tempViews);
+    updateRedisDatabase(tempViews, identicalEntries);
 
     for (auto& cl: cls)
     {
@@ -4903,7 +5560,8 @@ void Syncd::dumpComparisonLogicOutput(
 }
 
 void Syncd::updateRedisDatabase(
-    _In_ const std::vector<std::shared_ptr<AsicView>>& temporaryViews)
+    _In_ const std::vector<std::shared_ptr<AsicView>>& temporaryViews,
+    _In_ const std::vector<swss::TableDump>& identicalEntries)
 {
     SWSS_LOG_ENTER();
 
@@ -4941,6 +5599,23 @@ void Syncd::updateRedisDatabase(
         }
     }
 
+    // entries paired before comparison are not part of views
+
+    for (auto& dump: identicalEntries)
+    {
+        if (dump.empty())
+            continue;
+
+        std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> multiHash;
+
+        for (auto& entry: dump)
+        {
+            multiHash[entry.first].assign(entry.second.begin(), entry.second.end());
+        }
+
+        m_client->createAsicObjects(multiHash);
+    }
+
     /*
      * Remove previous RID2VID maps and apply new map.
      *
@@ -5691,7 +6366,15 @@ void Syncd::syncProcessNotification(
 
     SWSS_LOG_ENTER();
 
+    // notification may modify ASIC view using different redis client
+
+    flushRedis();
+
     m_processor->syncProcessNotification(item);
+
+    // notification processing could buffer ASIC view changes, like FDB entries
+
+    flushRedis();
 }
 
 bool Syncd::isVeryFirstRun()
@@ -5783,13 +6466,28 @@ void Syncd::run()
 
     m_timerWatchdog.setCallback(timerWatchdogCallback);
 
+    /*
+     * When write-behind is enabled, wake up periodically even when there are
+     * no events, so buffered ASIC view changes will not wait longer than max
+     * delay.
+     */
+
+    int selectTimeout = (m_enableSyncMode && m_commandLineOptions->m_redisWriteBehindBatchSize)
+        ? DEFAULT_REDIS_WRITE_BEHIND_MAX_DELAY_MS
+        : -1;
+
     while (runMainLoop)
     {
         try
         {
             swss::Selectable *sel = NULL;
 
-            int result = s->select(&sel);
+            int result = s->select(&sel, selectTimeout);
+
+            if (selectTimeout >= 0)
+            {
+                flushExpiredRedis();
+            }
 
             if (sel == m_restartQuery.get())
             {
@@ -5894,6 +6592,10 @@ void Syncd::run()
             {
                 processEvent(*m_selectableChannel.get());
             }
+            else if (result == swss::Select::TIMEOUT)
+            {
+                // write-behind buffer was already checked
+            }
             else
             {
                 SWSS_LOG_ERROR("select failed: %d", result);
@@ -5919,6 +6621,10 @@ void Syncd::run()
 
     WatchdogScope ws(m_timerWatchdog, "shutting down syncd");
 
+    // make sure ASIC view is complete in database before warm shutdown
+
+    flushRedis();
+
     if (shutdownType == SYNCD_RESTART_TYPE_WARM)
     {
         const char *warmBootWriteFile = profileGetValue(0, SAI_KEY_WARM_BOOT_WRITE_FILE);
@@ -5955,6 +6661,16 @@ void Syncd::run()
         setUninitDataPlaneOnRemovalOnAllSwitches();
     }
 
+    if (shutdownType == SYNCD_RESTART_TYPE_WARM || shutdownType == SYNCD_RESTART_TYPE_EXPRESS)
+    {
+        // next boot can skip discovery if snapshot is still valid
+
+        for (auto& sw: m_switches)
+        {
+            sw.second->saveDiscoveryCache();
+        }
+    }
+
     m_manager->removeAllCounters();
 
     m_mdioIpcServer->stopMdioThread();
@@ -18,6 +18,7 @@
 #include "NotificationProducerBase.h"
 #include "TimerWatchdog.h"
 #include "MdioIpcServer.h"
+#include "RequestPipeline.h"
 
 #include "meta/SaiAttributeList.h"
 #include "meta/SelectableChannel.h"
@@ -27,6 +28,7 @@
 #include "swss/notificationconsumer.h"
 
 #include <memory>
+#include <deque>
 
 namespace syncd
 {
@@ -67,6 +69,9 @@ namespace syncd
             void processEvent(
                     _In_ sairedis::SelectableChannel& consumer);
 
+            void processEventPipelined(
+                    _In_ sairedis::SelectableChannel& consumer);
+
             sai_status_t processQuadEventInInitViewMode(
                     _In_ sai_object_type_t objectType,
                     _In_ const std::string& strObjectId,
@@ -291,6 +296,57 @@ namespace syncd
                     _In_ uint32_t attr_count,
                     _In_ sai_attribute_t *attr_list);
 
+        private: // coalescing single entry events into bulk
+
+            bool isCoalescableEvent(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco) const;
+
+            /**
+             * @brief Add event to coalesced batch.
+             *
+             * If event doesn't match current batch, current batch is processed
+             * first. Batch is also processed when it reaches coalesce limit.
+             *
+             * @return True if event was added to batch, false if event can't
+             * be coalesced and must be processed by caller.
+             */
+            bool coalesceEvent(
+                    _Inout_ std::vector<swss::KeyOpFieldsValuesTuple>& batch,
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
+            void processCoalescedEvents(
+                    _Inout_ std::vector<swss::KeyOpFieldsValuesTuple>& batch);
+
+        private: // request pipeline stages
+
+            /**
+             * @brief Decode request for pipeline.
+             *
+             * @return Decoded request or nullptr if request must be processed
+             * serially, in that case pipeline must be drained first.
+             */
+            std::shared_ptr<PipelineRequest> decodePipelineRequest(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
+            void executePipelineRequest(
+                    _Inout_ PipelineRequest& request);
+
+            void completePipelineRequest(
+                    _In_ const PipelineRequest& request);
+
+            void drainPipeline();
+
+            /**
+             * @brief Flush ASIC view changes buffered by redis clients.
+             */
+            void flushRedis();
+
+            /**
+             * @brief Flush ASIC view changes which exceeded write-behind max
+             * delay, takes API mutex.
+             */
+            void flushExpiredRedis();
+
         private:
 
             void syncUpdateRedisQuadEvent(
@@ -298,6 +354,12 @@ namespace syncd
                     _In_ sai_common_api_t api,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
+            void syncUpdateRedisQuadEvent(
+                    _In_ sai_status_t status,
+                    _In_ sai_common_api_t api,
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco,
+                    _In_ BaseRedisClient& client);
+
             void syncUpdateRedisBulkQuadEvent(
                     _In_ sai_common_api_t api,
                     _In_ const std::vector<sai_status_t>& statuses,
@@ -330,7 +392,8 @@ namespace syncd
                     _In_ const std::vector<std::shared_ptr<AsicView>>& currentViews);
 
             void updateRedisDatabase(
-                    _In_ const std::vector<std::shared_ptr<AsicView>>& temporaryViews);
+                    _In_ const std::vector<std::shared_ptr<AsicView>>& temporaryViews,
+                    _In_ const std::vector<swss::TableDump>& identicalEntries);
 
             std::map<sai_object_id_t, swss::TableDump> redisGetAsicView(
                     _In_ const std::string &tableName);
@@ -370,6 +433,16 @@ namespace syncd
                     _In_ uint32_t object_count = 0,
                     _In_ sai_status_t * object_statuses = NULL);
 
+            /**
+             * @brief Take request sequence number out of request fields.
+             *
+             * Sequence number is sent by sairedis for windowed requests and
+             * is echoed back in next api response, since responses are sent
+             * in the same order as requests are received.
+             */
+            void popRequestSequence(
+                    _Inout_ swss::KeyOpFieldsValuesTuple& kco);
+
             void sendGetResponse(
                     _In_ sai_object_type_t objectType,
                     _In_ const std::string& strObjectId,
@@ -489,6 +562,12 @@ namespace syncd
 
             bool m_enableSyncMode;
 
+            /**
+             * @brief Sequence numbers of windowed requests waiting for api
+             * response.
+             */
+            std::deque<std::string> m_responseSequences;
+
         private:
 
             /**
@@ -540,5 +619,22 @@ namespace syncd
             TimerWatchdog m_timerWatchdog;
 
             std::set<sai_object_id_t> m_createdInInitView;
+
+            /**
+             * @brief Redis client used by request pipeline response stage.
+             *
+             * Response stage runs on main thread while execute stage is using
+             * m_client on pipeline thread, so they can't share redis
+             * connection.
+             */
+            std::shared_ptr<BaseRedisClient> m_pipelineClient;
+
+            /**
+             * @brief Optional request pipeline, nullptr when disabled.
+             *
+             * Must be declared last, so execute thread will be stopped before
+             * any other member is destroyed.
+             */
+            std::shared_ptr<RequestPipeline> m_pipeline;
     };
 }
@@ -13,5 +13,9 @@ namespace syncd
         public:
 
             bool m_checkAttrVersion = false;
+
+            bool m_batchedDiscovery = false;
+
+            bool m_discoveryCache = false;
     };
 }
@@ -0,0 +1,99 @@
+#include "WorkerPool.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+WorkerPool::WorkerPool(
+        _In_ size_t threadCount):
+    m_run(true)
+{
+    SWSS_LOG_ENTER();
+
+    if (threadCount == 0)
+    {
+        SWSS_LOG_THROW("worker pool thread count must be positive");
+    }
+
+    for (size_t idx = 0; idx < threadCount; idx++)
+    {
+        m_threads.push_back(std::make_shared<std::thread>(&WorkerPool::workerThreadFunction, this));
+    }
+
+    SWSS_LOG_NOTICE("worker pool started with %zu threads", threadCount);
+}
+
+WorkerPool::~WorkerPool()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_run = false;
+    }
+
+    m_cv.notify_all();
+
+    for (auto& thread: m_threads)
+    {
+        thread->join();
+    }
+}
+
+std::future<void> WorkerPool::submit(
+        _In_ std::function<void()> task)
+{
+    SWSS_LOG_ENTER();
+
+    if (task == nullptr)
+    {
+        SWSS_LOG_THROW("task can't be nullptr");
+    }
+
+    auto packagedTask = std::make_shared<std::packaged_task<void()>>(task);
+
+    auto future = packagedTask->get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_tasks.push(packagedTask);
+    }
+
+    m_cv.notify_one();
+
+    return future;
+}
+
+size_t WorkerPool::getThreadCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_threads.size();
+}
+
+void WorkerPool::workerThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_cv.wait(lock, [&]{ return !m_tasks.empty() || !m_run; });
+
+        if (m_tasks.empty())
+        {
+            break; // m_run is false and there are no more tasks
+        }
+
+        auto task = m_tasks.front();
+
+        m_tasks.pop();
+
+        lock.unlock();
+
+        (*task)(); // exception is stored in task future
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <future>
+
+namespace syncd
+{
+    /**
+     * @brief Fixed size pool of worker threads.
+     *
+     * Tasks are executed in submission order by first available worker.
+     * Exception thrown by task is stored in returned future.
+     */
+    class WorkerPool
+    {
+        private:
+
+            WorkerPool(const WorkerPool&) = delete;
+            WorkerPool& operator=(const WorkerPool&) = delete;
+
+        public:
+
+            WorkerPool(
+                    _In_ size_t threadCount);
+
+            virtual ~WorkerPool();
+
+        public:
+
+            std::future<void> submit(
+                    _In_ std::function<void()> task);
+
+            size_t getThreadCount() const;
+
+        private:
+
+            void workerThreadFunction();
+
+        private:
+
+            bool m_run;
+
+            std::queue<std::shared_ptr<std::packaged_task<void()>>> m_tasks;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_cv;
+
+            std::vector<std::shared_ptr<std::thread>> m_threads;
+    };
+}
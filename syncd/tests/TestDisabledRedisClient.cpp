@@ -89,6 +89,14 @@ TEST_F(DisabledRedisClientTest, getColdVidsReturnsEmpty)
     EXPECT_TRUE(result.empty());
 }
 
+TEST_F(DisabledRedisClientTest, getDiscoveryCacheReturnsEmpty)
+{
+    sai_object_id_t switchVid = 0x21000000000000;
+    EXPECT_NO_THROW(m_redisClient->saveDiscoveryCache(switchVid, {{"VERSION", "1"}}));
+    auto result = m_redisClient->getDiscoveryCache(switchVid);
+    EXPECT_TRUE(result.empty());
+}
+
 TEST_F(DisabledRedisClientTest, getAsicObjectsSizeReturnsZero)
 {
     sai_object_id_t switchVid = 0x21000000000000;
@@ -296,6 +296,8 @@ TEST_F(SyncdMlnxTest, portBulkAddRemove)
     flexCounterGroupParam.bulk_chunk_size.count = 0;
     flexCounterGroupParam.bulk_chunk_size_per_prefix.list = nullptr;
     flexCounterGroupParam.bulk_chunk_size_per_prefix.count = 0;
+    flexCounterGroupParam.publish_mode.list = nullptr;
+    flexCounterGroupParam.publish_mode.count = 0;
 
     attr.id = SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER_GROUP;
     attr.value.ptr = (void*)&flexCounterGroupParam;
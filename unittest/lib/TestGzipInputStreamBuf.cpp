@@ -0,0 +1,89 @@
+#include "GzipInputStreamBuf.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+#include <zlib.h>
+
+#include <fstream>
+#include <istream>
+#include <string>
+
+using namespace sairedis;
+
+TEST(GzipInputStreamBuf, plainFile)
+{
+    {
+        std::ofstream out("plain.rec");
+
+        out << "foo\nbar\n";
+    }
+
+    GzipInputStreamBuf buf;
+
+    EXPECT_FALSE(buf.is_open());
+
+    EXPECT_TRUE(buf.open("plain.rec"));
+
+    EXPECT_TRUE(buf.is_open());
+
+    std::istream in(&buf);
+
+    std::string line;
+
+    EXPECT_TRUE((bool)std::getline(in, line));
+    EXPECT_EQ(line, "foo");
+
+    in.seekg(0);
+
+    EXPECT_TRUE((bool)std::getline(in, line));
+    EXPECT_EQ(line, "foo");
+
+    EXPECT_TRUE((bool)std::getline(in, line));
+    EXPECT_EQ(line, "bar");
+
+    EXPECT_FALSE((bool)std::getline(in, line));
+
+    buf.close();
+
+    EXPECT_FALSE(buf.is_open());
+
+    EXPECT_FALSE(buf.open("not_existing.rec"));
+
+    unlink("plain.rec");
+}
+
+TEST(GzipInputStreamBuf, compressedFile)
+{
+    gzFile file = gzopen("compressed.rec.gz", "wb");
+
+    ASSERT_NE(file, nullptr);
+
+    std::string content(200000, 'x');
+
+    content += "\nfoo\n";
+
+    gzwrite(file, content.data(), (unsigned)content.size());
+
+    gzclose(file);
+
+    GzipInputStreamBuf buf;
+
+    EXPECT_TRUE(buf.open("compressed.rec.gz"));
+
+    std::istream in(&buf);
+
+    std::string line;
+
+    EXPECT_TRUE((bool)std::getline(in, line));
+    EXPECT_EQ(line, std::string(200000, 'x'));
+
+    EXPECT_TRUE((bool)std::getline(in, line));
+    EXPECT_EQ(line, "foo");
+
+    EXPECT_FALSE((bool)std::getline(in, line));
+
+    unlink("compressed.rec.gz");
+}
@@ -0,0 +1,105 @@
+#include "LeasedVidIndexGenerator.h"
+
+#include "meta/NumberOidIndexGenerator.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace sairedis;
+using namespace saimeta;
+
+TEST(LeasedVidIndexGenerator, ctr)
+{
+    auto g = std::make_shared<NumberOidIndexGenerator>();
+
+    EXPECT_THROW(std::make_shared<LeasedVidIndexGenerator>(nullptr), std::runtime_error);
+
+    EXPECT_THROW(std::make_shared<LeasedVidIndexGenerator>(g, 0, 16), std::runtime_error);
+
+    EXPECT_THROW(std::make_shared<LeasedVidIndexGenerator>(g, 32, 16), std::runtime_error);
+}
+
+TEST(LeasedVidIndexGenerator, increment)
+{
+    auto g = std::make_shared<NumberOidIndexGenerator>();
+
+    LeasedVidIndexGenerator l(g, 4, 4);
+
+    for (uint64_t i = 1; i <= 10; i++)
+    {
+        EXPECT_EQ(l.increment(), i);
+    }
+
+    // underlying generator was called once per block
+
+    EXPECT_EQ(g->increment(), 13);
+
+    EXPECT_EQ(l.getRemainingCount(), 2);
+}
+
+TEST(LeasedVidIndexGenerator, blockSizeGrows)
+{
+    auto g = std::make_shared<NumberOidIndexGenerator>();
+
+    LeasedVidIndexGenerator l(g, 2, 16, 60000);
+
+    for (int i = 0; i < 100; i++)
+    {
+        l.increment();
+    }
+
+    EXPECT_EQ(l.getBlockSize(), 16);
+
+    l.reset();
+
+    EXPECT_EQ(l.getBlockSize(), 2);
+    EXPECT_EQ(l.getRemainingCount(), 0);
+}
+
+TEST(LeasedVidIndexGenerator, blockSizeShrinks)
+{
+    auto g = std::make_shared<NumberOidIndexGenerator>();
+
+    LeasedVidIndexGenerator l(g, 2, 16, 0);
+
+    for (int i = 0; i < 100; i++)
+    {
+        l.increment();
+    }
+
+    EXPECT_EQ(l.getBlockSize(), 2);
+}
+
+TEST(LeasedVidIndexGenerator, incrementRange)
+{
+    auto g = std::make_shared<NumberOidIndexGenerator>();
+
+    LeasedVidIndexGenerator l(g, 8, 8);
+
+    EXPECT_EQ(l.incrementRange(3), 1);
+    EXPECT_EQ(l.incrementRange(3), 4);
+
+    // does not fit in current block
+
+    EXPECT_EQ(l.incrementRange(3), 9);
+
+    // larger than block is taken directly, current block is kept
+
+    EXPECT_EQ(l.incrementRange(100), 17);
+
+    EXPECT_EQ(l.increment(), 12);
+}
+
+TEST(LeasedVidIndexGenerator, incrementBy)
+{
+    auto g = std::make_shared<NumberOidIndexGenerator>();
+
+    LeasedVidIndexGenerator l(g, 8, 8);
+
+    l.increment();
+
+    auto v = l.incrementBy(3);
+
+    EXPECT_EQ(v, std::vector<uint64_t>({2, 3, 4}));
+}
@@ -2,7 +2,15 @@
 
 #include <gtest/gtest.h>
 
+#include <dirent.h>
+#include <unistd.h>
+
 #include <memory>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace sairedis;
 
@@ -26,3 +34,307 @@ TEST(Recorder, requestLogRotate)
 
     rec.recordComment("bar");
 }
+
+static void setRecordingFilename(
+        _In_ Recorder& rec,
+        _In_ const std::string& name)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+
+    attr.value.s8list.count = (uint32_t)name.size();
+    attr.value.s8list.list = (int8_t*)name.c_str();
+
+    EXPECT_TRUE(rec.setRecordingFilename(attr));
+}
+
+TEST(Recorder, asyncRecording)
+{
+    remove("async.rec");
+
+    Recorder rec;
+
+    setRecordingFilename(rec, "async.rec");
+
+    rec.enableAsyncRecording(true);
+
+    rec.enableRecording(true);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        rec.recordComment("foo" + std::to_string(i));
+    }
+
+    rec.flush();
+
+    std::ifstream in("async.rec");
+
+    std::string line;
+
+    int count = 0;
+
+    while (std::getline(in, line))
+    {
+        if (count > 0) // first line is "recording on"
+        {
+            EXPECT_EQ(line.substr(line.find('|')), "|#|foo" + std::to_string(count - 1));
+        }
+
+        count++;
+    }
+
+    EXPECT_EQ(count, 1001);
+
+    rec.enableAsyncRecording(false);
+
+    rec.recordComment("bar");
+
+    rec.enableRecording(false);
+}
+
+TEST(Recorder, asyncRecordingFullBuffer)
+{
+    remove("async_full.rec");
+
+    Recorder rec;
+
+    setRecordingFilename(rec, "async_full.rec");
+
+    rec.enableAsyncRecording(true);
+
+    rec.enableRecording(true);
+
+    // more records than staging buffer can hold, producers will wait
+    // for writer thread to make space
+
+    std::vector<std::thread> producers;
+
+    for (int t = 0; t < 4; t++)
+    {
+        producers.emplace_back([&rec, t]() {
+
+                for (int i = 0; i < 50000; i++)
+                {
+                    rec.recordComment("foo" + std::to_string(t));
+                }
+        });
+    }
+
+    for (auto& producer: producers)
+    {
+        producer.join();
+    }
+
+    rec.flush();
+
+    std::ifstream in("async_full.rec");
+
+    std::string line;
+
+    int count = 0;
+
+    while (std::getline(in, line))
+    {
+        count++;
+    }
+
+    EXPECT_EQ(count, 200001);
+
+    rec.enableRecording(false);
+
+    remove("async_full.rec");
+}
+
+TEST(Recorder, binaryFormat)
+{
+    remove("binary.rec");
+
+    Recorder rec;
+
+    setRecordingFilename(rec, "binary.rec");
+
+    rec.setRecordingFormat(SAI_REDIS_RECORDING_FORMAT_BINARY);
+
+    rec.enableAsyncRecording(true);
+
+    rec.enableRecording(true);
+
+    rec.recordComment("foo");
+
+    rec.recordComment(std::string(300, 'x'));
+
+    rec.enableRecording(false);
+
+    std::ifstream in("binary.rec", std::ifstream::binary);
+
+    std::stringstream out;
+
+    EXPECT_TRUE(Recorder::convertBinaryToText(in, out));
+
+    std::string line;
+
+    std::getline(out, line);
+
+    EXPECT_NE(line.find("|#|recording on: ./binary.rec"), std::string::npos);
+
+    std::getline(out, line);
+
+    EXPECT_EQ(line.substr(line.find('|')), "|#|foo");
+
+    std::getline(out, line);
+
+    EXPECT_EQ(line.substr(line.find('|')), "|#|" + std::string(300, 'x'));
+
+    EXPECT_FALSE(std::getline(out, line));
+
+    // existing binary file keeps its format even if text is requested
+
+    rec.setRecordingFormat(SAI_REDIS_RECORDING_FORMAT_TEXT);
+
+    rec.enableRecording(true);
+
+    rec.recordComment("bar");
+
+    rec.enableRecording(false);
+
+    std::ifstream in2("binary.rec", std::ifstream::binary);
+
+    std::stringstream out2;
+
+    EXPECT_TRUE(Recorder::convertBinaryToText(in2, out2));
+
+    EXPECT_NE(out2.str().find("|#|bar\n"), std::string::npos);
+
+    std::stringstream text("2020-01-01.00:00:00.000000|#|foo\n");
+
+    EXPECT_FALSE(Recorder::readBinaryHeader(text));
+
+    EXPECT_FALSE(Recorder::convertBinaryToText(text, out));
+}
+
+static std::vector<std::string> getSegments(
+        _In_ const std::string& fileName)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> segments;
+
+    DIR* dir = opendir(".");
+
+    struct dirent* entry;
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if (RecordingCompressor::isSegmentFileName(fileName, entry->d_name))
+        {
+            segments.push_back(entry->d_name);
+        }
+    }
+
+    closedir(dir);
+
+    return segments;
+}
+
+TEST(Recorder, rotateBySize)
+{
+    for (auto& segment: getSegments("rotate.rec"))
+    {
+        unlink(segment.c_str());
+    }
+
+    remove("rotate.rec");
+
+    {
+        Recorder rec;
+
+        setRecordingFilename(rec, "rotate.rec");
+
+        rec.setRotateSize(1000);
+
+        rec.setRotateMaxSegments(2);
+
+        rec.enableAsyncRecording(true);
+
+        rec.enableRecording(true);
+
+        for (int i = 0; i < 100; i++)
+        {
+            rec.recordComment("foo" + std::to_string(i));
+
+            if (i % 10 == 0)
+            {
+                rec.flush(); // let the file grow above rotate size
+            }
+        }
+
+        rec.enableRecording(false);
+
+        rec.m_compressor->wait();
+    }
+
+    auto segments = getSegments("rotate.rec");
+
+    EXPECT_EQ(segments.size(), 2);
+
+    for (auto& segment: segments)
+    {
+        EXPECT_EQ(segment.substr(segment.size() - 3), ".gz");
+
+        unlink(segment.c_str());
+    }
+
+    std::ifstream in("rotate.rec");
+
+    std::string line;
+
+    std::getline(in, line);
+
+    EXPECT_NE(line.find("|#|rotated from: ./rotate.rec."), std::string::npos);
+
+    remove("rotate.rec");
+}
+
+TEST(Recorder, rotateByIntervalOnFlush)
+{
+    for (auto& segment: getSegments("rotate_interval.rec"))
+    {
+        unlink(segment.c_str());
+    }
+
+    remove("rotate_interval.rec");
+
+    {
+        Recorder rec;
+
+        setRecordingFilename(rec, "rotate_interval.rec");
+
+        rec.setRotateInterval(1);
+
+        rec.setRotateCompress(false);
+
+        rec.enableRecording(true);
+
+        sleep(2);
+
+        // nothing is recorded, file is rotated by flush
+
+        rec.flush();
+
+        rec.enableRecording(false);
+
+        rec.m_compressor->wait();
+    }
+
+    auto segments = getSegments("rotate_interval.rec");
+
+    EXPECT_EQ(segments.size(), 1);
+
+    for (auto& segment: segments)
+    {
+        unlink(segment.c_str());
+    }
+
+    remove("rotate_interval.rec");
+}
@@ -0,0 +1,125 @@
+#include "RecordingCompressor.h"
+#include "GzipInputStreamBuf.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <fstream>
+#include <istream>
+#include <string>
+
+using namespace sairedis;
+
+static void writeFile(
+        _In_ const std::string& path,
+        _In_ const std::string& content)
+{
+    SWSS_LOG_ENTER();
+
+    std::ofstream out(path);
+
+    out << content;
+}
+
+TEST(RecordingCompressor, getSegmentFileName)
+{
+    struct timeval tv;
+
+    tv.tv_sec = 0;
+    tv.tv_usec = 42;
+
+    auto name = RecordingCompressor::getSegmentFileName("foo.rec", tv);
+
+    EXPECT_EQ(name.size(), std::string("foo.rec.YYYYmmdd.HHMMSS.uuuuuu").size());
+
+    EXPECT_EQ(name.substr(name.size() - 7), ".000042");
+
+    EXPECT_TRUE(RecordingCompressor::isSegmentFileName("foo.rec", name));
+}
+
+TEST(RecordingCompressor, isSegmentFileName)
+{
+    EXPECT_TRUE(RecordingCompressor::isSegmentFileName("foo.rec", "foo.rec.20240101.102030.000001"));
+    EXPECT_TRUE(RecordingCompressor::isSegmentFileName("foo.rec", "foo.rec.20240101.102030.000001.gz"));
+
+    EXPECT_FALSE(RecordingCompressor::isSegmentFileName("foo.rec", "foo.rec"));
+    EXPECT_FALSE(RecordingCompressor::isSegmentFileName("foo.rec", "foo.rec.1"));
+    EXPECT_FALSE(RecordingCompressor::isSegmentFileName("foo.rec", "bar.rec.20240101.102030.000001"));
+    EXPECT_FALSE(RecordingCompressor::isSegmentFileName("foo.rec", "foo.rec.20240101.102030.000001.xz"));
+    EXPECT_FALSE(RecordingCompressor::isSegmentFileName("foo.rec", "foo.rec.2024010a.102030.000001"));
+}
+
+TEST(RecordingCompressor, compressFile)
+{
+    std::string content;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        content += "2024-01-01.00:00:00.000000|c|SAI_OBJECT_TYPE_ROUTE_ENTRY:" + std::to_string(i) + "\n";
+    }
+
+    writeFile("compress.rec", content);
+
+    EXPECT_TRUE(RecordingCompressor::compressFile("compress.rec", "compress.rec.gz"));
+
+    EXPECT_NE(access("compress.rec", F_OK), 0);
+
+    struct stat st;
+
+    EXPECT_EQ(stat("compress.rec.gz", &st), 0);
+
+    EXPECT_LT((size_t)st.st_size, content.size());
+
+    GzipInputStreamBuf buf;
+
+    EXPECT_TRUE(buf.open("compress.rec.gz"));
+
+    std::istream in(&buf);
+
+    std::string decompressed((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    EXPECT_EQ(decompressed, content);
+
+    EXPECT_FALSE(RecordingCompressor::compressFile("not_existing.rec", "not_existing.rec.gz"));
+
+    unlink("compress.rec.gz");
+}
+
+TEST(RecordingCompressor, removeOldSegments)
+{
+    mkdir("segments", 0755);
+
+    writeFile("segments/foo.rec.20240101.000000.000001.gz", "a");
+    writeFile("segments/foo.rec.20240101.000000.000002.gz", "b");
+    writeFile("segments/foo.rec.20240101.000000.000003", "c");
+    writeFile("segments/foo.rec", "d");
+
+    RecordingCompressor::removeOldSegments("segments", "foo.rec", 0);
+
+    EXPECT_EQ(access("segments/foo.rec.20240101.000000.000001.gz", F_OK), 0);
+
+    RecordingCompressor::removeOldSegments("segments", "foo.rec", 2);
+
+    EXPECT_NE(access("segments/foo.rec.20240101.000000.000001.gz", F_OK), 0);
+    EXPECT_EQ(access("segments/foo.rec.20240101.000000.000002.gz", F_OK), 0);
+    EXPECT_EQ(access("segments/foo.rec.20240101.000000.000003", F_OK), 0);
+    EXPECT_EQ(access("segments/foo.rec", F_OK), 0);
+
+    RecordingCompressor compressor;
+
+    compressor.push("segments/foo.rec.20240101.000000.000003", true, "segments", "foo.rec", 1);
+
+    compressor.wait();
+
+    EXPECT_NE(access("segments/foo.rec.20240101.000000.000002.gz", F_OK), 0);
+    EXPECT_NE(access("segments/foo.rec.20240101.000000.000003", F_OK), 0);
+    EXPECT_EQ(access("segments/foo.rec.20240101.000000.000003.gz", F_OK), 0);
+
+    unlink("segments/foo.rec.20240101.000000.000003.gz");
+    unlink("segments/foo.rec");
+    rmdir("segments");
+}
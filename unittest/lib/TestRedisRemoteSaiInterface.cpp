@@ -1,6 +1,8 @@
 #include "RedisRemoteSaiInterface.h"
 #include "ContextConfigContainer.h"
 #include "sairediscommon.h"
+#include "Meta.h"
+#include "sai_serialize.h"
 
 #include <gtest/gtest.h>
 #include <functional>
@@ -88,3 +90,261 @@ TEST(RedisRemoteSaiInterface, queryStatsStCapability)
                                          SAI_OBJECT_TYPE_PORT,
                                          &stats_capability));
 }
+
+static vector<pair<uint64_t, sai_status_t>> g_completions;
+
+static void syncCompletion(
+        _In_ uint64_t sequence,
+        _In_ sai_common_api_t api,
+        _In_ const char *key,
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    g_completions.emplace_back(sequence, status);
+}
+
+static sai_status_t syncWindowHandshake(
+        _In_ const string &command,
+        _Out_ KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    kfvFieldsValues(kco).push_back(make_pair(REDIS_ASIC_STATE_SYNC_WINDOW_HANDSHAKE_FIELD, "1"));
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static string syncWindowRoute(
+        _In_ int index)
+{
+    SWSS_LOG_ENTER();
+
+    return "{\"dest\":\"10.0.0." + to_string(index) + "/32\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}";
+}
+
+TEST(RedisRemoteSaiInterface, syncWindow)
+{
+    SWSS_LOG_ENTER();
+
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<TestRedisRemoteSaiInterfaceMockChannel>(
+        sai.m_contextConfig->m_dbAsic,
+        std::bind(&RedisRemoteSaiInterface::handleNotification, &sai, placeholders::_1, placeholders::_2, placeholders::_3));
+
+    sai.m_communicationChannel = channel;
+    sai.m_syncMode = true;
+
+    uint64_t sequence = 0;
+
+    channel->m_wait_mock = [&](const string &command, KeyOpFieldsValuesTuple &kco) -> sai_status_t
+    {
+        SWSS_LOG_ENTER();
+
+        if (command == REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE)
+        {
+            return syncWindowHandshake(command, kco);
+        }
+
+        kfvFieldsValues(kco).push_back(make_pair(REDIS_ASIC_STATE_SEQUENCE_FIELD, to_string(++sequence)));
+
+        return sequence == 2 ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+    };
+
+    g_completions.clear();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_COMPLETION_CALLBACK;
+    attr.value.ptr = (void*)&syncCompletion;
+
+    EXPECT_EQ(sai.setRedisExtensionAttribute(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_WINDOW_SIZE;
+    attr.value.u32 = 4;
+
+    EXPECT_EQ(sai.setRedisExtensionAttribute(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(sai.create(SAI_OBJECT_TYPE_ROUTE_ENTRY, syncWindowRoute(i), 0, nullptr), SAI_STATUS_SUCCESS);
+    }
+
+    EXPECT_EQ(g_completions.size(), 0);
+
+    // window is full, oldest request is completed
+
+    EXPECT_EQ(sai.create(SAI_OBJECT_TYPE_ROUTE_ENTRY, syncWindowRoute(3), 0, nullptr), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(g_completions.size(), 1);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_DRAIN;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(sai.setRedisExtensionAttribute(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_FAILURE);
+
+    ASSERT_EQ(g_completions.size(), 4);
+
+    EXPECT_EQ(g_completions[1].first, 2);
+    EXPECT_EQ(g_completions[1].second, SAI_STATUS_FAILURE);
+
+    EXPECT_EQ(sai.setRedisExtensionAttribute(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    // response with wrong sequence
+
+    EXPECT_EQ(sai.create(SAI_OBJECT_TYPE_ROUTE_ENTRY, syncWindowRoute(4), 0, nullptr), SAI_STATUS_SUCCESS);
+
+    sequence = 100;
+
+    EXPECT_THROW(sai.setRedisExtensionAttribute(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), std::runtime_error);
+}
+
+TEST(RedisRemoteSaiInterface, syncWindowFailedCreate)
+{
+    SWSS_LOG_ENTER();
+
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = make_shared<Recorder>();
+
+    auto sai = make_shared<RedisRemoteSaiInterface>(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<TestRedisRemoteSaiInterfaceMockChannel>(
+        sai->m_contextConfig->m_dbAsic,
+        std::bind(&RedisRemoteSaiInterface::handleNotification, sai.get(), placeholders::_1, placeholders::_2, placeholders::_3));
+
+    sai->m_communicationChannel = channel;
+    sai->m_syncMode = true;
+
+    auto meta = make_shared<saimeta::Meta>(sai);
+
+    sai->setMeta(meta);
+
+    // route was already added to meta db when its windowed create returned
+
+    const string route = "SAI_OBJECT_TYPE_ROUTE_ENTRY:" + syncWindowRoute(0);
+
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"]["NULL"] = "NULL";
+    dump["SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000022"]["NULL"] = "NULL";
+    dump[route]["SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION"] = "SAI_PACKET_ACTION_DROP";
+
+    meta->populate(dump);
+
+    sai_object_meta_key_t mk;
+
+    sai_deserialize_object_meta_key(route, mk);
+
+    EXPECT_TRUE(meta->objectExists(mk));
+
+    uint64_t sequence = 0;
+
+    vector<string> commands;
+
+    channel->m_wait_mock = [&](const string &command, KeyOpFieldsValuesTuple &kco) -> sai_status_t
+    {
+        SWSS_LOG_ENTER();
+
+        if (command == REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE)
+        {
+            return syncWindowHandshake(command, kco);
+        }
+
+        commands.push_back(command);
+
+        kfvFieldsValues(kco).push_back(make_pair(REDIS_ASIC_STATE_SEQUENCE_FIELD, to_string(++sequence)));
+
+        return sequence == 1 ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+    };
+
+    g_completions.clear();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_COMPLETION_CALLBACK;
+    attr.value.ptr = (void*)&syncCompletion;
+
+    EXPECT_EQ(sai->setRedisExtensionAttribute(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_WINDOW_SIZE;
+    attr.value.u32 = 2;
+
+    EXPECT_EQ(sai->setRedisExtensionAttribute(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    sai->m_windowedRequests.push_back({++sai->m_requestSequence, SAI_COMMON_API_CREATE, route});
+
+    // next create completes failed one, which is removed from meta db, while
+    // next create itself is sent
+
+    EXPECT_EQ(sai->create(SAI_OBJECT_TYPE_ROUTE_ENTRY, syncWindowRoute(1), 0, nullptr), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(commands.size(), 1);
+    EXPECT_EQ(sai->m_windowedRequests.size(), 1);
+
+    ASSERT_EQ(g_completions.size(), 1);
+    EXPECT_EQ(g_completions[0].second, SAI_STATUS_FAILURE);
+
+    EXPECT_FALSE(meta->objectExists(mk));
+
+    // remove and set are not windowed, they drain window and return their
+    // own status
+
+    EXPECT_EQ(sai->remove(SAI_OBJECT_TYPE_ROUTE_ENTRY, syncWindowRoute(1)), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(commands.size(), 3);
+    EXPECT_EQ(sai->m_windowedRequests.size(), 0);
+
+    // object id create is not windowed
+
+    EXPECT_EQ(sai->create(SAI_OBJECT_TYPE_NEXT_HOP, string("oid:0x1"), 0, nullptr), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(commands.size(), 4);
+    EXPECT_EQ(sai->m_windowedRequests.size(), 0);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_DRAIN;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(sai->setRedisExtensionAttribute(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_FAILURE);
+    EXPECT_EQ(sai->setRedisExtensionAttribute(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+}
+
+TEST(RedisRemoteSaiInterface, syncWindowNotSupported)
+{
+    SWSS_LOG_ENTER();
+
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<TestRedisRemoteSaiInterfaceMockChannel>(
+        sai.m_contextConfig->m_dbAsic,
+        std::bind(&RedisRemoteSaiInterface::handleNotification, &sai, placeholders::_1, placeholders::_2, placeholders::_3));
+
+    sai.m_communicationChannel = channel;
+    sai.m_syncMode = true;
+
+    // older syncd rejects handshake as invalid attribute capability query
+
+    channel->m_wait_mock = [&](const string &command, KeyOpFieldsValuesTuple &kco) -> sai_status_t
+    {
+        SWSS_LOG_ENTER();
+
+        return command == REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE ? SAI_STATUS_INVALID_PARAMETER : SAI_STATUS_SUCCESS;
+    };
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_WINDOW_SIZE;
+    attr.value.u32 = 4;
+
+    EXPECT_EQ(sai.setRedisExtensionAttribute(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_NOT_SUPPORTED);
+
+    EXPECT_EQ(sai.create(SAI_OBJECT_TYPE_ROUTE_ENTRY, syncWindowRoute(0), 0, nullptr), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(sai.m_windowedRequests.size(), 0);
+}
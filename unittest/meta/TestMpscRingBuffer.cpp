@@ -0,0 +1,99 @@
+#include "MpscRingBuffer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace saimeta;
+
+TEST(MpscRingBuffer, ctr)
+{
+    EXPECT_THROW(MpscRingBuffer<int>(0), std::runtime_error);
+
+    MpscRingBuffer<int> rb(5);
+
+    EXPECT_EQ(rb.capacity(), 8);
+    EXPECT_TRUE(rb.empty());
+}
+
+TEST(MpscRingBuffer, full)
+{
+    MpscRingBuffer<int> rb(2);
+
+    EXPECT_TRUE(rb.tryEnqueue(1));
+    EXPECT_TRUE(rb.tryEnqueue(2));
+    EXPECT_FALSE(rb.tryEnqueue(3));
+
+    int val;
+
+    EXPECT_TRUE(rb.tryDequeue(val));
+    EXPECT_EQ(val, 1);
+
+    EXPECT_TRUE(rb.tryEnqueue(3));
+
+    EXPECT_TRUE(rb.tryDequeue(val));
+    EXPECT_EQ(val, 2);
+
+    EXPECT_TRUE(rb.tryDequeue(val));
+    EXPECT_EQ(val, 3);
+
+    EXPECT_FALSE(rb.tryDequeue(val));
+}
+
+TEST(MpscRingBuffer, multipleProducers)
+{
+    const int producers = 4;
+    const int count = 10000;
+
+    MpscRingBuffer<int> rb(256);
+
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producers; p++)
+    {
+        threads.emplace_back([&rb, p, count]() {
+            for (int i = 0; i < count; i++)
+            {
+                int val = p * count + i;
+
+                while (!rb.tryEnqueue(std::move(val)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> last(producers, -1);
+
+    int received = 0;
+
+    while (received < producers * count)
+    {
+        int val;
+
+        if (!rb.tryDequeue(val))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        int p = val / count;
+        int i = val % count;
+
+        // items from the same producer arrive in order
+        EXPECT_GT(i, last[p]);
+
+        last[p] = i;
+
+        received++;
+    }
+
+    for (auto& t: threads)
+    {
+        t.join();
+    }
+
+    EXPECT_TRUE(rb.empty());
+}
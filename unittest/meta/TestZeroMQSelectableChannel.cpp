@@ -1,10 +1,19 @@
 #include "ZeroMQSelectableChannel.h"
+#include "ZeroMQBinaryFraming.h"
 #include "ZeroMQChannel.h"
 
+#include "sairediscommon.h"
+#include "sai_serialize.h"
+
 #include "swss/select.h"
+#include "swss/json.h"
 
 #include <gtest/gtest.h>
 
+#include <zmq.h>
+
+#include <thread>
+
 using namespace sairedis;
 
 TEST(ZeroMQSelectableChannel, ctr)
@@ -87,3 +96,184 @@ TEST(ZeroMQSelectableChannel, readData)
     c.pop(kco, false);
 }
 
+
+TEST(ZeroMQSelectableChannel, binaryFraming)
+{
+    ZeroMQChannel main("ipc:///tmp/zmq_test", "ipc:///tmp/zmq_test_ntf", cb, ZMQ_RESPONSE_DEFAULT_BUFFER_SIZE, true);
+
+    ZeroMQSelectableChannel c("ipc:///tmp/zmq_test");
+
+    swss::Select ss;
+
+    ss.addSelectable(&c);
+
+    swss::Selectable *sel = NULL;
+
+    int result = -1;
+
+    // handshake is answered by channel itself inside select, so select will
+    // return only when actual request arrives
+
+    std::thread server([&]() { result = ss.select(&sel); });
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("SAI_PORT_ATTR_ADMIN_STATE", "true");
+    values.emplace_back("empty", "");
+
+    main.setResponseTimeout(1000);
+
+    main.set("key", values, "command");
+
+    server.join();
+
+    EXPECT_EQ(result, swss::Select::OBJECT);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    c.pop(kco, false);
+
+    EXPECT_EQ(c.empty(), true);
+
+    EXPECT_EQ(kfvKey(kco), "key");
+    EXPECT_EQ(kfvOp(kco), "command");
+    EXPECT_EQ(kfvFieldsValues(kco), values);
+
+    // response is sent with the same framing as request
+
+    values.emplace_back("value", std::string("with\0zero", 9));
+
+    c.set("SAI_STATUS_SUCCESS", values, "command");
+
+    EXPECT_EQ(main.wait("command", kco), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(kfvKey(kco), "SAI_STATUS_SUCCESS");
+    EXPECT_EQ(kfvFieldsValues(kco), values);
+}
+
+TEST(ZeroMQSelectableChannel, binaryFramingFallback)
+{
+    ZeroMQChannel main("ipc:///tmp/zmq_test", "ipc:///tmp/zmq_test_ntf", cb, ZMQ_RESPONSE_DEFAULT_BUFFER_SIZE, true);
+
+    // server without binary framing support, answers handshake like
+    // attribute capability query with wrong number of arguments
+
+    void* ctx = zmq_ctx_new();
+    void* rep = zmq_socket(ctx, ZMQ_REP);
+
+    ASSERT_EQ(zmq_bind(rep, "ipc:///tmp/zmq_test"), 0);
+
+    std::vector<std::string> requests;
+
+    std::thread server([&]() {
+
+            for (int i = 0; i < 2; i++)
+            {
+                char buffer[1024] = { 0 };
+
+                int rc = zmq_recv(rep, buffer, sizeof(buffer) - 1, 0);
+
+                if (rc < 0 || ZeroMQBinaryFraming::hasMore(rep))
+                {
+                    requests.push_back("multipart");
+                    ZeroMQBinaryFraming::drain(rep);
+                }
+                else
+                {
+                    requests.push_back(buffer);
+                }
+
+                std::vector<swss::FieldValueTuple> response;
+
+                response.emplace_back(sai_serialize_status(i ? SAI_STATUS_SUCCESS : SAI_STATUS_INVALID_PARAMETER),
+                        i ? "command" : REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
+
+                std::string msg = swss::JSon::buildJson(response);
+
+                zmq_send(rep, msg.c_str(), msg.length(), 0);
+            }
+    });
+
+    main.setResponseTimeout(1000);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("SAI_PORT_ATTR_ADMIN_STATE", "true");
+
+    main.set("key", values, "command");
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    EXPECT_EQ(main.wait("command", kco), SAI_STATUS_SUCCESS);
+
+    server.join();
+
+    zmq_close(rep);
+    zmq_ctx_destroy(ctx);
+
+    ASSERT_EQ(requests.size(), 2);
+
+    // request after failed handshake is sent as JSON
+
+    std::vector<swss::FieldValueTuple> request;
+
+    swss::JSon::readJson(requests[1], request);
+
+    ASSERT_EQ(request.size(), 2);
+    EXPECT_EQ(request[0], swss::FieldValueTuple("key", "command"));
+    EXPECT_EQ(request[1], values[0]);
+}
+
+TEST(ZeroMQSelectableChannel, binaryFramingDrain)
+{
+    void* ctx = zmq_ctx_new();
+    void* rep = zmq_socket(ctx, ZMQ_REP);
+    void* req = zmq_socket(ctx, ZMQ_REQ);
+
+    ASSERT_EQ(zmq_bind(rep, "inproc://zmq_drain"), 0);
+    ASSERT_EQ(zmq_connect(req, "inproc://zmq_drain"), 0);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("field", "value");
+
+    ASSERT_EQ(ZeroMQBinaryFraming::send(req, "key", "op", values), 0);
+
+    char buffer[64];
+
+    ASSERT_EQ(zmq_recv(rep, buffer, sizeof(buffer), 0), (int)ZeroMQBinaryFraming::MAGIC.size());
+
+    // receive only part of message, rest must be drained
+
+    ASSERT_EQ(zmq_recv(rep, buffer, sizeof(buffer), 0), 3);
+
+    EXPECT_TRUE(ZeroMQBinaryFraming::hasMore(rep));
+
+    ZeroMQBinaryFraming::drain(rep);
+
+    EXPECT_FALSE(ZeroMQBinaryFraming::hasMore(rep));
+
+    // socket is in sync, next message starts with header frame
+
+    ASSERT_EQ(zmq_send(rep, "ok", 2, 0), 2);
+    ASSERT_EQ(zmq_recv(req, buffer, sizeof(buffer), 0), 2);
+
+    ASSERT_EQ(ZeroMQBinaryFraming::send(req, "key2", "op2", values), 0);
+
+    int rc = zmq_recv(rep, buffer, sizeof(buffer), 0);
+
+    ASSERT_GE(rc, 0);
+    EXPECT_TRUE(ZeroMQBinaryFraming::isMagic(buffer, rc));
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    EXPECT_EQ(ZeroMQBinaryFraming::recv(rep, kco), 0);
+
+    EXPECT_EQ(kfvKey(kco), "key2");
+    EXPECT_EQ(kfvOp(kco), "op2");
+    EXPECT_EQ(kfvFieldsValues(kco), values);
+
+    zmq_close(req);
+    zmq_close(rep);
+    zmq_ctx_destroy(ctx);
+}
@@ -85,6 +85,23 @@ sai_status_t MockableSaiInterface::get(
     return SAI_STATUS_SUCCESS;
 }
 
+sai_status_t MockableSaiInterface::bulkCreate(
+    _In_ uint32_t object_count,
+    _In_ const sai_route_entry_t *route_entry,
+    _In_ const uint32_t *attr_count,
+    _In_ const sai_attribute_t **attr_list,
+    _In_ sai_bulk_op_error_mode_t mode,
+    _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+    if (mock_bulkCreateRouteEntry)
+    {
+        return mock_bulkCreateRouteEntry(object_count, route_entry, attr_count, attr_list, mode, object_statuses);
+    }
+
+    return DummySaiInterface::bulkCreate(object_count, route_entry, attr_count, attr_list, mode, object_statuses);
+}
+
 sai_status_t MockableSaiInterface::bulkCreate(
     _In_ sai_object_type_t object_type,
     _In_ sai_object_id_t switch_id,
@@ -147,6 +164,10 @@ sai_status_t MockableSaiInterface::bulkGet(
         _Out_ sai_status_t *object_statuses)
 {
     SWSS_LOG_ENTER();
+    if (mock_bulkGet)
+    {
+        return mock_bulkGet(object_type, object_count, object_id, attr_count, attr_list, mode, object_statuses);
+    }
 
     SWSS_LOG_ERROR("not implemented, FIXME");
 
@@ -51,6 +51,18 @@ class MockableSaiInterface: public saimeta::DummySaiInterface
 
         std::function<sai_status_t(sai_object_type_t, sai_object_id_t, uint32_t, sai_attribute_t *)> mock_get;
 
+    public: // bulk QUAD entry
+
+        virtual sai_status_t bulkCreate(
+                _In_ uint32_t object_count,
+                _In_ const sai_route_entry_t *route_entry,
+                _In_ const uint32_t *attr_count,
+                _In_ const sai_attribute_t **attr_list,
+                _In_ sai_bulk_op_error_mode_t mode,
+                _Out_ sai_status_t *object_statuses) override;
+
+        std::function<sai_status_t(uint32_t, const sai_route_entry_t *, const uint32_t *, const sai_attribute_t **, sai_bulk_op_error_mode_t, sai_status_t *)> mock_bulkCreateRouteEntry;
+
     public: // bulk QUAD oid
 
         virtual sai_status_t bulkCreate(
@@ -94,6 +106,8 @@ class MockableSaiInterface: public saimeta::DummySaiInterface
                     _In_ sai_bulk_op_error_mode_t mode,
                     _Out_ sai_status_t *object_statuses) override;
 
+        std::function<sai_status_t(sai_object_type_t, uint32_t, const sai_object_id_t *, const uint32_t *, sai_attribute_t **, sai_bulk_op_error_mode_t, sai_status_t *)> mock_bulkGet;
+
     public: // stats API
 
         virtual sai_status_t getStats(
@@ -0,0 +1,212 @@
+#include "AdaptiveChunkSizer.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace syncd;
+
+// simulated vendor bulk call latency, large chunks get slow
+static uint64_t chunkLatency(
+        _In_ uint32_t chunkSize)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t latency = 50 + chunkSize;
+
+    if (chunkSize > 256)
+    {
+        latency += (chunkSize - 256) * 4;
+    }
+
+    return latency;
+}
+
+static uint32_t poll(
+        _In_ AdaptiveChunkSizer& sizer,
+        _In_ uint32_t objectCount,
+        _In_ uint32_t maxSupportedChunk = UINT32_MAX)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t chunkSize = sizer.startPoll(objectCount);
+
+    uint64_t total = 0;
+
+    for (uint32_t current = 0; current < objectCount; current += chunkSize)
+    {
+        uint32_t size = std::min(chunkSize, objectCount - current);
+
+        uint64_t latency = chunkLatency(size);
+
+        total += latency;
+
+        sizer.recordChunk(size, latency, size <= maxSupportedChunk);
+    }
+
+    sizer.endPoll(total);
+
+    return chunkSize;
+}
+
+TEST(AdaptiveChunkSizer, startPoll)
+{
+    AdaptiveChunkSizer sizer;
+
+    EXPECT_EQ(sizer.startPoll(0), 0);
+
+    EXPECT_EQ(sizer.startPoll(100), 100);
+
+    EXPECT_EQ(sizer.getChunkSize(), 100);
+}
+
+TEST(AdaptiveChunkSizer, converge)
+{
+    AdaptiveChunkSizer sizer;
+
+    for (int i = 0; i < 40; i++)
+    {
+        poll(sizer, 1024);
+    }
+
+    EXPECT_EQ(sizer.getChunkSize(), 256);
+}
+
+TEST(AdaptiveChunkSizer, backoffOnError)
+{
+    AdaptiveChunkSizer sizer;
+
+    for (int i = 0; i < 40; i++)
+    {
+        poll(sizer, 128, 64);
+    }
+
+    EXPECT_LE(sizer.getChunkSize(), 64);
+
+    // failed size is tried again only once per recovery interval
+
+    uint32_t failed = 0;
+
+    for (int i = 0; i < 64; i++)
+    {
+        if (poll(sizer, 128, 64) > 64)
+        {
+            failed++;
+        }
+    }
+
+    EXPECT_LE(failed, 64 / AdaptiveChunkSizer::DEFAULT_RECOVERY_INTERVAL);
+
+    EXPECT_LE(sizer.getChunkSize(), 64);
+}
+
+TEST(AdaptiveChunkSizer, recoverAfterError)
+{
+    AdaptiveChunkSizer sizer;
+
+    for (int i = 0; i < 40; i++)
+    {
+        poll(sizer, 1024, 64);
+    }
+
+    EXPECT_LE(sizer.getChunkSize(), 64);
+
+    // failures were transient
+
+    for (int i = 0; i < 200; i++)
+    {
+        poll(sizer, 1024);
+    }
+
+    EXPECT_EQ(sizer.getChunkSize(), 256);
+}
+
+TEST(AdaptiveChunkSizer, objectCountChange)
+{
+    AdaptiveChunkSizer sizer(16, 1, 1000);
+
+    for (int i = 0; i < 10; i++)
+    {
+        poll(sizer, 128, 64);
+    }
+
+    // limit is dropped when object count changes
+
+    uint32_t chunkSize = 0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        chunkSize = std::max(chunkSize, poll(sizer, 100));
+    }
+
+    EXPECT_GT(chunkSize, 64);
+}
+
+TEST(AdaptiveChunkSizer, objectFailure)
+{
+    AdaptiveChunkSizer sizer;
+
+    EXPECT_EQ(sizer.startPoll(128), 128);
+
+    sizer.recordChunk(128, 100, false, true);
+
+    sizer.endPoll(100);
+
+    // failure of single object doesn't limit chunk size
+
+    EXPECT_EQ(sizer.startPoll(128), 128);
+
+    sizer.recordChunk(128, 100, false);
+
+    sizer.endPoll(100);
+
+    EXPECT_EQ(sizer.startPoll(128), 64);
+}
+
+TEST(AdaptiveChunkSizer, minChunkSize)
+{
+    AdaptiveChunkSizer sizer(16);
+
+    for (int i = 0; i < 40; i++)
+    {
+        EXPECT_GE(poll(sizer, 1024, 1), 16);
+    }
+
+    // less objects than minimum chunk size
+
+    EXPECT_EQ(sizer.startPoll(8), 8);
+}
+
+TEST(AdaptiveChunkSizer, getStats)
+{
+    AdaptiveChunkSizer sizer;
+
+    sizer.startPoll(10);
+
+    sizer.recordChunk(10, 50, true);
+    sizer.recordChunk(10, 500, true);
+    sizer.recordChunk(10, 5000000, true);
+
+    sizer.endPoll(5000550);
+
+    auto& histogram = sizer.getHistogram();
+
+    EXPECT_EQ(histogram.size(), AdaptiveChunkSizer::HISTOGRAM_BOUNDS_US.size() + 1);
+
+    EXPECT_EQ(histogram[0], 1);
+    EXPECT_EQ(histogram[1], 1);
+    EXPECT_EQ(histogram.back(), 1);
+
+    auto stats = sizer.getStats("prefix");
+
+    EXPECT_EQ(stats.size(), histogram.size() + 1);
+
+    EXPECT_EQ(fvField(stats[0]), "prefix_chunk_size");
+    EXPECT_EQ(fvValue(stats[0]), "10");
+
+    EXPECT_EQ(fvField(stats[1]), "prefix_latency_le_100us");
+    EXPECT_EQ(fvValue(stats[1]), "1");
+
+    EXPECT_EQ(fvField(stats.back()), "prefix_latency_inf");
+    EXPECT_EQ(fvValue(stats.back()), "1");
+}
@@ -0,0 +1,75 @@
+#include "AsicView.h"
+
+#include "meta/sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+static swss::TableDump createDump()
+{
+    SWSS_LOG_ENTER();
+
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"] = {
+        {"SAI_SWITCH_ATTR_INIT_SWITCH", "true"},
+        {"SAI_SWITCH_ATTR_SRC_MAC_ADDRESS", "02:00:00:00:00:01"},
+    };
+
+    dump["SAI_OBJECT_TYPE_SAMPLEPACKET:oid:0x41000000000001"] = {
+        {"SAI_SAMPLEPACKET_ATTR_SAMPLE_RATE", "1"},
+    };
+
+    dump["SAI_OBJECT_TYPE_SAMPLEPACKET:oid:0x41000000000002"] = {
+        {"SAI_SAMPLEPACKET_ATTR_SAMPLE_RATE", "2"},
+    };
+
+    dump["SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0.0/24\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000001\"}"] = {
+        {"SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION", "SAI_PACKET_ACTION_DROP"},
+    };
+
+    return dump;
+}
+
+TEST(AsicView, sharedStrings)
+{
+    AsicView view(createDump());
+
+    auto objs = view.getObjectsByObjectType(SAI_OBJECT_TYPE_SAMPLEPACKET);
+
+    ASSERT_EQ(objs.size(), 2);
+
+    EXPECT_EQ(objs[0]->getStrObjectType(), "SAI_OBJECT_TYPE_SAMPLEPACKET");
+    EXPECT_EQ(&objs[0]->getStrObjectType(), &objs[1]->getStrObjectType());
+
+    auto a0 = objs[0]->getSaiAttr(SAI_SAMPLEPACKET_ATTR_SAMPLE_RATE);
+    auto a1 = objs[1]->getSaiAttr(SAI_SAMPLEPACKET_ATTR_SAMPLE_RATE);
+
+    EXPECT_EQ(a0->getStrAttrId(), "SAI_SAMPLEPACKET_ATTR_SAMPLE_RATE");
+    EXPECT_EQ(&a0->getStrAttrId(), &a1->getStrAttrId());
+
+    EXPECT_NE(a0->getStrAttrValue(), a1->getStrAttrValue());
+}
+
+TEST(AsicView, releasePreMatchIndexes)
+{
+    AsicView view(createDump());
+
+    ASSERT_EQ(view.m_routesByPrefix.size(), 1);
+
+    auto& routes = view.m_routesByPrefix.at("10.0.0.0/24");
+
+    ASSERT_EQ(routes.size(), 1);
+
+    EXPECT_EQ(routes.at(0), view.m_soRoutes.begin()->second);
+
+    view.releasePreMatchIndexes();
+
+    EXPECT_EQ(view.m_routesByPrefix.size(), 0);
+    EXPECT_EQ(view.m_neighborsByIp.size(), 0);
+
+    // objects are still present in view
+
+    EXPECT_EQ(view.m_soRoutes.size(), 1);
+}
@@ -1,8 +1,12 @@
 #include "BestCandidateFinder.h"
 #include "MockableSaiSwitchInterface.h"
 
+#include "meta/sai_serialize.h"
+
 #include <gtest/gtest.h>
 
+#include <set>
+
 using namespace syncd;
 using namespace unittests;
 
@@ -21,3 +25,256 @@ TEST(BestCandidateFinder, getSaiAttrFromDefaultValue)
     auto attr = BestCandidateFinder::getSaiAttrFromDefaultValue(av, sw, *meta);
     EXPECT_NE(attr, nullptr);
 }
+
+static swss::TableDump createWredDump(
+        _In_ const std::vector<uint32_t>& thresholds)
+{
+    SWSS_LOG_ENTER();
+
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"] = {
+        {"SAI_SWITCH_ATTR_INIT_SWITCH", "true"},
+        {"SAI_SWITCH_ATTR_SRC_MAC_ADDRESS", "02:00:00:00:00:01"},
+    };
+
+    for (size_t idx = 0; idx < thresholds.size(); idx++)
+    {
+        sai_object_id_t vid = ((sai_object_id_t)SAI_OBJECT_TYPE_WRED << 48) | (idx + 1);
+
+        dump["SAI_OBJECT_TYPE_WRED:" + sai_serialize_object_id(vid)] = {
+            {"SAI_WRED_ATTR_GREEN_ENABLE", "true"},
+            {"SAI_WRED_ATTR_GREEN_MIN_THRESHOLD", std::to_string(thresholds[idx])},
+        };
+    }
+
+    return dump;
+}
+
+TEST(BestCandidateFinder, findCurrentBestMatchParallel)
+{
+    std::vector<uint32_t> thresholds;
+
+    for (uint32_t idx = 0; idx < 1000; idx++)
+    {
+        thresholds.push_back(idx);
+    }
+
+    AsicView current;
+    AsicView temp;
+
+    current.fromDump(createWredDump(thresholds));
+    temp.fromDump(createWredDump({ 777 }));
+
+    auto sw = std::make_shared<MockableSaiSwitchInterface>(0,0);
+
+    auto tmpWred = temp.getObjectsByObjectType(SAI_OBJECT_TYPE_WRED).at(0);
+
+    auto serial = std::make_shared<BestCandidateFinder>(current, temp, sw);
+
+    auto match = serial->findCurrentBestMatch(tmpWred);
+
+    ASSERT_NE(match, nullptr);
+
+    EXPECT_EQ(match->getSaiAttr(SAI_WRED_ATTR_GREEN_MIN_THRESHOLD)->getStrAttrValue(), "777");
+
+    auto pool = std::make_shared<WorkerPool>(4);
+
+    auto parallel = std::make_shared<BestCandidateFinder>(current, temp, sw, pool);
+
+    EXPECT_EQ(parallel->findCurrentBestMatch(tmpWred), match);
+}
+
+static swss::TableDump createSamplepacketDump(
+        _In_ const std::vector<uint32_t>& rates)
+{
+    SWSS_LOG_ENTER();
+
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"] = {
+        {"SAI_SWITCH_ATTR_INIT_SWITCH", "true"},
+        {"SAI_SWITCH_ATTR_SRC_MAC_ADDRESS", "02:00:00:00:00:01"},
+    };
+
+    for (size_t idx = 0; idx < rates.size(); idx++)
+    {
+        sai_object_id_t vid = ((sai_object_id_t)SAI_OBJECT_TYPE_SAMPLEPACKET << 48) | (idx + 1);
+
+        dump["SAI_OBJECT_TYPE_SAMPLEPACKET:" + sai_serialize_object_id(vid)] = {
+            {"SAI_SAMPLEPACKET_ATTR_SAMPLE_RATE", std::to_string(rates[idx])},
+        };
+    }
+
+    return dump;
+}
+
+TEST(BestCandidateFinder, getAttributeSignature)
+{
+    AsicView view;
+
+    view.fromDump(createSamplepacketDump({ 10, 20, 10 }));
+
+    auto objs = view.getObjectsByObjectType(SAI_OBJECT_TYPE_SAMPLEPACKET);
+
+    ASSERT_EQ(objs.size(), 3);
+
+    std::set<std::string> signatures;
+
+    for (auto& obj: objs)
+    {
+        signatures.insert(AsicView::getAttributeSignature(obj));
+    }
+
+    EXPECT_EQ(signatures.size(), 2);
+}
+
+TEST(BestCandidateFinder, findCurrentBestMatchUsingSignature)
+{
+    std::vector<uint32_t> rates;
+
+    for (uint32_t idx = 1; idx <= 1000; idx++)
+    {
+        rates.push_back(idx);
+    }
+
+    AsicView current;
+    AsicView temp;
+
+    current.fromDump(createSamplepacketDump(rates));
+    temp.fromDump(createSamplepacketDump({ 777 }));
+
+    auto sw = std::make_shared<MockableSaiSwitchInterface>(0,0);
+
+    auto tmpObj = temp.getObjectsByObjectType(SAI_OBJECT_TYPE_SAMPLEPACKET).at(0);
+
+    auto bcf = std::make_shared<BestCandidateFinder>(current, temp, sw);
+
+    auto match = bcf->findCurrentBestMatch(tmpObj);
+
+    ASSERT_NE(match, nullptr);
+
+    EXPECT_FALSE(current.hasAttributeSignatureIndex());
+
+    current.buildAttributeSignatureIndex();
+
+    EXPECT_TRUE(current.hasAttributeSignatureIndex());
+
+    EXPECT_EQ(current.getNotProcessedObjectsByAttributeSignature(
+                SAI_OBJECT_TYPE_SAMPLEPACKET,
+                AsicView::getAttributeSignature(tmpObj)).size(), 1);
+
+    EXPECT_EQ(bcf->findCurrentBestMatch(tmpObj), match);
+
+    EXPECT_EQ(match->getSaiAttr(SAI_SAMPLEPACKET_ATTR_SAMPLE_RATE)->getStrAttrValue(), "777");
+}
+
+TEST(BestCandidateFinder, findCurrentBestMatchUsingSignatureAmbiguous)
+{
+    AsicView current;
+    AsicView temp;
+
+    current.fromDump(createSamplepacketDump({ 5, 7, 7 }));
+    temp.fromDump(createSamplepacketDump({ 7 }));
+
+    current.buildAttributeSignatureIndex();
+
+    auto sw = std::make_shared<MockableSaiSwitchInterface>(0,0);
+
+    auto tmpObj = temp.getObjectsByObjectType(SAI_OBJECT_TYPE_SAMPLEPACKET).at(0);
+
+    auto bcf = std::make_shared<BestCandidateFinder>(current, temp, sw);
+
+    // both candidates are exact, so all candidates are compared
+
+    auto match = bcf->findCurrentBestMatch(tmpObj);
+
+    ASSERT_NE(match, nullptr);
+
+    EXPECT_EQ(match->getSaiAttr(SAI_SAMPLEPACKET_ATTR_SAMPLE_RATE)->getStrAttrValue(), "7");
+}
+
+static sai_object_id_t createVid(
+        _In_ sai_object_type_t objectType,
+        _In_ uint64_t index)
+{
+    SWSS_LOG_ENTER();
+
+    return ((sai_object_id_t)objectType << 48) | index;
+}
+
+TEST(BestCandidateFinder, findCurrentBestMatchUsingSignatureSuperset)
+{
+    auto strScheduler = [](uint64_t index) {
+        return sai_serialize_object_id(createVid(SAI_OBJECT_TYPE_SCHEDULER, index)); };
+
+    auto strPort = [](uint64_t index) {
+        return sai_serialize_object_id(createVid(SAI_OBJECT_TYPE_PORT, index)); };
+
+    swss::TableDump currentDump = createSamplepacketDump({});
+    swss::TableDump tempDump = createSamplepacketDump({});
+
+    // exact signature match, not used by any object
+
+    currentDump["SAI_OBJECT_TYPE_SCHEDULER:" + strScheduler(1)] = {
+        {"SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT", "10"},
+    };
+
+    // has all attributes of temporary object and one more, used by port
+    // like temporary object
+
+    currentDump["SAI_OBJECT_TYPE_SCHEDULER:" + strScheduler(2)] = {
+        {"SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT", "10"},
+        {"SAI_SCHEDULER_ATTR_MIN_BANDWIDTH_RATE", "100"},
+    };
+
+    currentDump["SAI_OBJECT_TYPE_PORT:" + strPort(1)] = {
+        {"SAI_PORT_ATTR_QOS_SCHEDULER_PROFILE_ID", strScheduler(2)},
+    };
+
+    tempDump["SAI_OBJECT_TYPE_SCHEDULER:" + strScheduler(3)] = {
+        {"SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT", "10"},
+    };
+
+    tempDump["SAI_OBJECT_TYPE_PORT:" + strPort(2)] = {
+        {"SAI_PORT_ATTR_QOS_SCHEDULER_PROFILE_ID", strScheduler(3)},
+    };
+
+    AsicView current;
+    AsicView temp;
+
+    current.fromDump(currentDump);
+    temp.fromDump(tempDump);
+
+    auto sw = std::make_shared<MockableSaiSwitchInterface>(0,0);
+
+    auto tmpObj = temp.getObjectsByObjectType(SAI_OBJECT_TYPE_SCHEDULER).at(0);
+
+    auto bcf = std::make_shared<BestCandidateFinder>(current, temp, sw);
+
+    // both current objects have all attributes equal, usage count
+    // heuristic selects the one used by port
+
+    auto serialMatch = bcf->findCurrentBestMatch(tmpObj);
+
+    ASSERT_NE(serialMatch, nullptr);
+
+    EXPECT_EQ(serialMatch->m_str_object_id, strScheduler(2));
+
+    current.buildAttributeSignatureIndex();
+
+    EXPECT_EQ(current.getAttributeSignatureMaxAttrCount(SAI_OBJECT_TYPE_SCHEDULER), 2);
+
+    EXPECT_EQ(current.getNotProcessedObjectsByAttributeSignature(
+                SAI_OBJECT_TYPE_SCHEDULER,
+                AsicView::getAttributeSignature(tmpObj)).size(), 1);
+
+    // exact signature match is not the only best candidate, so index must
+    // not change the selection
+
+    EXPECT_EQ(bcf->findCurrentBestMatch(tmpObj), serialMatch);
+
+    current.releaseAttributeSignatureIndex();
+
+    EXPECT_FALSE(current.hasAttributeSignatureIndex());
+}
@@ -7,7 +7,7 @@
 using namespace syncd;
 
 const std::string expected_usage =
-R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-h]
+R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-P depth] [-c limit] [-R capacity] [-F] [-W size] [-k workers] [-j workers] [-D] [-e] [-I] [-h]
     -d --diag
         Enable diagnostic shell
     -p --profile profile
@@ -40,6 +40,26 @@ R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [
         Counter groups those support bulk polling
     -a --enableAttrVersionCheck
         Enable attribute SAI version check when performing SAI discovery
+    -P --requestPipelineDepth depth
+        Enable staged ASIC request pipeline with given depth, default: 0 (disabled)
+    -c --bulkCoalesceLimit limit
+        Coalesce consecutive create/remove entries into bulk calls (requires -l), default: 0 (disabled)
+    -R --notificationRing capacity
+        Use lock-free notification ring with given capacity, default: 0 (mutex queue)
+    -F --enableFdbCoalescing
+        Replace queued FDB notification with newer one for the same FDB entry
+    -W --redisWriteBehind size
+        Buffer up to size ASIC view changes in redis pipeline in sync mode, default: 0 (disabled)
+    -k --counterPollWorkers workers
+        Collect flex counter contexts concurrently on given number of threads, default: 0 (serial)
+    -j --applyViewWorkers workers
+        Evaluate apply view best match candidates on given number of threads, default: 0 (serial)
+    -D --enableBatchedDiscovery
+        Use multi attribute and bulk get when performing SAI discovery
+    -e --enableDiscoveryCache
+        Save discovered objects on warm shutdown and use them on warm boot instead of SAI discovery
+    -I --enableIdenticalEntryFilter
+        Pair identical route, neighbor, FDB and inseg entries before apply view comparison logic
     -h --help
         Print out this message
 )";
@@ -53,7 +73,8 @@ TEST(CommandLineOptions, getCommandLineString)
     EXPECT_EQ(str, " EnableDiagShell=NO EnableTempView=NO DisableExitSleep=NO EnableUnittests=NO"
             " EnableConsistencyCheck=NO EnableSyncMode=NO RedisCommunicationMode=redis_async"
             " EnableSaiBulkSuport=NO StartType=cold ProfileMapFile= GlobalContext=0 ContextConfig= BreakConfig="
-            " WatchdogWarnTimeSpan=30000000 SupportingBulkCounters= EnableAttrVersionCheck=NO");
+            " WatchdogWarnTimeSpan=30000000 SupportingBulkCounters= EnableAttrVersionCheck=NO"
+            " RequestPipelineDepth=0 BulkCoalesceLimit=0 NotificationRingCapacity=0 EnableFdbCoalescing=NO RedisWriteBehindBatchSize=0 CounterPollWorkers=0 ApplyViewWorkers=0 EnableBatchedDiscovery=NO EnableDiscoveryCache=NO EnableIdenticalEntryFilter=NO");
 }
 
 TEST(CommandLineOptions, startTypeStringToStartType)
@@ -81,9 +102,12 @@ TEST(CommandLineOptionsParser, parseCommandLine)
     char arg3[] = "1000";
     char arg4[] = "-B";
     char arg5[] = "WATERMARK";
-    std::vector<char *> args = {arg1, arg2, arg3, arg4, arg5};
+    char arg6[] = "-P";
+    char arg7[] = "32";
+    std::vector<char *> args = {arg1, arg2, arg3, arg4, arg5, arg6, arg7};
 
     auto opt = syncd::CommandLineOptionsParser::parseCommandLine((int)args.size(), args.data());
     EXPECT_EQ(opt->m_watchdogWarnTimeSpan, 1000);
     EXPECT_EQ(opt->m_supportingBulkCounterGroups, "WATERMARK");
+    EXPECT_EQ(opt->m_requestPipelineDepth, 32);
 }
@@ -0,0 +1,168 @@
+#include "CounterSerializationCache.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <limits>
+
+using namespace syncd;
+
+static std::string serializeQueueStat(
+        _In_ sai_queue_stat_t stat)
+{
+    SWSS_LOG_ENTER();
+
+    return sai_serialize_queue_stat(stat);
+}
+
+TEST(CounterSerializationCache, serializeCounterValue)
+{
+    std::string str;
+
+    serializeCounterValue(0, str);
+    EXPECT_EQ(str, "0");
+
+    serializeCounterValue(1234567890, str);
+    EXPECT_EQ(str, "1234567890");
+
+    serializeCounterValue(std::numeric_limits<uint64_t>::max(), str);
+    EXPECT_EQ(str, std::to_string(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(CounterSerializationCache, update)
+{
+    CounterSerializationCache cache;
+
+    std::vector<sai_queue_stat_t> ids = { SAI_QUEUE_STAT_PACKETS, SAI_QUEUE_STAT_BYTES };
+    std::vector<sai_object_id_t> vids = { 0x15000000000001, 0x15000000000002 };
+
+    EXPECT_TRUE(cache.update(ids, vids, serializeQueueStat));
+    EXPECT_FALSE(cache.update(ids, vids, serializeQueueStat));
+
+    EXPECT_EQ(cache.getObjectKey(1), "oid:0x15000000000002");
+
+    uint64_t counters[] = { 7, 42 };
+
+    auto& values = cache.serializeValues(counters);
+
+    ASSERT_EQ(values.size(), 2);
+    EXPECT_EQ(fvField(values[0]), "SAI_QUEUE_STAT_PACKETS");
+    EXPECT_EQ(fvValue(values[0]), "7");
+    EXPECT_EQ(fvField(values[1]), "SAI_QUEUE_STAT_BYTES");
+    EXPECT_EQ(fvValue(values[1]), "42");
+
+    vids.pop_back();
+
+    EXPECT_TRUE(cache.update(ids, vids, serializeQueueStat));
+    EXPECT_THROW(cache.getObjectKey(1), std::out_of_range);
+}
+
+TEST(CounterSerializationCache, serializeChangedValues)
+{
+    CounterSerializationCache cache;
+
+    std::vector<sai_queue_stat_t> ids = { SAI_QUEUE_STAT_PACKETS, SAI_QUEUE_STAT_BYTES };
+    std::vector<sai_object_id_t> vids = { 0x15000000000001 };
+
+    cache.update(ids, vids, serializeQueueStat);
+
+    uint64_t published[] = { 0, 0 };
+    uint64_t counters[] = { 0, 42 };
+
+    // first publish contains all counters
+
+    EXPECT_EQ(cache.serializeChangedValues(counters, published, true).size(), 2);
+    EXPECT_EQ(published[1], 42);
+
+    EXPECT_EQ(cache.serializeChangedValues(counters, published, false).size(), 0);
+
+    counters[0] = 7;
+
+    auto& values = cache.serializeChangedValues(counters, published, false);
+
+    ASSERT_EQ(values.size(), 1);
+    EXPECT_EQ(fvField(values[0]), "SAI_QUEUE_STAT_PACKETS");
+    EXPECT_EQ(fvValue(values[0]), "7");
+}
+
+/*
+ * Timing benchmark, disabled by default, run with:
+ * tests --gtest_also_run_disabled_tests --gtest_filter='*DISABLED_benchmark*'
+ */
+TEST(CounterSerializationCache, DISABLED_benchmark)
+{
+    // 5000 queues with 10 counters each, 50000 counters per poll
+
+    const size_t objectCount = 5000;
+    const int polls = 10;
+
+    std::vector<sai_queue_stat_t> ids;
+
+    for (int id = SAI_QUEUE_STAT_PACKETS; id < SAI_QUEUE_STAT_PACKETS + 10; id++)
+    {
+        ids.push_back((sai_queue_stat_t)id);
+    }
+
+    std::vector<sai_object_id_t> vids;
+
+    for (size_t idx = 0; idx < objectCount; idx++)
+    {
+        vids.push_back(0x15000000000000 + idx);
+    }
+
+    std::vector<uint64_t> counters(objectCount * ids.size());
+
+    for (size_t idx = 0; idx < counters.size(); idx++)
+    {
+        counters[idx] = idx * 1000003;
+    }
+
+    size_t checksum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int poll = 0; poll < polls; poll++)
+    {
+        std::vector<swss::FieldValueTuple> values;
+
+        for (size_t i = 0; i < objectCount; i++)
+        {
+            for (size_t j = 0; j < ids.size(); j++)
+            {
+                values.emplace_back(sai_serialize_queue_stat(ids[j]), std::to_string(counters[i * ids.size() + j]));
+            }
+
+            checksum += sai_serialize_object_id(vids[i]).size() + values.size();
+
+            values.clear();
+        }
+    }
+
+    auto middle = std::chrono::steady_clock::now();
+
+    CounterSerializationCache cache;
+
+    for (int poll = 0; poll < polls; poll++)
+    {
+        cache.update(ids, vids, serializeQueueStat);
+
+        for (size_t i = 0; i < objectCount; i++)
+        {
+            auto& values = cache.serializeValues(counters.data() + i * ids.size());
+
+            checksum -= cache.getObjectKey(i).size() + values.size();
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(checksum, 0);
+
+    double total = (double)(objectCount * ids.size() * polls);
+
+    double before = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(middle - start).count() / total;
+    double after = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - middle).count() / total;
+
+    std::cout << "counter serialization: before " << before << " ns/counter, after " << after << " ns/counter" << std::endl;
+}
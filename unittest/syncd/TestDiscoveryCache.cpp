@@ -0,0 +1,123 @@
+#include "DiscoveryCache.h"
+
+#include "MockableSaiInterface.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+#define SWITCH_RID  0x21000000000000
+#define VR_RID      0x3000000000001
+#define PORT_RID    0x1000000000002
+
+static std::shared_ptr<MockableSaiInterface> createSai()
+{
+    SWSS_LOG_ENTER();
+
+    auto sai = std::make_shared<MockableSaiInterface>();
+
+    sai->mock_objectTypeQuery = [](sai_object_id_t oid)
+    {
+        switch (oid)
+        {
+            case SWITCH_RID: return SAI_OBJECT_TYPE_SWITCH;
+            case VR_RID: return SAI_OBJECT_TYPE_VIRTUAL_ROUTER;
+            case PORT_RID: return SAI_OBJECT_TYPE_PORT;
+            default: return SAI_OBJECT_TYPE_NULL;
+        }
+    };
+
+    sai->mock_get = [](sai_object_type_t objectType, sai_object_id_t objectId, uint32_t attr_count, sai_attribute_t *attr_list)
+    {
+        if (attr_list[0].id == SAI_SWITCH_ATTR_PORT_LIST)
+        {
+            attr_list[0].value.objlist.count = 1;
+            attr_list[0].value.objlist.list[0] = PORT_RID;
+        }
+        else
+        {
+            attr_list[0].value.oid = attr_list[0].id == SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID ? VR_RID : SAI_NULL_OBJECT_ID;
+        }
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    return sai;
+}
+
+static std::unordered_map<std::string, std::string> toHash(
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    return { values.begin(), values.end() };
+}
+
+TEST(DiscoveryCache, serialize)
+{
+    auto sai = createSai();
+
+    DiscoveryCache cache(sai, SWITCH_RID, "hwinfo");
+
+    std::set<sai_object_id_t> rids = { SWITCH_RID, VR_RID, PORT_RID };
+
+    SaiDiscovery::DefaultOidMap map;
+
+    map[SWITCH_RID][SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID] = VR_RID;
+    map[SWITCH_RID][SAI_SWITCH_ATTR_QOS_DSCP_TO_TC_MAP] = SAI_NULL_OBJECT_ID;
+
+    auto hash = toHash(cache.serialize(rids, map));
+
+    std::set<sai_object_id_t> outRids;
+    SaiDiscovery::DefaultOidMap outMap;
+
+    EXPECT_TRUE(cache.deserialize(hash, outRids, outMap));
+
+    EXPECT_EQ(outRids, rids);
+    EXPECT_EQ(outMap, map);
+
+    // different hardware
+
+    DiscoveryCache other(sai, SWITCH_RID, "other");
+
+    EXPECT_FALSE(other.deserialize(hash, outRids, outMap));
+    EXPECT_TRUE(outRids.empty());
+
+    // corrupted entry
+
+    auto corrupted = hash;
+
+    corrupted["oid:0x3000000000001"] = "foo";
+
+    EXPECT_FALSE(cache.deserialize(corrupted, outRids, outMap));
+
+    EXPECT_FALSE(cache.deserialize({}, outRids, outMap));
+}
+
+TEST(DiscoveryCache, validate)
+{
+    auto sai = createSai();
+
+    DiscoveryCache cache(sai, SWITCH_RID, "hwinfo");
+
+    std::set<sai_object_id_t> outRids;
+    SaiDiscovery::DefaultOidMap outMap;
+
+    // read only attribute changed
+
+    SaiDiscovery::DefaultOidMap map;
+
+    map[SWITCH_RID][SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID] = VR_RID + 1;
+
+    EXPECT_FALSE(cache.deserialize(toHash(cache.serialize({ SWITCH_RID, VR_RID, PORT_RID }, map)), outRids, outMap));
+
+    // port missing
+
+    EXPECT_FALSE(cache.deserialize(toHash(cache.serialize({ SWITCH_RID, VR_RID }, {})), outRids, outMap));
+
+    // object no longer exists
+
+    EXPECT_FALSE(cache.deserialize(toHash(cache.serialize({ SWITCH_RID, VR_RID, PORT_RID, 0x5000000000001 }, {})), outRids, outMap));
+
+    EXPECT_TRUE(cache.deserialize(toHash(cache.serialize({ SWITCH_RID, VR_RID, PORT_RID }, {})), outRids, outMap));
+}
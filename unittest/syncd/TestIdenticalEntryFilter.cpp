@@ -0,0 +1,192 @@
+#include "IdenticalEntryFilter.h"
+#include "AsicView.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+#define SWITCH_KEY "SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"
+#define VR_KEY "SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000001"
+#define NH_KEY "SAI_OBJECT_TYPE_NEXT_HOP:oid:0x4000000000002"
+#define RIF_KEY "SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x6000000000001"
+
+static std::string routeKey(
+        _In_ const std::string& dest,
+        _In_ const std::string& vr = "oid:0x3000000000001")
+{
+    SWSS_LOG_ENTER();
+
+    return "SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"" + dest + "\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"" + vr + "\"}";
+}
+
+static std::string neighborKey(
+        _In_ const std::string& ip)
+{
+    SWSS_LOG_ENTER();
+
+    return "SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:{\"ip\":\"" + ip + "\",\"rif\":\"oid:0x6000000000001\",\"switch_id\":\"oid:0x21000000000000\"}";
+}
+
+static swss::TableDump createDump()
+{
+    SWSS_LOG_ENTER();
+
+    swss::TableDump dump;
+
+    dump[SWITCH_KEY] = { {"SAI_SWITCH_ATTR_INIT_SWITCH", "true"} };
+    dump[VR_KEY] = { };
+
+    dump[routeKey("10.0.0.0/24")] = { {"SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION", "SAI_PACKET_ACTION_DROP"} };
+    dump[routeKey("10.0.1.0/24")] = { {"SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION", "SAI_PACKET_ACTION_DROP"} };
+
+    return dump;
+}
+
+TEST(IdenticalEntryFilter, filter)
+{
+    auto current = createDump();
+    auto temp = createDump();
+
+    // different attribute value
+
+    temp[routeKey("10.0.1.0/24")] = { {"SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION", "SAI_PACKET_ACTION_TRAP"} };
+
+    // only in one view
+
+    current[routeKey("10.0.2.0/24")] = { };
+    temp[routeKey("10.0.3.0/24")] = { };
+
+    // next hop only in temporary view
+
+    temp[NH_KEY] = { };
+    current[routeKey("10.0.4.0/24")] = { {"SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID", "oid:0x4000000000002"} };
+    temp[routeKey("10.0.4.0/24")] = { {"SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID", "oid:0x4000000000002"} };
+
+    // object without attributes
+
+    current[routeKey("10.0.6.0/24")] = { {"NULL", "NULL"} };
+    temp[routeKey("10.0.6.0/24")] = { {"NULL", "NULL"} };
+
+    // null object id
+
+    current[routeKey("10.0.5.0/24")] = { {"SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID", "oid:0x0"} };
+    temp[routeKey("10.0.5.0/24")] = { {"SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID", "oid:0x0"} };
+
+    auto identical = IdenticalEntryFilter::filter(current, temp);
+
+    EXPECT_EQ(identical.size(), 3);
+
+    EXPECT_EQ(identical.count(routeKey("10.0.0.0/24")), 1);
+    EXPECT_EQ(identical.count(routeKey("10.0.5.0/24")), 1);
+    EXPECT_EQ(identical.count(routeKey("10.0.6.0/24")), 1);
+
+    EXPECT_EQ(identical.at(routeKey("10.0.0.0/24")).at("SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION"), "SAI_PACKET_ACTION_DROP");
+
+    // object id objects are never paired
+
+    EXPECT_EQ(current.count(SWITCH_KEY), 1);
+    EXPECT_EQ(temp.count(VR_KEY), 1);
+
+    EXPECT_EQ(current.count(routeKey("10.0.0.0/24")), 0);
+    EXPECT_EQ(temp.count(routeKey("10.0.0.0/24")), 0);
+
+    EXPECT_EQ(current.count(routeKey("10.0.1.0/24")), 1);
+    EXPECT_EQ(current.count(routeKey("10.0.2.0/24")), 1);
+    EXPECT_EQ(temp.count(routeKey("10.0.3.0/24")), 1);
+    EXPECT_EQ(current.count(routeKey("10.0.4.0/24")), 1);
+    EXPECT_EQ(temp.count(routeKey("10.0.4.0/24")), 1);
+}
+
+TEST(IdenticalEntryFilter, filterUnknownAttribute)
+{
+    auto current = createDump();
+
+    current[routeKey("10.0.0.0/24")] = { {"SAI_ROUTE_ENTRY_ATTR_FOO", "1"} };
+
+    auto temp = current;
+
+    auto identical = IdenticalEntryFilter::filter(current, temp);
+
+    // left for comparison logic, which will report error
+
+    EXPECT_EQ(identical.count(routeKey("10.0.0.0/24")), 0);
+
+    EXPECT_EQ(identical.size(), 1);
+}
+
+static void expectSameMatchingInputs(
+        _In_ const AsicView& filtered,
+        _In_ const AsicView& full)
+{
+    SWSS_LOG_ENTER();
+
+    // reference counts are used by usage heuristic and object removal
+
+    for (auto& kvp: full.m_oOids)
+    {
+        EXPECT_EQ(filtered.getVidReferenceCount(kvp.first), full.getVidReferenceCount(kvp.first)) << kvp.second->m_str_object_id;
+    }
+
+    // unique prefixes and IPs are used by pre match map
+
+    for (auto& pk: filtered.m_routesByPrefix)
+    {
+        EXPECT_EQ(pk.second.size(), full.m_routesByPrefix.at(pk.first).size()) << pk.first;
+    }
+
+    for (auto& pk: filtered.m_neighborsByIp)
+    {
+        EXPECT_EQ(pk.second.size(), full.m_neighborsByIp.at(pk.first).size()) << pk.first;
+    }
+}
+
+TEST(IdenticalEntryFilter, filterKeepsMatchingInputs)
+{
+    auto current = createDump();
+
+    current[RIF_KEY] = { {"SAI_ROUTER_INTERFACE_ATTR_VIRTUAL_ROUTER_ID", "oid:0x3000000000001"} };
+    current[NH_KEY] = { {"SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID", "oid:0x6000000000001"} };
+
+    current[routeKey("10.1.0.0/24")] = { {"SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID", "oid:0x4000000000002"} };
+    current[routeKey("10.2.0.0/24")] = { {"SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID", "oid:0x4000000000002"} };
+
+    current[neighborKey("10.0.0.1")] = { {"SAI_NEIGHBOR_ENTRY_ATTR_DST_MAC_ADDRESS", "02:00:00:00:00:02"} };
+
+    auto temp = current;
+
+    // same prefix in other virtual router in each view
+
+    current["SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000002"] = { };
+    current[routeKey("10.2.0.0/24", "oid:0x3000000000002")] = { {"SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID", "oid:0x4000000000002"} };
+
+    temp["SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000003"] = { };
+    temp[routeKey("10.2.0.0/24", "oid:0x3000000000003")] = { {"SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID", "oid:0x4000000000002"} };
+
+    AsicView fullCurrent(current);
+    AsicView fullTemp(temp);
+
+    auto identical = IdenticalEntryFilter::filter(current, temp);
+
+    EXPECT_EQ(identical.size(), 4);
+
+    EXPECT_EQ(identical.count(routeKey("10.1.0.0/24")), 1);
+    EXPECT_EQ(identical.count(neighborKey("10.0.0.1")), 1);
+
+    // pairing would make remaining 10.2.0.0/24 routes unique in both views
+
+    EXPECT_EQ(identical.count(routeKey("10.2.0.0/24")), 0);
+
+    AsicView filteredCurrent(current);
+    AsicView filteredTemp(temp);
+
+    auto references = IdenticalEntryFilter::getReferences(identical);
+
+    EXPECT_EQ(references.at(0x4000000000002), 1);
+    EXPECT_EQ(references.at(0x6000000000001), 1);
+
+    filteredCurrent.bindExternalReferences(references);
+    filteredTemp.bindExternalReferences(references);
+
+    expectSameMatchingInputs(filteredCurrent, fullCurrent);
+    expectSameMatchingInputs(filteredTemp, fullTemp);
+}
@@ -0,0 +1,36 @@
+#include "MemoryUsage.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace syncd;
+
+TEST(MemoryUsage, getResidentSetSize)
+{
+    auto rss = MemoryUsage::getResidentSetSize();
+
+    EXPECT_GT(rss, 0);
+
+    EXPECT_GE(MemoryUsage::getPeakResidentSetSize(), rss);
+}
+
+TEST(MemoryUsage, resetPeakResidentSetSize)
+{
+    {
+        std::vector<char> buffer(64 * 1024 * 1024, 1);
+
+        EXPECT_GE(MemoryUsage::getPeakResidentSetSize(), MemoryUsage::getResidentSetSize());
+    }
+
+    if (!MemoryUsage::resetPeakResidentSetSize())
+    {
+        // clear_refs not supported
+
+        return;
+    }
+
+    // after reset peak is close to current
+
+    EXPECT_LT(MemoryUsage::getPeakResidentSetSize(), MemoryUsage::getResidentSetSize() + 32 * 1024);
+}
@@ -82,3 +82,162 @@ TEST(NotificationQueue, tryDequeue)
 
     EXPECT_EQ(nq.getQueueSize(), 0);
 }
+
+TEST(NotificationQueue, ringEnqueueLimitTest)
+{
+    syncd::NotificationQueue nq(3, 3, 8);
+
+    EXPECT_TRUE(nq.isLockFree());
+
+    swss::KeyOpFieldsValuesTuple item("fdb_event", "data", {});
+
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(nq.enqueue(item), true);
+    }
+
+    EXPECT_EQ(nq.getQueueSize(), 3);
+    EXPECT_EQ(nq.getHighWaterMark(), 3);
+
+    // queue limit reached, fdb event will be dropped
+    EXPECT_EQ(nq.enqueue(item), false);
+    EXPECT_EQ(nq.getDropCount(), 1);
+
+    swss::KeyOpFieldsValuesTuple out;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(nq.tryDequeue(out), true);
+        EXPECT_EQ(kfvKey(out), "fdb_event");
+    }
+
+    EXPECT_EQ(nq.tryDequeue(out), false);
+    EXPECT_EQ(nq.getQueueSize(), 0);
+}
+
+TEST(NotificationQueue, ringFull)
+{
+    syncd::NotificationQueue nq(100, 3, 2);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        swss::KeyOpFieldsValuesTuple item("switch_state_change", std::to_string(i), {});
+
+        // ring has only 2 slots, rest goes to overflow queue
+        EXPECT_EQ(nq.enqueue(item), true);
+    }
+
+    EXPECT_EQ(nq.getDropCount(), 0);
+    EXPECT_EQ(nq.getQueueSize(), 5);
+
+    swss::KeyOpFieldsValuesTuple item("switch_state_change", "5", {});
+
+    EXPECT_EQ(nq.enqueue(item), true);
+
+    swss::KeyOpFieldsValuesTuple out;
+
+    for (int i = 0; i < 6; ++i)
+    {
+        EXPECT_EQ(nq.tryDequeue(out), true);
+        EXPECT_EQ(kfvOp(out), std::to_string(i));
+    }
+
+    EXPECT_EQ(nq.tryDequeue(out), false);
+    EXPECT_EQ(nq.getQueueSize(), 0);
+}
+
+TEST(NotificationQueue, ringOverflowDropPolicy)
+{
+    syncd::NotificationQueue nq(4, 3, 2);
+
+    swss::KeyOpFieldsValuesTuple fdb("fdb_event", "data", {});
+    swss::KeyOpFieldsValuesTuple ssc("switch_state_change", "data", {});
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(nq.enqueue(fdb), true);
+    }
+
+    // over limit, fdb events are dropped, other events until consecutive threshold
+
+    EXPECT_EQ(nq.enqueue(fdb), false);
+    EXPECT_EQ(nq.enqueue(ssc), true);
+    EXPECT_EQ(nq.enqueue(ssc), true);
+    EXPECT_EQ(nq.enqueue(ssc), false);
+
+    EXPECT_EQ(nq.getDropCount(), 2);
+    EXPECT_EQ(nq.getQueueSize(), 6);
+}
+
+static std::string fdbEvent(
+        _In_ const std::string& mac,
+        _In_ const std::string& event)
+{
+    SWSS_LOG_ENTER();
+
+    return "[{\"fdb_entry\":\"{\\\"bvid\\\":\\\"oid:0x260000000005be\\\",\\\"mac\\\":\\\"" + mac + "\\\",\\\"switch_id\\\":\\\"oid:0x21000000000000\\\"}\","
+        "\"fdb_event\":\"" + event + "\","
+        "\"list\":[{\"id\":\"SAI_FDB_ENTRY_ATTR_TYPE\",\"value\":\"SAI_FDB_ENTRY_TYPE_DYNAMIC\"},{\"id\":\"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID\",\"value\":\"oid:0x3a000000000660\"}]}]";
+}
+
+TEST(NotificationQueue, fdbCoalescing)
+{
+    syncd::NotificationQueue nq(5, 3, 0, true);
+
+    std::vector<swss::FieldValueTuple> entry;
+
+    auto learnedA = fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_LEARNED");
+    auto agedA = fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_AGED");
+    auto learnedB = fdbEvent("52:54:00:86:DD:7B", "SAI_FDB_EVENT_LEARNED");
+
+    EXPECT_TRUE(nq.enqueue({SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, learnedA, entry}));
+    EXPECT_TRUE(nq.enqueue({SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, learnedB, entry}));
+
+    // flap of A collapses into first queued notification
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_TRUE(nq.enqueue({SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, agedA, entry}));
+        EXPECT_TRUE(nq.enqueue({SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, learnedA, entry}));
+    }
+
+    EXPECT_TRUE(nq.enqueue({SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, agedA, entry}));
+
+    EXPECT_EQ(nq.getQueueSize(), 2);
+    EXPECT_EQ(nq.getCoalescedCount(), 21);
+    EXPECT_EQ(nq.getDropCount(), 0);
+
+    swss::KeyOpFieldsValuesTuple item;
+
+    EXPECT_TRUE(nq.tryDequeue(item));
+    EXPECT_EQ(kfvOp(item), agedA);
+
+    // A is no longer queued, so it will be queued again
+    EXPECT_TRUE(nq.enqueue({SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, learnedA, entry}));
+
+    EXPECT_TRUE(nq.tryDequeue(item));
+    EXPECT_EQ(kfvOp(item), learnedB);
+
+    EXPECT_TRUE(nq.tryDequeue(item));
+    EXPECT_EQ(kfvOp(item), learnedA);
+
+    EXPECT_FALSE(nq.tryDequeue(item));
+}
+
+TEST(NotificationQueue, fdbCoalescingBarrier)
+{
+    syncd::NotificationQueue nq(5, 3, 0, true);
+
+    std::vector<swss::FieldValueTuple> entry;
+
+    auto learnedA = fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_LEARNED");
+    auto flush = fdbEvent("00:00:00:00:00:00", "SAI_FDB_EVENT_FLUSHED");
+
+    EXPECT_TRUE(nq.enqueue({SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, learnedA, entry}));
+    EXPECT_TRUE(nq.enqueue({SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, flush, entry}));
+
+    // learned after flush must not be merged before flush
+    EXPECT_TRUE(nq.enqueue({SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, learnedA, entry}));
+
+    EXPECT_EQ(nq.getQueueSize(), 3);
+    EXPECT_EQ(nq.getCoalescedCount(), 0);
+}
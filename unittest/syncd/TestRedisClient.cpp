@@ -0,0 +1,128 @@
+#include "RedisClient.h"
+
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace syncd;
+
+TEST(RedisClient, writeBehind)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    RedisClient client(dbAsic);
+
+    client.setWriteBehind(4, 60000);
+
+    sai_object_meta_key_t metaKey;
+
+    metaKey.objecttype = SAI_OBJECT_TYPE_PORT;
+    metaKey.objectkey.key.object_id = 0x1000000000001;
+
+    std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
+
+    dbAsic->del(key);
+
+    client.createAsicObject(metaKey, {});
+    client.setAsicObject(metaKey, "SAI_PORT_ATTR_MTU", "9100");
+
+    EXPECT_EQ(client.getWriteBehindBufferedCount(), 2);
+
+    // changes are only buffered
+
+    EXPECT_FALSE(dbAsic->exists(key));
+
+    client.flush();
+
+    EXPECT_EQ(client.getWriteBehindBufferedCount(), 0);
+
+    EXPECT_TRUE(dbAsic->exists(key));
+
+    auto mtu = dbAsic->hget(key, "SAI_PORT_ATTR_MTU");
+
+    ASSERT_NE(mtu, nullptr);
+    EXPECT_EQ(*mtu, "9100");
+
+    client.removeAsicObject(metaKey);
+
+    // reading ASIC view flushes buffered changes
+
+    auto attrs = client.getAttributesFromAsicKey(key);
+
+    EXPECT_EQ(attrs.size(), 0);
+    EXPECT_FALSE(dbAsic->exists(key));
+}
+
+TEST(RedisClient, writeBehindBatchSize)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    RedisClient client(dbAsic);
+
+    client.setWriteBehind(2, 60000);
+
+    sai_object_meta_key_t metaKey;
+
+    metaKey.objecttype = SAI_OBJECT_TYPE_PORT;
+    metaKey.objectkey.key.object_id = 0x1000000000002;
+
+    std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
+
+    client.createAsicObject(metaKey, {});
+    client.setAsicObject(metaKey, "SAI_PORT_ATTR_MTU", "9100");
+
+    // batch size reached, pipeline was flushed
+
+    EXPECT_EQ(client.getWriteBehindBufferedCount(), 0);
+    EXPECT_TRUE(dbAsic->exists(key));
+
+    client.setWriteBehind(0);
+
+    client.removeAsicObject(metaKey);
+
+    EXPECT_FALSE(dbAsic->exists(key));
+}
+
+TEST(RedisClient, flushExpired)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    RedisClient client(dbAsic);
+
+    client.setWriteBehind(16, 10);
+
+    sai_object_meta_key_t metaKey;
+
+    metaKey.objecttype = SAI_OBJECT_TYPE_PORT;
+    metaKey.objectkey.key.object_id = 0x1000000000003;
+
+    std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
+
+    dbAsic->del(key);
+
+    client.createAsicObject(metaKey, {});
+
+    // max delay not exceeded yet
+
+    client.flushExpired();
+
+    EXPECT_EQ(client.getWriteBehindBufferedCount(), 1);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // no more changes are buffered, but max delay is exceeded
+
+    client.flushExpired();
+
+    EXPECT_EQ(client.getWriteBehindBufferedCount(), 0);
+    EXPECT_TRUE(dbAsic->exists(key));
+
+    client.setWriteBehind(0);
+
+    client.removeAsicObject(metaKey);
+}
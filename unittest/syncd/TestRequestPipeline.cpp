@@ -0,0 +1,110 @@
+#include "RequestPipeline.h"
+
+#include "sairediscommon.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+
+using namespace syncd;
+
+static std::shared_ptr<PipelineRequest> makeRequest(
+        _In_ int idx)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    swss::KeyOpFieldsValuesTuple kco(std::to_string(idx), REDIS_ASIC_STATE_COMMAND_CREATE, values);
+
+    return std::make_shared<PipelineRequest>(SAI_COMMON_API_CREATE, kco);
+}
+
+TEST(RequestPipeline, ctr)
+{
+    EXPECT_THROW(RequestPipeline(0, [](PipelineRequest&){}), std::runtime_error);
+
+    EXPECT_THROW(RequestPipeline(1, nullptr), std::runtime_error);
+
+    RequestPipeline pipeline(4, [](PipelineRequest&){});
+
+    EXPECT_EQ(pipeline.getDepth(), 4);
+    EXPECT_EQ(pipeline.getInFlightCount(), 0);
+    EXPECT_EQ(pipeline.pop(), nullptr);
+    EXPECT_EQ(pipeline.tryPop(), nullptr);
+}
+
+TEST(RequestPipeline, preservesOrder)
+{
+    std::atomic<int> executed(0);
+
+    RequestPipeline pipeline(2, [&](PipelineRequest& request)
+    {
+        // execute stage must see requests in push order
+
+        EXPECT_EQ(kfvKey(request.m_kco), std::to_string(executed.load()));
+
+        if (executed % 3 == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        request.m_status = SAI_STATUS_SUCCESS;
+
+        executed++;
+    });
+
+    int popped = 0;
+
+    for (int idx = 0; idx < 100; idx++)
+    {
+        pipeline.push(makeRequest(idx));
+
+        while (auto request = pipeline.tryPop())
+        {
+            EXPECT_EQ(kfvKey(request->m_kco), std::to_string(popped++));
+            EXPECT_EQ(request->m_status, SAI_STATUS_SUCCESS);
+        }
+    }
+
+    while (auto request = pipeline.pop())
+    {
+        EXPECT_EQ(kfvKey(request->m_kco), std::to_string(popped++));
+    }
+
+    EXPECT_EQ(popped, 100);
+    EXPECT_EQ(executed, 100);
+    EXPECT_EQ(pipeline.getInFlightCount(), 0);
+}
+
+TEST(RequestPipeline, exception)
+{
+    RequestPipeline pipeline(1, [](PipelineRequest& request)
+    {
+        if (kfvKey(request.m_kco) == "1")
+        {
+            SWSS_LOG_THROW("execute failed");
+        }
+
+        request.m_status = SAI_STATUS_SUCCESS;
+    });
+
+    pipeline.push(makeRequest(0));
+    pipeline.push(makeRequest(1));
+    pipeline.push(makeRequest(2));
+
+    auto r0 = pipeline.pop();
+    auto r1 = pipeline.pop();
+    auto r2 = pipeline.pop();
+
+    EXPECT_EQ(r0->m_exception, nullptr);
+    EXPECT_NE(r1->m_exception, nullptr);
+    EXPECT_EQ(r2->m_exception, nullptr);
+
+    EXPECT_EQ(r1->m_status, SAI_STATUS_NOT_EXECUTED);
+
+    EXPECT_THROW(std::rethrow_exception(r1->m_exception), std::runtime_error);
+
+    EXPECT_EQ(pipeline.pop(), nullptr);
+}
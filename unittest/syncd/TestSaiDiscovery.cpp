@@ -0,0 +1,167 @@
+#include "SaiDiscovery.h"
+#include "VendorSaiOptions.h"
+
+#include "MockableSaiInterface.h"
+
+#include "meta/sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+#define SWITCH_RID  0x21000000000000
+#define VR_RID      0x3000000000001
+#define PORT_RID    0x1000000000000
+#define QUEUE_RID   0x15000000000000
+
+static const uint32_t portCount = 4;
+
+static sai_object_type_t objectTypeQuery(
+        _In_ sai_object_id_t oid)
+{
+    SWSS_LOG_ENTER();
+
+    switch (oid & 0xffff000000000000)
+    {
+        case SWITCH_RID & 0xffff000000000000:
+            return SAI_OBJECT_TYPE_SWITCH;
+        case QUEUE_RID & 0xffff000000000000:
+            return SAI_OBJECT_TYPE_QUEUE;
+        case VR_RID & 0xffff000000000000:
+            return SAI_OBJECT_TYPE_VIRTUAL_ROUTER;
+        case PORT_RID & 0xffff000000000000:
+            return SAI_OBJECT_TYPE_PORT;
+        default:
+            return SAI_OBJECT_TYPE_NULL;
+    }
+}
+
+static sai_status_t get(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        auto& attr = attr_list[idx];
+
+        auto md = sai_metadata_get_attr_metadata(objectType, attr.id);
+
+        if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
+        {
+            attr.value.oid = (objectType == SAI_OBJECT_TYPE_SWITCH && attr.id == SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID)
+                ? VR_RID
+                : SAI_NULL_OBJECT_ID;
+
+            continue;
+        }
+
+        uint32_t count = 0;
+
+        if (objectType == SAI_OBJECT_TYPE_SWITCH && attr.id == SAI_SWITCH_ATTR_PORT_LIST)
+        {
+            for (; count < portCount; count++)
+                attr.value.objlist.list[count] = PORT_RID + count;
+        }
+        else if (objectType == SAI_OBJECT_TYPE_PORT && attr.id == SAI_PORT_ATTR_QOS_QUEUE_LIST)
+        {
+            // each port has 2 queues
+
+            for (; count < 2; count++)
+                attr.value.objlist.list[count] = QUEUE_RID + 2 * (objectId - PORT_RID) + count;
+        }
+        else if (objectType == SAI_OBJECT_TYPE_PORT && attr.id == SAI_PORT_ATTR_INGRESS_MIRROR_SESSION)
+        {
+            // not supported by vendor, forces per attribute get
+
+            return SAI_STATUS_ATTR_NOT_SUPPORTED_0;
+        }
+
+        attr.value.objlist.count = count;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static std::shared_ptr<MockableSaiInterface> createSai(
+        _In_ bool batched)
+{
+    SWSS_LOG_ENTER();
+
+    auto sai = std::make_shared<MockableSaiInterface>();
+
+    auto vso = std::make_shared<VendorSaiOptions>();
+
+    vso->m_batchedDiscovery = batched;
+
+    sai->setOptions(VendorSaiOptions::OPTIONS_KEY, vso);
+
+    sai->mock_objectTypeQuery = objectTypeQuery;
+    sai->mock_get = get;
+
+    return sai;
+}
+
+TEST(SaiDiscovery, discoverBatched)
+{
+    auto sai = createSai(false);
+
+    SaiDiscovery recursive(sai);
+
+    auto expected = recursive.discover(SWITCH_RID);
+
+    auto expectedDefaultOidMap = recursive.getDefaultOidMap();
+
+    // switch, default virtual router, ports and their queues
+
+    EXPECT_EQ(expected.size(), 2 + 3 * portCount);
+
+    sai = createSai(true);
+
+    uint32_t bulkGetCount = 0;
+
+    sai->mock_bulkGet = [&](sai_object_type_t objectType, uint32_t object_count, const sai_object_id_t *object_id,
+            const uint32_t *attr_count, sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        bulkGetCount++;
+
+        for (uint32_t idx = 0; idx < object_count; idx++)
+        {
+            object_statuses[idx] = get(objectType, object_id[idx], attr_count[idx], attr_list[idx]);
+        }
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    SaiDiscovery batched(sai);
+
+    EXPECT_EQ(batched.discover(SWITCH_RID), expected);
+
+    EXPECT_EQ(batched.getDefaultOidMap(), expectedDefaultOidMap);
+
+    // one bulk get for ports and one for queues
+
+    EXPECT_EQ(bulkGetCount, 2);
+}
+
+TEST(SaiDiscovery, discoverBatchedBulkNotSupported)
+{
+    auto sai = createSai(false);
+
+    SaiDiscovery recursive(sai, SaiDiscovery::Flags::SkipDefaultEmptyAttributes);
+
+    auto expected = recursive.discover(SWITCH_RID);
+
+    sai = createSai(false);
+
+    // mock bulk get returns not implemented
+
+    SaiDiscovery batched(sai, SaiDiscovery::Flags::SkipDefaultEmptyAttributes | SaiDiscovery::Flags::BatchedAttributes);
+
+    EXPECT_EQ(batched.discover(SWITCH_RID), expected);
+
+    EXPECT_EQ(batched.getDefaultOidMap(), recursive.getDefaultOidMap());
+}
@@ -678,4 +678,130 @@ TEST_F(SyncdTest, BulkRemoveTest)
 
     m_syncd->processEvent(*channel);
 }
+
+TEST_F(SyncdTest, CoalesceRouteEntriesTest)
+{
+    m_opt->m_enableSaiBulkSupport = true;
+    m_opt->m_bulkCoalesceLimit = 2;
+
+    auto translator = m_syncd->m_translator;
+    translator->insertRidAndVid(0x11000000000001, 0x21000000000000); // Switch
+    translator->insertRidAndVid(0x13000000000022, 0x3000000000022); // Virtual router
+
+    std::vector<swss::FieldValueTuple> values = {
+        {"SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION", "SAI_PACKET_ACTION_DROP"}
+    };
+
+    std::vector<swss::KeyOpFieldsValuesTuple> events;
+
+    for (int idx = 1; idx <= 3; idx++)
+    {
+        std::string key = "SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0." + std::to_string(idx) +
+            "/32\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}";
+
+        events.push_back(std::make_tuple(key, REDIS_ASIC_STATE_COMMAND_CREATE, values));
+    }
+
+    std::vector<swss::FieldValueTuple> noValues;
+
+    events.push_back(std::make_tuple(kfvKey(events.at(0)), REDIS_ASIC_STATE_COMMAND_REMOVE, noValues));
+
+    auto channel = std::make_shared<MockSelectableChannel>();
+    size_t popCallCount = 0;
+
+    EXPECT_CALL(*channel, empty())
+        .WillRepeatedly([&popCallCount, &events]() {
+            return popCallCount >= events.size();
+        });
+    EXPECT_CALL(*channel, pop(testing::_, testing::_))
+        .Times((int)events.size())
+        .WillRepeatedly(testing::Invoke([&popCallCount, &events](swss::KeyOpFieldsValuesTuple& kco, bool) {
+            kco = events.at(popCallCount++);
+        }));
+
+    // batch of 2 creates, single create, single remove, all executed in async mode
+
+    EXPECT_NO_THROW(m_syncd->processEvent(*channel));
+}
+
+TEST_F(SyncdTest, CoalesceRouteEntriesPartialFailureTest)
+{
+    m_opt->m_enableSaiBulkSupport = true;
+    m_opt->m_bulkCoalesceLimit = 3;
+    m_opt->m_enableSyncMode = true;
+
+    auto syncd = std::make_shared<Syncd>(m_sai, m_opt, false);
+
+    auto translator = syncd->m_translator;
+    translator->insertRidAndVid(0x11000000000001, 0x21000000000000); // Switch
+    translator->insertRidAndVid(0x13000000000022, 0x3000000000022); // Virtual router
+
+    std::vector<swss::FieldValueTuple> values = {
+        {"SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION", "SAI_PACKET_ACTION_DROP"}
+    };
+
+    std::vector<swss::KeyOpFieldsValuesTuple> events;
+
+    for (int idx = 1; idx <= 3; idx++)
+    {
+        std::string key = "SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0." + std::to_string(idx) +
+            "/32\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}";
+
+        events.push_back(std::make_tuple(key, REDIS_ASIC_STATE_COMMAND_CREATE, values));
+    }
+
+    // second entry in bulk fails
+
+    m_sai->mock_bulkCreateRouteEntry = [](
+        uint32_t object_count,
+        const sai_route_entry_t*,
+        const uint32_t*,
+        const sai_attribute_t**,
+        sai_bulk_op_error_mode_t,
+        sai_status_t* object_statuses) -> sai_status_t {
+
+            for (uint32_t idx = 0; idx < object_count; idx++)
+            {
+                object_statuses[idx] = (idx == 1) ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+            }
+
+            return SAI_STATUS_FAILURE;
+    };
+
+    auto responses = std::make_shared<MockSelectableChannel>();
+
+    std::vector<std::string> statuses;
+
+    EXPECT_CALL(*responses, set(testing::_, testing::_, REDIS_ASIC_STATE_COMMAND_GETRESPONSE))
+        .WillRepeatedly(testing::Invoke([&statuses](const std::string& key, const std::vector<swss::FieldValueTuple>&, const std::string&) {
+            statuses.push_back(key);
+        }));
+
+    syncd->m_selectableChannel = responses;
+
+    auto channel = std::make_shared<MockSelectableChannel>();
+    size_t popCallCount = 0;
+
+    EXPECT_CALL(*channel, empty())
+        .WillRepeatedly([&popCallCount, &events]() {
+            return popCallCount >= events.size();
+        });
+    EXPECT_CALL(*channel, pop(testing::_, testing::_))
+        .Times((int)events.size())
+        .WillRepeatedly(testing::Invoke([&popCallCount, &events](swss::KeyOpFieldsValuesTuple& kco, bool) {
+            kco = events.at(popCallCount++);
+        }));
+
+    EXPECT_NO_THROW(syncd->processEvent(*channel));
+
+    EXPECT_EQ(statuses, std::vector<std::string>({"SAI_STATUS_SUCCESS", "SAI_STATUS_FAILURE", "SAI_STATUS_SUCCESS"}));
+
+    // only successful entries are written to ASIC_DB
+
+    swss::DBConnector db("ASIC_DB", 0, true);
+
+    EXPECT_TRUE(db.exists("ASIC_STATE:" + kfvKey(events.at(0))));
+    EXPECT_FALSE(db.exists("ASIC_STATE:" + kfvKey(events.at(1))));
+    EXPECT_TRUE(db.exists("ASIC_STATE:" + kfvKey(events.at(2))));
+}
 #endif
@@ -0,0 +1,56 @@
+#include "WorkerPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+using namespace syncd;
+
+TEST(WorkerPool, ctr)
+{
+    EXPECT_THROW(std::make_shared<WorkerPool>(0), std::runtime_error);
+
+    WorkerPool pool(3);
+
+    EXPECT_EQ(pool.getThreadCount(), 3);
+
+    EXPECT_THROW(pool.submit(nullptr), std::runtime_error);
+}
+
+TEST(WorkerPool, submit)
+{
+    WorkerPool pool(4);
+
+    std::atomic<int> sum(0);
+
+    std::vector<std::future<void>> futures;
+
+    for (int i = 1; i <= 100; i++)
+    {
+        futures.push_back(pool.submit([&sum, i]() { sum += i; }));
+    }
+
+    for (auto& f: futures)
+    {
+        f.get();
+    }
+
+    EXPECT_EQ(sum, 5050);
+}
+
+TEST(WorkerPool, exception)
+{
+    WorkerPool pool(1);
+
+    auto f = pool.submit([]() { throw std::runtime_error("collect failed"); });
+
+    EXPECT_THROW(f.get(), std::runtime_error);
+
+    // worker is still alive after exception
+
+    bool executed = false;
+
+    pool.submit([&executed]() { executed = true; }).get();
+
+    EXPECT_TRUE(executed);
+}
@@ -0,0 +1,103 @@
+#include "FdbAgingWheel.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace saivs;
+
+static FdbInfo getFdbInfo(
+        _In_ sai_vlan_id_t vlanId,
+        _In_ uint32_t timestamp)
+{
+    FdbInfo fi;
+
+    fi.setVlanId(vlanId);
+    fi.setTimestamp(timestamp);
+
+    return fi;
+}
+
+TEST(FdbAgingWheel, schedule)
+{
+    FdbAgingWheel wheel;
+
+    EXPECT_EQ(wheel.size(), 0);
+
+    wheel.schedule(getFdbInfo(1, 1000));
+    wheel.schedule(getFdbInfo(2, 1000));
+
+    EXPECT_EQ(wheel.size(), 2);
+
+    // same FDB info is scheduled only once
+
+    wheel.schedule(getFdbInfo(1, 1010));
+
+    EXPECT_EQ(wheel.size(), 2);
+
+    wheel.clear();
+
+    EXPECT_EQ(wheel.size(), 0);
+}
+
+TEST(FdbAgingWheel, advance)
+{
+    FdbAgingWheel wheel;
+
+    wheel.schedule(getFdbInfo(1, 1000));
+    wheel.schedule(getFdbInfo(2, 1005));
+    wheel.schedule(getFdbInfo(3, 1100));
+    wheel.schedule(getFdbInfo(4, 10000));
+    wheel.schedule(getFdbInfo(5, 1000000));
+
+    std::vector<sai_vlan_id_t> expired;
+
+    auto callback = [&](const FdbInfo& fi) { expired.push_back(fi.getVlanId()); };
+
+    wheel.advance(999, callback);
+
+    EXPECT_EQ(expired.size(), 0);
+
+    wheel.advance(1005, callback);
+
+    EXPECT_EQ(expired, std::vector<sai_vlan_id_t>({1, 2}));
+
+    wheel.advance(9999, callback);
+
+    EXPECT_EQ(expired, std::vector<sai_vlan_id_t>({1, 2, 3}));
+
+    wheel.advance(1000000, callback);
+
+    EXPECT_EQ(expired, std::vector<sai_vlan_id_t>({1, 2, 3, 4, 5}));
+
+    EXPECT_EQ(wheel.size(), 0);
+}
+
+TEST(FdbAgingWheel, advance_reschedule)
+{
+    FdbAgingWheel wheel;
+
+    wheel.schedule(getFdbInfo(1, 1000));
+
+    int count = 0;
+
+    wheel.advance(1000, [&](const FdbInfo& fi) {
+
+            count++;
+
+            // refreshed entry is scheduled again from callback
+            wheel.schedule(getFdbInfo(fi.getVlanId(), 1010));
+    });
+
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(wheel.size(), 1);
+
+    wheel.advance(1009, [&](const FdbInfo&) { count++; });
+
+    EXPECT_EQ(count, 1);
+
+    wheel.advance(1010, [&](const FdbInfo&) { count++; });
+
+    EXPECT_EQ(count, 2);
+    EXPECT_EQ(wheel.size(), 0);
+}
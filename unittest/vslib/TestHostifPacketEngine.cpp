@@ -0,0 +1,213 @@
+#include "HostifPacketEngine.h"
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace saivs;
+
+#define FRAME_SIZE 64
+#define BENCHMARK_FRAMES 100000
+
+struct HostifPair
+{
+    int m_veth[2];
+
+    int m_tap[2];
+
+    std::shared_ptr<HostInterfaceInfo> m_info;
+};
+
+static std::vector<HostifPair> createHostifs(
+        _In_ size_t count,
+        _In_ std::shared_ptr<EventQueue> eq)
+{
+    std::vector<HostifPair> hostifs(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        auto& h = hostifs[i];
+
+        EXPECT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, h.m_veth), 0);
+        EXPECT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, h.m_tap), 0);
+
+        // tap end is closed by host interface info destructor
+
+        h.m_info = std::make_shared<HostInterfaceInfo>(0, h.m_veth[0], h.m_tap[0], "tap" + std::to_string(i), 0, eq);
+
+        struct timeval tv = { 0, 200 * 1000 };
+
+        setsockopt(h.m_veth[1], SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        setsockopt(h.m_tap[1], SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    }
+
+    return hostifs;
+}
+
+static void destroyHostifs(
+        _Inout_ std::vector<HostifPair>& hostifs)
+{
+    for (auto& h: hostifs)
+    {
+        h.m_info = nullptr;
+
+        close(h.m_veth[0]);
+        close(h.m_veth[1]);
+        close(h.m_tap[1]);
+    }
+}
+
+/**
+ * @brief Sends frames from veth side and counts frames received on tap side,
+ * returns frames per second.
+ */
+static double measureVethToTap(
+        _In_ std::vector<HostifPair>& hostifs,
+        _In_ size_t frames,
+        _Out_ size_t& received)
+{
+    unsigned char frame[FRAME_SIZE] = { 0 };
+
+    std::atomic<size_t> count(0);
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> receivers;
+
+    for (auto& h: hostifs)
+    {
+        int fd = h.m_tap[1];
+
+        receivers.emplace_back([fd, &count]() {
+                unsigned char buffer[FRAME_SIZE * 2];
+
+                // frames may be dropped when tap is full, stop on timeout
+
+                while (read(fd, buffer, sizeof(buffer)) > 0)
+                {
+                    count++;
+                }
+        });
+    }
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        while (write(hostifs[i % hostifs.size()].m_veth[1], frame, sizeof(frame)) < 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto& t: receivers)
+    {
+        t.join();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    received = count;
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    return (double)received / seconds;
+}
+
+TEST(HostifPacketEngine, ctr)
+{
+    EXPECT_THROW(std::make_shared<HostifPacketEngine>(0), std::runtime_error);
+
+    HostifPacketEngine engine(2);
+
+    EXPECT_EQ(engine.getThreadCount(), 2);
+    EXPECT_EQ(engine.getInterfaceCount(), 0);
+}
+
+TEST(HostifPacketEngine, forward)
+{
+    auto eq = std::make_shared<EventQueue>(std::make_shared<Signal>());
+
+    auto engine = std::make_shared<HostifPacketEngine>(2);
+
+    auto hostifs = createHostifs(4, eq);
+
+    for (auto& h: hostifs)
+    {
+        h.m_info->runPacketEngine(engine);
+    }
+
+    EXPECT_EQ(engine->getInterfaceCount(), 4);
+
+    unsigned char frame[FRAME_SIZE] = { 0 };
+    unsigned char buffer[FRAME_SIZE * 2];
+
+    for (auto& h: hostifs)
+    {
+        for (int i = 0; i < 10; i++)
+        {
+            EXPECT_EQ(write(h.m_veth[1], frame, FRAME_SIZE), FRAME_SIZE);
+            EXPECT_EQ(write(h.m_tap[1], frame, FRAME_SIZE - 4), FRAME_SIZE - 4);
+        }
+    }
+
+    for (auto& h: hostifs)
+    {
+        for (int i = 0; i < 10; i++)
+        {
+            EXPECT_EQ(read(h.m_tap[1], buffer, sizeof(buffer)), FRAME_SIZE);
+            EXPECT_EQ(read(h.m_veth[1], buffer, sizeof(buffer)), FRAME_SIZE - 4);
+        }
+    }
+
+    destroyHostifs(hostifs);
+
+    EXPECT_EQ(engine->getInterfaceCount(), 0);
+}
+
+/*
+ * Timing benchmark, disabled by default, run with:
+ * tests --gtest_also_run_disabled_tests --gtest_filter='*DISABLED_benchmark*'
+ */
+TEST(HostifPacketEngine, DISABLED_benchmark)
+{
+    auto eq = std::make_shared<EventQueue>(std::make_shared<Signal>());
+
+    size_t received = 0;
+
+    auto hostifs = createHostifs(4, eq);
+
+    for (auto& h: hostifs)
+    {
+        h.m_info->runThreads();
+    }
+
+    double threadsPps = measureVethToTap(hostifs, BENCHMARK_FRAMES, received);
+
+    EXPECT_GT(received, 0);
+
+    destroyHostifs(hostifs);
+
+    auto engine = std::make_shared<HostifPacketEngine>(1);
+
+    hostifs = createHostifs(4, eq);
+
+    for (auto& h: hostifs)
+    {
+        h.m_info->runPacketEngine(engine);
+    }
+
+    double enginePps = measureVethToTap(hostifs, BENCHMARK_FRAMES, received);
+
+    EXPECT_GT(received, 0);
+
+    destroyHostifs(hostifs);
+
+    printf("veth to tap: dedicated threads %.0f pps, packet engine %.0f pps\n", threadsPps, enginePps);
+}
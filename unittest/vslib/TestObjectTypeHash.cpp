@@ -0,0 +1,154 @@
+#include "ObjectTypeHash.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+using namespace saivs;
+
+static std::string key(
+        _In_ size_t idx)
+{
+    SWSS_LOG_ENTER();
+
+    return "oid:0x" + std::to_string(idx);
+}
+
+TEST(ObjectTypeHash, operator_brackets)
+{
+    ObjectTypeHash hash;
+
+    EXPECT_TRUE(hash.empty());
+
+    hash["oid:0x1"] = {};
+
+    EXPECT_EQ(hash.size(), 1);
+    EXPECT_EQ(hash.count("oid:0x1"), 1);
+    EXPECT_EQ(hash.count("oid:0x2"), 0);
+
+    hash["oid:0x1"]["SAI_PORT_ATTR_MTU"] = nullptr;
+
+    EXPECT_EQ(hash.size(), 1);
+    EXPECT_EQ(hash.at("oid:0x1").size(), 1);
+
+    EXPECT_THROW(hash.at("oid:0x2"), std::out_of_range);
+}
+
+TEST(ObjectTypeHash, insertion_order)
+{
+    ObjectTypeHash hash;
+
+    for (size_t idx = 0; idx < 1000; idx++)
+    {
+        hash[key(idx)] = {};
+    }
+
+    EXPECT_EQ(hash.size(), 1000);
+
+    size_t idx = 0;
+
+    for (auto& kvp: hash)
+    {
+        EXPECT_EQ(kvp.first, key(idx++));
+    }
+
+    EXPECT_EQ(idx, 1000);
+}
+
+TEST(ObjectTypeHash, erase_while_iterating)
+{
+    ObjectTypeHash hash;
+
+    for (size_t idx = 0; idx < 1000; idx++)
+    {
+        hash[key(idx)] = {};
+    }
+
+    size_t idx = 0;
+
+    for (auto it = hash.begin(); it != hash.end();)
+    {
+        if (idx++ % 2)
+        {
+            it = hash.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    EXPECT_EQ(hash.size(), 500);
+
+    for (idx = 0; idx < 1000; idx++)
+    {
+        EXPECT_EQ(hash.count(key(idx)), (idx % 2) ? 0 : 1);
+    }
+
+    EXPECT_EQ(hash.erase("oid:0x0"), 1);
+    EXPECT_EQ(hash.erase("oid:0x0"), 0);
+}
+
+TEST(ObjectTypeHash, reinsert_after_erase)
+{
+    ObjectTypeHash hash;
+
+    std::map<std::string, size_t> expected;
+
+    // many erase and insert cycles will compact entries and rehash index
+
+    for (size_t idx = 0; idx < 20000; idx++)
+    {
+        auto k = key(idx % 300);
+
+        if (idx % 3 == 2)
+        {
+            EXPECT_EQ(hash.erase(k), expected.erase(k));
+        }
+        else
+        {
+            hash[k] = {};
+            expected[k] = idx;
+        }
+
+        ASSERT_EQ(hash.size(), expected.size());
+    }
+
+    for (auto& kvp: expected)
+    {
+        EXPECT_NE(hash.find(kvp.first), hash.end());
+    }
+}
+
+TEST(ObjectTypeHash, copy)
+{
+    ObjectTypeHash hash;
+
+    hash["oid:0x1"] = {};
+    hash["oid:0x2"] = {};
+
+    hash.erase("oid:0x1");
+
+    ObjectTypeHash copy = hash;
+
+    hash.clear();
+
+    EXPECT_EQ(copy.size(), 1);
+    EXPECT_EQ(copy.begin()->first, "oid:0x2");
+
+    const ObjectTypeHash& ref = copy;
+
+    EXPECT_NE(ref.find("oid:0x2"), ref.end());
+
+    auto ret = hash.insert(*ref.begin());
+
+    EXPECT_TRUE(ret.second);
+
+    ret = hash.insert(*ref.begin());
+
+    EXPECT_FALSE(ret.second);
+    EXPECT_EQ(hash.size(), 1);
+}
@@ -0,0 +1,110 @@
+#include "PacketRing.h"
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <net/if.h>
+#include <arpa/inet.h>
+#include <linux/if_ether.h>
+#include <poll.h>
+
+#include <gtest/gtest.h>
+
+using namespace saivs;
+
+TEST(PacketRing, open)
+{
+    PacketRing ring;
+
+    EXPECT_FALSE(ring.is_open());
+
+    EXPECT_THROW(ring.receive([](struct tpacket3_hdr*) { return true; }), std::runtime_error);
+
+    int s = socket(AF_INET, SOCK_DGRAM, 0);
+
+    EXPECT_FALSE(ring.open(s));
+
+    EXPECT_FALSE(ring.is_open());
+
+    close(s);
+}
+
+TEST(PacketRing, receive)
+{
+    int s = socket(AF_PACKET, SOCK_RAW, htons(ETH_P_ALL));
+
+    if (s < 0)
+    {
+        // packet socket requires CAP_NET_RAW
+        return;
+    }
+
+    PacketRing ring;
+
+    ASSERT_TRUE(ring.open(s));
+
+    EXPECT_TRUE(ring.is_open());
+
+    struct sockaddr_ll sock_address;
+
+    memset(&sock_address, 0, sizeof(sock_address));
+
+    sock_address.sll_family = PF_PACKET;
+    sock_address.sll_protocol = htons(ETH_P_ALL);
+    sock_address.sll_ifindex = if_nametoindex("lo");
+
+    ASSERT_EQ(bind(s, (struct sockaddr*) &sock_address, sizeof(sock_address)), 0);
+
+    unsigned char frame[64];
+
+    memset(frame, 0xab, sizeof(frame));
+
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(send(s, frame, sizeof(frame), 0), (ssize_t)sizeof(frame));
+    }
+
+    int count = 0;
+
+    for (int i = 0; i < 20 && count < 10; i++)
+    {
+        struct pollfd pfd = { s, POLLIN, 0 };
+
+        poll(&pfd, 1, 100);
+
+        EXPECT_TRUE(ring.receive([&](struct tpacket3_hdr* hdr) {
+
+                size_t headroom;
+
+                auto buffer = PacketRing::getFrame(hdr, headroom);
+
+                EXPECT_GE(headroom, 4);
+
+                if (hdr->tp_snaplen == sizeof(frame) && memcmp(buffer, frame, sizeof(frame)) == 0)
+                {
+                    count++;
+                }
+
+                return true;
+        }));
+    }
+
+    // frames on loopback are seen twice, outgoing and incoming
+
+    EXPECT_GE(count, 10);
+
+    // callback can stop processing
+
+    EXPECT_EQ(send(s, frame, sizeof(frame), 0), (ssize_t)sizeof(frame));
+
+    struct pollfd pfd = { s, POLLIN, 0 };
+
+    poll(&pfd, 1, 100);
+
+    EXPECT_FALSE(ring.receive([](struct tpacket3_hdr*) { return false; }));
+
+    ring.close();
+
+    EXPECT_FALSE(ring.is_open());
+
+    close(s);
+}
@@ -66,3 +66,30 @@ TEST(TrafficForwarder, addVlanTag)
 
     EXPECT_EQ(length, 68);
 }
+
+TEST(TrafficForwarder, addVlanTagInPlace)
+{
+    uint8_t buffer[ETH_FRAME_BUFFER_SIZE];
+
+    memset(buffer, 0xab, sizeof(buffer));
+
+    size_t length = ETH_FRAME_BUFFER_SIZE;
+
+    EXPECT_THROW(TrafficForwarder::addVlanTagInPlace(buffer + 4, length, 0x123), std::runtime_error);
+
+    length = 64;
+
+    auto frame = TrafficForwarder::addVlanTagInPlace(buffer + 4, length, 0x123);
+
+    EXPECT_EQ(frame, buffer);
+    EXPECT_EQ(length, 68);
+
+    // MAC addresses moved in front of VLAN tag
+
+    EXPECT_EQ(frame[11], 0xab);
+    EXPECT_EQ(frame[12], 0x81);
+    EXPECT_EQ(frame[13], 0x00);
+    EXPECT_EQ(frame[14], 0x01);
+    EXPECT_EQ(frame[15], 0x23);
+    EXPECT_EQ(frame[16], 0xab);
+}
@@ -0,0 +1,189 @@
+#include "WarmBootSnapshot.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace saivs;
+
+#define SWITCH_ID 0x2100000000
+#define PORT_ID 0x1000000000001
+
+static std::string readFile(
+        _In_ FILE* file)
+{
+    SWSS_LOG_ENTER();
+
+    std::string buffer;
+
+    char chunk[4096];
+
+    rewind(file);
+
+    size_t size;
+
+    while ((size = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    {
+        buffer.append(chunk, size);
+    }
+
+    return buffer;
+}
+
+static std::string getSnapshot()
+{
+    SWSS_LOG_ENTER();
+
+    ObjectTypeHash ports;
+
+    ports["oid:0x1000000000001"]["SAI_PORT_ATTR_MTU"] =
+        std::make_shared<SaiAttrWrap>("SAI_PORT_ATTR_MTU", "9100");
+
+    ports["oid:0x1000000000002"] = {};
+
+    ObjectTypeHash routes;
+
+    routes["{\"dest\":\"10.0.0.0/24\",\"switch_id\":\"oid:0x2100000000\",\"vr\":\"oid:0x3000000000022\"}"] = {};
+
+    FILE* file = tmpfile();
+
+    EXPECT_NE(file, nullptr);
+
+    WarmBootSnapshot snapshot(fileno(file));
+
+    EXPECT_TRUE(snapshot.writeObjects(SWITCH_ID, SAI_OBJECT_TYPE_PORT, ports));
+    EXPECT_TRUE(snapshot.writeObjects(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, routes));
+
+    std::set<FdbInfo> fdbInfoSet;
+
+    FdbInfo fi;
+
+    fi.setPortId(PORT_ID);
+    fi.setVlanId(2);
+
+    fdbInfoSet.insert(fi);
+
+    EXPECT_TRUE(snapshot.writeFdbInfos(SWITCH_ID, fdbInfoSet));
+
+    auto buffer = readFile(file);
+
+    fclose(file);
+
+    return buffer;
+}
+
+TEST(WarmBootSnapshot, isSnapshot)
+{
+    auto buffer = getSnapshot();
+
+    EXPECT_TRUE(WarmBootSnapshot::isSnapshot(buffer.data(), buffer.size()));
+
+    std::string text = "SAI_OBJECT_TYPE_PORT oid:0x1000000000001 SAI_PORT_ATTR_MTU 9100\n";
+
+    EXPECT_FALSE(WarmBootSnapshot::isSnapshot(text.data(), text.size()));
+    EXPECT_FALSE(WarmBootSnapshot::isSnapshot(nullptr, 0));
+}
+
+TEST(WarmBootSnapshot, deserialize)
+{
+    auto buffer = getSnapshot();
+
+    std::map<sai_object_id_t, WarmBootState> state;
+
+    std::vector<sai_object_id_t> oids;
+
+    EXPECT_TRUE(WarmBootSnapshot::deserialize(buffer.data(), buffer.size(), state,
+                [&](sai_object_id_t oid) { oids.push_back(oid); }));
+
+    ASSERT_EQ(state.size(), 1);
+
+    auto& wbs = state.at(SWITCH_ID);
+
+    EXPECT_EQ(wbs.m_switchId, SWITCH_ID);
+
+    auto& ports = wbs.m_objectHash.at(SAI_OBJECT_TYPE_PORT);
+
+    EXPECT_EQ(ports.size(), 2);
+    EXPECT_EQ(ports.at("oid:0x1000000000001").at("SAI_PORT_ATTR_MTU")->getAttr()->value.u32, 9100);
+    EXPECT_EQ(ports.at("oid:0x1000000000002").size(), 0);
+
+    EXPECT_EQ(wbs.m_objectHash.at(SAI_OBJECT_TYPE_ROUTE_ENTRY).size(), 1);
+
+    ASSERT_EQ(wbs.m_fdbInfoSet.size(), 1);
+
+    EXPECT_EQ(wbs.m_fdbInfoSet.begin()->getPortId(), PORT_ID);
+    EXPECT_EQ(wbs.m_fdbInfoSet.begin()->getVlanId(), 2);
+
+    // switch id for each section and port oids
+
+    EXPECT_EQ(std::count(oids.begin(), oids.end(), SWITCH_ID), 3);
+    EXPECT_EQ(std::count(oids.begin(), oids.end(), PORT_ID), 1);
+}
+
+TEST(WarmBootSnapshot, deserialize_corrupted)
+{
+    auto buffer = getSnapshot();
+
+    std::map<sai_object_id_t, WarmBootState> state;
+
+    auto callback = [](sai_object_id_t oid) {};
+
+    buffer[buffer.size() - 1] ^= 0x1;
+
+    EXPECT_FALSE(WarmBootSnapshot::deserialize(buffer.data(), buffer.size(), state, callback));
+
+    buffer = getSnapshot();
+
+    EXPECT_FALSE(WarmBootSnapshot::deserialize(buffer.data(), buffer.size() - 1, state, callback));
+}
+
+TEST(WarmBootSnapshot, deserialize_large)
+{
+    ObjectTypeHash ports;
+
+    // payload larger than write buffer, so section is written in chunks
+
+    for (int idx = 1; idx <= 10000; idx++)
+    {
+        char oid[32];
+
+        snprintf(oid, sizeof(oid), "oid:0x10000%08x", idx);
+
+        ports[oid]["SAI_PORT_ATTR_MTU"] =
+            std::make_shared<SaiAttrWrap>("SAI_PORT_ATTR_MTU", std::to_string(idx));
+    }
+
+    FILE* file = tmpfile();
+
+    ASSERT_NE(file, nullptr);
+
+    WarmBootSnapshot snapshot(fileno(file));
+
+    EXPECT_TRUE(snapshot.writeObjects(SWITCH_ID, SAI_OBJECT_TYPE_PORT, ports));
+    EXPECT_TRUE(snapshot.writeObjects(SWITCH_ID, SAI_OBJECT_TYPE_PORT, ports));
+
+    auto buffer = readFile(file);
+
+    fclose(file);
+
+    EXPECT_GT(buffer.size(), 2 * 64 * 1024);
+
+    std::map<sai_object_id_t, WarmBootState> state;
+
+    size_t count = 0;
+
+    EXPECT_TRUE(WarmBootSnapshot::deserialize(buffer.data(), buffer.size(), state,
+                [&](sai_object_id_t oid) { count++; }));
+
+    EXPECT_EQ(state.at(SWITCH_ID).m_objectHash.at(SAI_OBJECT_TYPE_PORT).size(), 10000);
+
+    // switch id for each section and port oids
+
+    EXPECT_EQ(count, 2 + 2 * 10000);
+}
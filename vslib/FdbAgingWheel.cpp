@@ -0,0 +1,163 @@
+#include "FdbAgingWheel.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+
+using namespace saivs;
+
+#define FDB_AGING_WHEEL_SLOT_BITS   (6)
+#define FDB_AGING_WHEEL_SLOTS       (1 << FDB_AGING_WHEEL_SLOT_BITS)
+#define FDB_AGING_WHEEL_SLOT_MASK   (FDB_AGING_WHEEL_SLOTS - 1)
+#define FDB_AGING_WHEEL_LEVELS      (3)
+
+/*
+ * Time range covered by each level (level 0 is 64 seconds, level 1 is 4096
+ * seconds, level 2 is 262144 seconds).
+ */
+#define FDB_AGING_WHEEL_LEVEL_RANGE(level) ((uint64_t)1 << (FDB_AGING_WHEEL_SLOT_BITS * ((level) + 1)))
+
+#define FDB_AGING_WHEEL_SLOT(time, level) (((time) >> (FDB_AGING_WHEEL_SLOT_BITS * (level))) & FDB_AGING_WHEEL_SLOT_MASK)
+
+FdbAgingWheel::FdbAgingWheel():
+    m_current(0)
+{
+    SWSS_LOG_ENTER();
+
+    for (int level = 0; level < FDB_AGING_WHEEL_LEVELS; level++)
+    {
+        m_levels[level].resize(FDB_AGING_WHEEL_SLOTS);
+    }
+}
+
+void FdbAgingWheel::schedule(
+        _In_ const FdbInfo& fi)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_scheduled.empty())
+    {
+        // empty wheel can start from any time
+
+        m_current = fi.getTimestamp();
+    }
+
+    if (m_scheduled.insert(fi).second)
+    {
+        place(fi);
+    }
+}
+
+void FdbAgingWheel::place(
+        _In_ const FdbInfo& fi)
+{
+    SWSS_LOG_ENTER();
+
+    // entries from the past will expire on next advance
+
+    uint32_t time = std::max(fi.getTimestamp(), m_current);
+
+    uint64_t delta = time - m_current;
+
+    for (int level = 0; level < FDB_AGING_WHEEL_LEVELS; level++)
+    {
+        if (delta < FDB_AGING_WHEEL_LEVEL_RANGE(level))
+        {
+            m_levels[level][FDB_AGING_WHEEL_SLOT(time, level)].push_back(fi);
+            return;
+        }
+    }
+
+    m_overflow.push_back(fi);
+}
+
+void FdbAgingWheel::cascade(
+        _Inout_ std::vector<FdbInfo>& slot)
+{
+    SWSS_LOG_ENTER();
+
+    if (slot.empty())
+    {
+        return;
+    }
+
+    std::vector<FdbInfo> entries;
+
+    entries.swap(slot);
+
+    for (auto& fi: entries)
+    {
+        place(fi);
+    }
+}
+
+void FdbAgingWheel::advance(
+        _In_ uint32_t time,
+        _In_ const std::function<void(const FdbInfo&)>& callback)
+{
+    SWSS_LOG_ENTER();
+
+    while (m_scheduled.size() && m_current <= time)
+    {
+        // when lower level wraps around, move entries from upper levels down
+
+        if (FDB_AGING_WHEEL_SLOT(m_current, 0) == 0)
+        {
+            if (FDB_AGING_WHEEL_SLOT(m_current, 1) == 0)
+            {
+                if (FDB_AGING_WHEEL_SLOT(m_current, 2) == 0)
+                {
+                    cascade(m_overflow);
+                }
+
+                cascade(m_levels[2][FDB_AGING_WHEEL_SLOT(m_current, 2)]);
+            }
+
+            cascade(m_levels[1][FDB_AGING_WHEEL_SLOT(m_current, 1)]);
+        }
+
+        std::vector<FdbInfo> expired;
+
+        expired.swap(m_levels[0][FDB_AGING_WHEEL_SLOT(m_current, 0)]);
+
+        m_current++;
+
+        // callback can schedule entries again
+
+        for (auto& fi: expired)
+        {
+            m_scheduled.erase(fi);
+
+            callback(fi);
+        }
+    }
+
+    if (m_scheduled.empty() && m_current <= time)
+    {
+        m_current = time + 1;
+    }
+}
+
+size_t FdbAgingWheel::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_scheduled.size();
+}
+
+void FdbAgingWheel::clear()
+{
+    SWSS_LOG_ENTER();
+
+    for (int level = 0; level < FDB_AGING_WHEEL_LEVELS; level++)
+    {
+        for (auto& slot: m_levels[level])
+        {
+            slot.clear();
+        }
+    }
+
+    m_overflow.clear();
+
+    m_scheduled.clear();
+}
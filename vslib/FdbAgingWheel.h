@@ -0,0 +1,84 @@
+#pragma once
+
+#include "FdbInfo.h"
+
+#include <functional>
+#include <set>
+#include <vector>
+
+namespace saivs
+{
+    /**
+     * @brief Hierarchical timer wheel for FDB aging.
+     *
+     * FDB infos are scheduled by learn timestamp (in seconds). Wheel has 3
+     * levels of 64 slots with 1, 64 and 4096 second resolution, entries
+     * further in the future are kept on overflow list. When wheel advances,
+     * only slots which time has come are touched and entries from upper
+     * levels are cascaded down to lower ones.
+     *
+     * Wheel does not track removal or refresh of FDB info, caller must check
+     * if expired entry is still valid, and can schedule it again with new
+     * timestamp. Each FDB info (mac and vlan) is scheduled at most once.
+     */
+    class FdbAgingWheel
+    {
+        public:
+
+            FdbAgingWheel();
+
+            virtual ~FdbAgingWheel() = default;
+
+        public:
+
+            /**
+             * @brief Schedule FDB info to expire at its timestamp.
+             *
+             * If the same FDB info is already scheduled, call is ignored.
+             */
+            void schedule(
+                    _In_ const FdbInfo& fi);
+
+            /**
+             * @brief Advance wheel and expire all entries with timestamp less
+             * or equal to given time.
+             *
+             * Callback is executed for every expired entry.
+             */
+            void advance(
+                    _In_ uint32_t time,
+                    _In_ const std::function<void(const FdbInfo&)>& callback);
+
+            size_t size() const;
+
+            void clear();
+
+        private:
+
+            /**
+             * @brief Put entry to slot according to its distance from
+             * current time.
+             */
+            void place(
+                    _In_ const FdbInfo& fi);
+
+            void cascade(
+                    _Inout_ std::vector<FdbInfo>& slot);
+
+        private:
+
+            std::vector<std::vector<FdbInfo>> m_levels[3];
+
+            std::vector<FdbInfo> m_overflow;
+
+            /**
+             * @brief Next time (timestamp) to be expired.
+             */
+            uint32_t m_current;
+
+            /**
+             * @brief FDB infos currently present on the wheel.
+             */
+            std::set<FdbInfo> m_scheduled;
+    };
+}
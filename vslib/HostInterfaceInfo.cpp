@@ -1,4 +1,5 @@
 #include "HostInterfaceInfo.h"
+#include "HostifPacketEngine.h"
 #include "SwitchStateBase.h"
 #include "SelectableFd.h"
 #include "EventPayloadPacket.h"
@@ -49,6 +50,11 @@ HostInterfaceInfo::~HostInterfaceInfo()
 
     m_run_thread = false;
 
+    if (m_packetEngine)
+    {
+        m_packetEngine->removeInterface(this);
+    }
+
     m_e2tEvent.notify();
     m_t2eEvent.notify();
 
@@ -85,10 +91,64 @@ void HostInterfaceInfo::runThreads()
 
     m_run_thread = true;
 
-    m_e2t = std::make_shared<std::thread>(&HostInterfaceInfo::veth2tap_fun, this);
+    if (m_packetRing)
+    {
+        m_e2t = std::make_shared<std::thread>(&HostInterfaceInfo::ring2tap_fun, this);
+    }
+    else
+    {
+        m_e2t = std::make_shared<std::thread>(&HostInterfaceInfo::veth2tap_fun, this);
+    }
     m_t2e = std::make_shared<std::thread>(&HostInterfaceInfo::tap2veth_fun, this);
 }
 
+void HostInterfaceInfo::usePacketRing(
+        _In_ std::shared_ptr<PacketRing> ring)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_run_thread || m_packetEngine)
+    {
+        SWSS_LOG_THROW("packet ring must be set before forwarding is started on %s", m_name.c_str());
+    }
+
+    if (ring && !ring->is_open())
+    {
+        SWSS_LOG_THROW("packet ring for %s is not open", m_name.c_str());
+    }
+
+    m_packetRing = ring;
+
+    m_ringBuffer.resize(m_packetRing ? ETH_FRAME_BUFFER_SIZE + PacketRing::HEADROOM : 0);
+}
+
+bool HostInterfaceInfo::hasPacketRing() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_packetRing != nullptr;
+}
+
+void HostInterfaceInfo::runPacketEngine(
+        _In_ std::shared_ptr<HostifPacketEngine> engine)
+{
+    SWSS_LOG_ENTER();
+
+    if (engine == nullptr)
+    {
+        SWSS_LOG_THROW("packet engine can't be nullptr");
+    }
+
+    if (m_run_thread || m_packetEngine)
+    {
+        return;
+    }
+
+    m_packetEngine = engine;
+
+    m_packetEngine->addInterface(this);
+}
+
 void HostInterfaceInfo::async_process_packet_for_fdb_event(
         _In_ const uint8_t *data,
         _In_ size_t size) const
@@ -201,26 +261,41 @@ void HostInterfaceInfo::veth2tap_fun()
             continue;
         }
 
-        // Buffer include the ingress packets
-        // MACsec scenario: EAPOL packets and encrypted packets
-        size_t length = static_cast<size_t>(size);
-        auto ret = m_e2tFilters.execute(buffer, length);
-
-        if (ret == TrafficFilter::TERMINATE)
+        if (!forwardVethFrame(buffer, static_cast<size_t>(size), msg))
         {
-            continue;
+            break;
         }
-        else if (ret == TrafficFilter::ERROR)
+    }
+
+    SWSS_LOG_NOTICE("ending thread proc for %s", m_name.c_str());
+}
+
+void HostInterfaceInfo::ring2tap_fun()
+{
+    SWSS_LOG_ENTER();
+
+    swss::Select s;
+    SelectableFd fd(m_packet_socket);
+
+    s.addSelectable(&m_e2tEvent);
+    s.addSelectable(&fd);
+
+    while (m_run_thread)
+    {
+        swss::Selectable *sel = NULL;
+
+        int result = s.select(&sel);
+
+        if (result != swss::Select::OBJECT)
         {
-            // Error log should be recorded in filter
+            SWSS_LOG_ERROR("selectable failed: %d, ending thread for %s", result, m_name.c_str());
             return;
         }
 
-        addVlanTag(buffer, length, msg);
-
-        async_process_packet_for_fdb_event(buffer, length);
+        if (sel == &m_e2tEvent) // thread end event
+            break;
 
-        if (!sendTo(m_tapfd, buffer, length))
+        if (!forwardRingFrames())
         {
             break;
         }
@@ -273,10 +348,8 @@ void HostInterfaceInfo::tap2veth_fun()
             continue;
         }
 
-        // Buffer include the egress packets
-        // MACsec scenario: EAPOL packets and plaintext packets
         size_t length = static_cast<size_t>(size);
-        auto ret = m_t2eFilters.execute(buffer, length);
+        auto ret = filterTapFrame(buffer, length);
         size = static_cast<ssize_t>(length);
 
         if (ret == TrafficFilter::TERMINATE)
@@ -303,3 +376,110 @@ void HostInterfaceInfo::tap2veth_fun()
 
     SWSS_LOG_NOTICE("ending thread proc for %s", m_name.c_str());
 }
+
+bool HostInterfaceInfo::forwardVethFrame(
+        _Inout_ unsigned char *buffer,
+        _In_ size_t length,
+        _Inout_ struct msghdr &msg)
+{
+    SWSS_LOG_ENTER();
+
+    // Buffer include the ingress packets
+    // MACsec scenario: EAPOL packets and encrypted packets
+    auto ret = m_e2tFilters.execute(buffer, length);
+
+    if (ret == TrafficFilter::TERMINATE)
+    {
+        return true;
+    }
+    else if (ret == TrafficFilter::ERROR)
+    {
+        // Error log should be recorded in filter
+        return false;
+    }
+
+    addVlanTag(buffer, length, msg);
+
+    async_process_packet_for_fdb_event(buffer, length);
+
+    return sendTo(m_tapfd, buffer, length);
+}
+
+bool HostInterfaceInfo::forwardRingFrames()
+{
+    SWSS_LOG_ENTER();
+
+    return m_packetRing->receive([this](struct tpacket3_hdr* hdr) { return forwardRingFrame(hdr); });
+}
+
+bool HostInterfaceInfo::forwardRingFrame(
+        _In_ struct tpacket3_hdr* hdr)
+{
+    SWSS_LOG_ENTER();
+
+    size_t headroom;
+
+    unsigned char* buffer = PacketRing::getFrame(hdr, headroom);
+
+    size_t length = hdr->tp_snaplen;
+
+    if (hdr->tp_snaplen != hdr->tp_len)
+    {
+        SWSS_LOG_ERROR("truncated ethernet frame %u of %u bytes on %s", hdr->tp_snaplen, hdr->tp_len, m_name.c_str());
+        return true;
+    }
+
+    if (length < sizeof(ethhdr))
+    {
+        SWSS_LOG_ERROR("invalid ethernet frame length: %zu", length);
+        return true;
+    }
+
+    // Buffer include the ingress packets
+    // MACsec scenario: EAPOL packets and encrypted packets
+    auto ret = m_e2tFilters.execute(buffer, length);
+
+    if (ret == TrafficFilter::TERMINATE)
+    {
+        return true;
+    }
+    else if (ret == TrafficFilter::ERROR)
+    {
+        // Error log should be recorded in filter
+        return false;
+    }
+
+    if ((hdr->tp_status & TP_STATUS_VLAN_VALID) &&
+            (hdr->tp_status & TP_STATUS_VLAN_TPID_VALID))
+    {
+        if (headroom < PacketRing::HEADROOM)
+        {
+            if (length > ETH_FRAME_BUFFER_SIZE)
+            {
+                SWSS_LOG_ERROR("ethernet frame length %zu exceeds buffer size on %s", length, m_name.c_str());
+                return true;
+            }
+
+            memcpy(m_ringBuffer.data() + PacketRing::HEADROOM, buffer, length);
+
+            buffer = m_ringBuffer.data() + PacketRing::HEADROOM;
+        }
+
+        buffer = addVlanTagInPlace(buffer, length, static_cast<uint16_t>(hdr->hv1.tp_vlan_tci));
+    }
+
+    async_process_packet_for_fdb_event(buffer, length);
+
+    return sendTo(m_tapfd, buffer, length);
+}
+
+TrafficFilter::FilterStatus HostInterfaceInfo::filterTapFrame(
+        _Inout_ unsigned char *buffer,
+        _Inout_ size_t &length)
+{
+    SWSS_LOG_ENTER();
+
+    // Buffer include the egress packets
+    // MACsec scenario: EAPOL packets and plaintext packets
+    return m_t2eFilters.execute(buffer, length);
+}
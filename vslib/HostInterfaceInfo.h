@@ -5,6 +5,7 @@ extern "C" {
 }
 
 #include "EventQueue.h"
+#include "PacketRing.h"
 #include "TrafficFilterPipes.h"
 #include "TrafficForwarder.h"
 
@@ -12,10 +13,13 @@ extern "C" {
 
 #include <memory>
 #include <thread>
+#include <vector>
 #include <string.h>
 
 namespace saivs
 {
+    class HostifPacketEngine;
+
     class HostInterfaceInfo:
         public TrafficForwarder
     {
@@ -55,12 +59,61 @@ namespace saivs
             bool uninstallTap2EthFilter(
                     _In_ std::shared_ptr<TrafficFilter> filter);
 
+            /**
+             * @brief Receive frames from veth using memory mapped ring instead
+             * of recvmsg, must be set before forwarding is started.
+             */
+            void usePacketRing(
+                    _In_ std::shared_ptr<PacketRing> ring);
+
+            bool hasPacketRing() const;
+
             void runThreads();
 
+            /**
+             * @brief Serve this host interface by packet engine threads
+             * instead of dedicated threads.
+             */
+            void runPacketEngine(
+                    _In_ std::shared_ptr<HostifPacketEngine> engine);
+
+            /**
+             * @brief Forward frame received on veth to tap device.
+             *
+             * Executes eth to tap filters, inserts VLAN tag from auxiliary
+             * data, generates FDB learning event and writes frame to tap.
+             *
+             * @return False if forwarding should stop.
+             */
+            bool forwardVethFrame(
+                    _Inout_ unsigned char *buffer,
+                    _In_ size_t length,
+                    _Inout_ struct msghdr &msg);
+
+            /**
+             * @brief Forward frames from all blocks of packet ring released
+             * by kernel to tap device.
+             *
+             * @return False if forwarding should stop.
+             */
+            bool forwardRingFrames();
+
+            /**
+             * @brief Execute tap to eth filters on frame received on tap.
+             */
+            TrafficFilter::FilterStatus filterTapFrame(
+                    _Inout_ unsigned char *buffer,
+                    _Inout_ size_t &length);
+
         private:
 
             void veth2tap_fun();
 
+            void ring2tap_fun();
+
+            bool forwardRingFrame(
+                    _In_ struct tpacket3_hdr* hdr);
+
             void tap2veth_fun();
 
         public: // TODO to private
@@ -84,6 +137,15 @@ namespace saivs
             std::shared_ptr<std::thread> m_e2t;
             std::shared_ptr<std::thread> m_t2e;
 
+            std::shared_ptr<HostifPacketEngine> m_packetEngine;
+
+            std::shared_ptr<PacketRing> m_packetRing;
+
+            /**
+             * @brief Used when frame in ring has no headroom for VLAN tag.
+             */
+            std::vector<unsigned char> m_ringBuffer;
+
             TrafficFilterPipes m_e2tFilters;
             TrafficFilterPipes m_t2eFilters;
 
@@ -0,0 +1,459 @@
+#include "HostifPacketEngine.h"
+
+#include "swss/logger.h"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <net/ethernet.h>
+
+#include <cstring>
+
+using namespace saivs;
+
+#define EPOLL_MAX_EVENTS 64
+
+constexpr size_t HostifPacketEngine::BATCH_SIZE;
+
+HostifPacketEngine::HostifPacketEngine(
+        _In_ size_t threadCount):
+    m_run(true)
+{
+    SWSS_LOG_ENTER();
+
+    if (threadCount == 0)
+    {
+        SWSS_LOG_THROW("packet engine thread count must be positive");
+    }
+
+    for (size_t idx = 0; idx < threadCount; idx++)
+    {
+        auto worker = std::unique_ptr<Worker>(new Worker());
+
+        worker->m_interfaceCount = 0;
+        worker->m_iteration = 0;
+        worker->m_stopped = false;
+
+        worker->m_epollfd = epoll_create1(EPOLL_CLOEXEC);
+
+        if (worker->m_epollfd < 0)
+        {
+            SWSS_LOG_THROW("epoll_create1 failed: %s", strerror(errno));
+        }
+
+        worker->m_eventfd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+        if (worker->m_eventfd < 0)
+        {
+            SWSS_LOG_THROW("eventfd failed: %s", strerror(errno));
+        }
+
+        struct epoll_event ev;
+
+        memset(&ev, 0, sizeof(ev));
+
+        ev.events = EPOLLIN;
+        ev.data.ptr = nullptr; // wake up event
+
+        if (epoll_ctl(worker->m_epollfd, EPOLL_CTL_ADD, worker->m_eventfd, &ev) < 0)
+        {
+            SWSS_LOG_THROW("epoll_ctl failed to add eventfd: %s", strerror(errno));
+        }
+
+        worker->m_buffers.resize(BATCH_SIZE * ETH_FRAME_BUFFER_SIZE);
+        worker->m_control.resize(BATCH_SIZE * CONTROL_MESSAGE_BUFFER_SIZE);
+        worker->m_msgs.resize(BATCH_SIZE);
+        worker->m_iovs.resize(BATCH_SIZE);
+        worker->m_addrs.resize(BATCH_SIZE);
+
+        m_workers.push_back(std::move(worker));
+    }
+
+    for (auto& worker: m_workers)
+    {
+        worker->m_thread = std::make_shared<std::thread>(&HostifPacketEngine::workerThreadFunction, this, worker.get());
+    }
+
+    SWSS_LOG_NOTICE("hostif packet engine started with %zu threads", threadCount);
+}
+
+HostifPacketEngine::~HostifPacketEngine()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_run = false;
+    }
+
+    uint64_t value = 1;
+
+    for (auto& worker: m_workers)
+    {
+        if (write(worker->m_eventfd, &value, sizeof(value)) < 0)
+        {
+            SWSS_LOG_ERROR("failed to wake up packet engine thread: %s", strerror(errno));
+        }
+    }
+
+    for (auto& worker: m_workers)
+    {
+        worker->m_thread->join();
+
+        close(worker->m_eventfd);
+        close(worker->m_epollfd);
+    }
+
+    if (m_interfaces.size())
+    {
+        SWSS_LOG_WARN("packet engine destroyed with %zu interfaces still added", m_interfaces.size());
+    }
+}
+
+void HostifPacketEngine::addInterface(
+        _In_ HostInterfaceInfo* info)
+{
+    SWSS_LOG_ENTER();
+
+    if (info == nullptr)
+    {
+        SWSS_LOG_THROW("host interface info can't be nullptr");
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_interfaces.find(info) != m_interfaces.end())
+    {
+        SWSS_LOG_THROW("host interface %s already added to packet engine", info->m_name.c_str());
+    }
+
+    size_t workerIndex = 0;
+
+    for (size_t idx = 1; idx < m_workers.size(); idx++)
+    {
+        if (m_workers[idx]->m_interfaceCount < m_workers[workerIndex]->m_interfaceCount)
+        {
+            workerIndex = idx;
+        }
+    }
+
+    auto& worker = m_workers[workerIndex];
+
+    auto intf = std::unique_ptr<Interface>(new Interface());
+
+    intf->m_workerIndex = workerIndex;
+    intf->m_veth.m_info = info;
+    intf->m_veth.m_fromTap = false;
+    intf->m_tap.m_info = info;
+    intf->m_tap.m_fromTap = true;
+
+    // tap device is drained in batches, so read must not block
+
+    int flags = fcntl(info->m_tapfd, F_GETFL, 0);
+
+    if (flags < 0 || fcntl(info->m_tapfd, F_SETFL, flags | O_NONBLOCK) < 0)
+    {
+        SWSS_LOG_ERROR("failed to set non blocking mode on tap fd %d: %s", info->m_tapfd, strerror(errno));
+    }
+
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+
+    ev.events = EPOLLIN;
+    ev.data.ptr = &intf->m_veth;
+
+    if (epoll_ctl(worker->m_epollfd, EPOLL_CTL_ADD, info->m_packet_socket, &ev) < 0)
+    {
+        SWSS_LOG_THROW("failed to add packet socket %d of %s to epoll: %s",
+                info->m_packet_socket, info->m_name.c_str(), strerror(errno));
+    }
+
+    ev.data.ptr = &intf->m_tap;
+
+    if (epoll_ctl(worker->m_epollfd, EPOLL_CTL_ADD, info->m_tapfd, &ev) < 0)
+    {
+        epoll_ctl(worker->m_epollfd, EPOLL_CTL_DEL, info->m_packet_socket, NULL);
+
+        SWSS_LOG_THROW("failed to add tap fd %d of %s to epoll: %s",
+                info->m_tapfd, info->m_name.c_str(), strerror(errno));
+    }
+
+    worker->m_interfaceCount++;
+
+    m_interfaces[info] = std::move(intf);
+
+    SWSS_LOG_NOTICE("added %s to packet engine thread %zu", info->m_name.c_str(), workerIndex);
+}
+
+void HostifPacketEngine::removeInterface(
+        _In_ HostInterfaceInfo* info)
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    auto it = m_interfaces.find(info);
+
+    if (it == m_interfaces.end())
+    {
+        SWSS_LOG_WARN("host interface %s not added to packet engine", info->m_name.c_str());
+        return;
+    }
+
+    auto& worker = m_workers[it->second->m_workerIndex];
+
+    epoll_ctl(worker->m_epollfd, EPOLL_CTL_DEL, info->m_packet_socket, NULL);
+    epoll_ctl(worker->m_epollfd, EPOLL_CTL_DEL, info->m_tapfd, NULL);
+
+    // events already returned by epoll_wait may still point to this
+    // interface, wait until worker finishes current iteration
+
+    uint64_t iteration = worker->m_iteration;
+
+    uint64_t value = 1;
+
+    if (write(worker->m_eventfd, &value, sizeof(value)) < 0)
+    {
+        SWSS_LOG_ERROR("failed to wake up packet engine thread: %s", strerror(errno));
+    }
+
+    m_iterationCv.wait(lock, [&]{ return worker->m_iteration != iteration || worker->m_stopped || !m_run; });
+
+    worker->m_interfaceCount--;
+
+    m_interfaces.erase(it);
+
+    SWSS_LOG_NOTICE("removed %s from packet engine", info->m_name.c_str());
+}
+
+size_t HostifPacketEngine::getThreadCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_workers.size();
+}
+
+size_t HostifPacketEngine::getInterfaceCount()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_interfaces.size();
+}
+
+unsigned char* HostifPacketEngine::getBuffer(
+        _In_ Worker* worker,
+        _In_ size_t index) const
+{
+    SWSS_LOG_ENTER();
+
+    return worker->m_buffers.data() + index * ETH_FRAME_BUFFER_SIZE;
+}
+
+void HostifPacketEngine::processVeth(
+        _In_ Worker* worker,
+        _In_ HostInterfaceInfo* info)
+{
+    SWSS_LOG_ENTER();
+
+    if (info->hasPacketRing())
+    {
+        // frames are already in memory shared with kernel
+
+        info->forwardRingFrames();
+
+        return;
+    }
+
+    for (size_t idx = 0; idx < BATCH_SIZE; idx++)
+    {
+        struct msghdr& msg = worker->m_msgs[idx].msg_hdr;
+
+        memset(&msg, 0, sizeof(msg));
+
+        worker->m_iovs[idx].iov_base = getBuffer(worker, idx);
+        worker->m_iovs[idx].iov_len = ETH_FRAME_BUFFER_SIZE;
+
+        msg.msg_name = &worker->m_addrs[idx];
+        msg.msg_namelen = sizeof(struct sockaddr_storage);
+        msg.msg_iov = &worker->m_iovs[idx];
+        msg.msg_iovlen = 1;
+        msg.msg_control = worker->m_control.data() + idx * CONTROL_MESSAGE_BUFFER_SIZE;
+        msg.msg_controllen = CONTROL_MESSAGE_BUFFER_SIZE;
+
+        worker->m_msgs[idx].msg_len = 0;
+    }
+
+    int count = recvmmsg(info->m_packet_socket, worker->m_msgs.data(), (unsigned int)BATCH_SIZE, MSG_DONTWAIT, NULL);
+
+    if (count < 0)
+    {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != ENETDOWN)
+        {
+            SWSS_LOG_ERROR("failed to read from socket fd %d, errno(%d): %s",
+                    info->m_packet_socket, errno, strerror(errno));
+        }
+
+        return;
+    }
+
+    for (int idx = 0; idx < count; idx++)
+    {
+        size_t length = worker->m_msgs[idx].msg_len;
+
+        if (length < sizeof(struct ether_header))
+        {
+            SWSS_LOG_ERROR("invalid ethernet frame length: %zu", length);
+            continue;
+        }
+
+        info->forwardVethFrame(getBuffer(worker, idx), length, worker->m_msgs[idx].msg_hdr);
+    }
+}
+
+void HostifPacketEngine::processTap(
+        _In_ Worker* worker,
+        _In_ HostInterfaceInfo* info)
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = 0;
+
+    for (size_t idx = 0; idx < BATCH_SIZE; idx++)
+    {
+        unsigned char* buffer = getBuffer(worker, count);
+
+        ssize_t size = read(info->m_tapfd, buffer, ETH_FRAME_BUFFER_SIZE);
+
+        if (size < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                SWSS_LOG_ERROR("failed to read from tapfd fd %d, errno(%d): %s",
+                        info->m_tapfd, errno, strerror(errno));
+            }
+
+            break;
+        }
+
+        size_t length = static_cast<size_t>(size);
+
+        if (info->filterTapFrame(buffer, length) != TrafficFilter::CONTINUE)
+        {
+            continue;
+        }
+
+        struct msghdr& msg = worker->m_msgs[count].msg_hdr;
+
+        memset(&msg, 0, sizeof(msg));
+
+        worker->m_iovs[count].iov_base = buffer;
+        worker->m_iovs[count].iov_len = length;
+
+        msg.msg_iov = &worker->m_iovs[count];
+        msg.msg_iovlen = 1;
+
+        count++;
+    }
+
+    size_t sent = 0;
+
+    while (sent < count)
+    {
+        int result = sendmmsg(info->m_packet_socket, &worker->m_msgs[sent], (unsigned int)(count - sent), 0);
+
+        if (result < 0)
+        {
+            if (errno != ENETDOWN)
+            {
+                SWSS_LOG_ERROR("failed to write to socket fd %d, errno(%d): %s",
+                        info->m_packet_socket, errno, strerror(errno));
+            }
+
+            sent++; // drop frame which failed and continue with next one
+
+            continue;
+        }
+
+        sent += (size_t)result;
+    }
+}
+
+void HostifPacketEngine::workerThreadFunction(
+        _In_ Worker* worker)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("starting packet engine thread");
+
+    struct epoll_event events[EPOLL_MAX_EVENTS];
+
+    while (true)
+    {
+        int count = epoll_wait(worker->m_epollfd, events, EPOLL_MAX_EVENTS, -1);
+
+        if (count < 0 && errno != EINTR)
+        {
+            SWSS_LOG_ERROR("epoll_wait failed: %s, ending packet engine thread", strerror(errno));
+            break;
+        }
+
+        for (int idx = 0; idx < count; idx++)
+        {
+            auto endpoint = static_cast<Endpoint*>(events[idx].data.ptr);
+
+            if (endpoint == nullptr)
+            {
+                uint64_t value;
+
+                if (read(worker->m_eventfd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+                {
+                    SWSS_LOG_ERROR("failed to read eventfd: %s", strerror(errno));
+                }
+
+                continue;
+            }
+
+            if (endpoint->m_fromTap)
+            {
+                processTap(worker, endpoint->m_info);
+            }
+            else
+            {
+                processVeth(worker, endpoint->m_info);
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        worker->m_iteration++;
+
+        bool run = m_run;
+
+        lock.unlock();
+
+        m_iterationCv.notify_all();
+
+        if (!run)
+        {
+            break;
+        }
+    }
+
+    // thread could end on error, don't let removeInterface wait for
+    // iteration which will never finish
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    worker->m_stopped = true;
+
+    lock.unlock();
+
+    m_iterationCv.notify_all();
+
+    SWSS_LOG_NOTICE("ending packet engine thread");
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "HostInterfaceInfo.h"
+
+#include "swss/sal.h"
+
+#include <sys/socket.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
+namespace saivs
+{
+    /**
+     * @brief Packet engine serving host interfaces from fixed pool of threads.
+     *
+     * Instead of two threads per host interface, each engine thread waits
+     * with epoll on packet sockets and tap devices of many host interfaces.
+     * Frames from veth are received in batches with recvmmsg, and frames
+     * from tap device are sent to veth in batches with sendmmsg.
+     *
+     * Traffic filters, VLAN tag insertion and FDB learning are the same as
+     * in per interface threads, see HostInterfaceInfo.
+     */
+    class HostifPacketEngine
+    {
+        private:
+
+            HostifPacketEngine(const HostifPacketEngine&) = delete;
+            HostifPacketEngine& operator=(const HostifPacketEngine&) = delete;
+
+        public:
+
+            static constexpr size_t BATCH_SIZE = 32;
+
+        public:
+
+            HostifPacketEngine(
+                    _In_ size_t threadCount);
+
+            virtual ~HostifPacketEngine();
+
+        public:
+
+            /**
+             * @brief Start serving host interface on least loaded thread.
+             *
+             * Tap device is switched to non blocking mode.
+             */
+            void addInterface(
+                    _In_ HostInterfaceInfo* info);
+
+            /**
+             * @brief Stop serving host interface.
+             *
+             * When this function returns, engine threads will not touch
+             * host interface anymore, so it can be safely destroyed.
+             */
+            void removeInterface(
+                    _In_ HostInterfaceInfo* info);
+
+            size_t getThreadCount() const;
+
+            size_t getInterfaceCount();
+
+        private:
+
+            struct Endpoint
+            {
+                HostInterfaceInfo* m_info;
+
+                bool m_fromTap;
+            };
+
+            struct Interface
+            {
+                size_t m_workerIndex;
+
+                Endpoint m_veth;
+
+                Endpoint m_tap;
+            };
+
+            struct Worker
+            {
+                int m_epollfd;
+
+                int m_eventfd;
+
+                size_t m_interfaceCount;
+
+                /**
+                 * @brief Number of finished epoll iterations, used to wait
+                 * until removed interface is not processed anymore.
+                 */
+                uint64_t m_iteration;
+
+                /**
+                 * @brief Set when worker thread ended, no more iterations
+                 * will be finished.
+                 */
+                bool m_stopped;
+
+                std::vector<unsigned char> m_buffers;
+
+                std::vector<unsigned char> m_control;
+
+                std::vector<struct mmsghdr> m_msgs;
+
+                std::vector<struct iovec> m_iovs;
+
+                std::vector<struct sockaddr_storage> m_addrs;
+
+                std::shared_ptr<std::thread> m_thread;
+            };
+
+            void workerThreadFunction(
+                    _In_ Worker* worker);
+
+            void processVeth(
+                    _In_ Worker* worker,
+                    _In_ HostInterfaceInfo* info);
+
+            void processTap(
+                    _In_ Worker* worker,
+                    _In_ HostInterfaceInfo* info);
+
+            unsigned char* getBuffer(
+                    _In_ Worker* worker,
+                    _In_ size_t index) const;
+
+        private:
+
+            bool m_run;
+
+            std::vector<std::unique_ptr<Worker>> m_workers;
+
+            std::map<HostInterfaceInfo*, std::unique_ptr<Interface>> m_interfaces;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_iterationCv;
+    };
+}
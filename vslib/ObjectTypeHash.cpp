@@ -0,0 +1,451 @@
+#include "ObjectTypeHash.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+using namespace saivs;
+
+/**
+ * @def OBJECT_TYPE_HASH_MIN_SLOTS
+ *
+ * Minimum number of index slots allocated on first insert, must be power of 2.
+ */
+#define OBJECT_TYPE_HASH_MIN_SLOTS (16)
+
+#define EMPTY_SLOT ((size_t)-1)
+
+ObjectTypeHash::ObjectTypeHash():
+    m_size(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+ObjectTypeHash::ObjectTypeHash(
+        _In_ const ObjectTypeHash& other):
+    m_size(0)
+{
+    SWSS_LOG_ENTER();
+
+    copyFrom(other);
+}
+
+ObjectTypeHash::ObjectTypeHash(
+        _In_ ObjectTypeHash&& other) noexcept:
+    m_entries(std::move(other.m_entries)),
+    m_slots(std::move(other.m_slots)),
+    m_size(other.m_size)
+{
+    SWSS_LOG_ENTER();
+
+    other.m_entries.clear();
+    other.m_slots.clear();
+    other.m_size = 0;
+}
+
+ObjectTypeHash::~ObjectTypeHash()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+ObjectTypeHash& ObjectTypeHash::operator=(
+        _In_ const ObjectTypeHash& other)
+{
+    SWSS_LOG_ENTER();
+
+    if (this != &other)
+    {
+        copyFrom(other);
+    }
+
+    return *this;
+}
+
+ObjectTypeHash& ObjectTypeHash::operator=(
+        _In_ ObjectTypeHash&& other) noexcept
+{
+    SWSS_LOG_ENTER();
+
+    if (this != &other)
+    {
+        m_entries = std::move(other.m_entries);
+        m_slots = std::move(other.m_slots);
+        m_size = other.m_size;
+
+        other.m_entries.clear();
+        other.m_slots.clear();
+        other.m_size = 0;
+    }
+
+    return *this;
+}
+
+size_t ObjectTypeHash::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_size;
+}
+
+bool ObjectTypeHash::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_size == 0;
+}
+
+void ObjectTypeHash::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_entries.clear();
+    m_slots.clear();
+    m_size = 0;
+}
+
+void ObjectTypeHash::reserve(
+        _In_ size_t count)
+{
+    SWSS_LOG_ENTER();
+
+    size_t slotCount = std::max((size_t)OBJECT_TYPE_HASH_MIN_SLOTS, m_slots.size());
+
+    while (count * 4 > slotCount * 3)
+    {
+        slotCount *= 2;
+    }
+
+    if (slotCount != m_slots.size())
+    {
+        rehash(slotCount);
+    }
+
+    if (count > m_size)
+    {
+        m_entries.reserve(m_entries.size() + count - m_size);
+    }
+}
+
+size_t ObjectTypeHash::hashKey(
+        _In_ const std::string& key)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    return std::hash<std::string>()(key);
+}
+
+size_t ObjectTypeHash::findSlot(
+        _In_ const std::string& key,
+        _In_ size_t hash) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    size_t mask = m_slots.size() - 1;
+
+    for (size_t pos = hash & mask; ; pos = (pos + 1) & mask)
+    {
+        const Slot& slot = m_slots[pos];
+
+        if (slot.index == EMPTY_SLOT)
+        {
+            return pos;
+        }
+
+        if (slot.hash == hash && m_entries[slot.index]->first == key)
+        {
+            return pos;
+        }
+    }
+}
+
+ObjectTypeHash::iterator ObjectTypeHash::find(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_size == 0)
+    {
+        return end();
+    }
+
+    const Slot& slot = m_slots[findSlot(key, hashKey(key))];
+
+    if (slot.index == EMPTY_SLOT)
+    {
+        return end();
+    }
+
+    return iterator(this, slot.index);
+}
+
+ObjectTypeHash::const_iterator ObjectTypeHash::find(
+        _In_ const std::string& key) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_size == 0)
+    {
+        return end();
+    }
+
+    const Slot& slot = m_slots[findSlot(key, hashKey(key))];
+
+    if (slot.index == EMPTY_SLOT)
+    {
+        return end();
+    }
+
+    return const_iterator(this, slot.index);
+}
+
+size_t ObjectTypeHash::count(
+        _In_ const std::string& key) const
+{
+    SWSS_LOG_ENTER();
+
+    return find(key) == end() ? 0 : 1;
+}
+
+ObjectTypeHash::AttrHash& ObjectTypeHash::at(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = find(key);
+
+    if (it == end())
+    {
+        throw std::out_of_range("ObjectTypeHash::at: " + key);
+    }
+
+    return it->second;
+}
+
+const ObjectTypeHash::AttrHash& ObjectTypeHash::at(
+        _In_ const std::string& key) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = find(key);
+
+    if (it == end())
+    {
+        throw std::out_of_range("ObjectTypeHash::at: " + key);
+    }
+
+    return it->second;
+}
+
+ObjectTypeHash::AttrHash& ObjectTypeHash::operator[](
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    size_t hash = hashKey(key);
+
+    if (m_size)
+    {
+        const Slot& slot = m_slots[findSlot(key, hash)];
+
+        if (slot.index != EMPTY_SLOT)
+        {
+            return m_entries[slot.index]->second;
+        }
+    }
+
+    return m_entries[insertEntry(key, hash, {})]->second;
+}
+
+std::pair<ObjectTypeHash::iterator, bool> ObjectTypeHash::insert(
+        _In_ const value_type& value)
+{
+    SWSS_LOG_ENTER();
+
+    size_t hash = hashKey(value.first);
+
+    if (m_size)
+    {
+        const Slot& slot = m_slots[findSlot(value.first, hash)];
+
+        if (slot.index != EMPTY_SLOT)
+        {
+            return std::make_pair(iterator(this, slot.index), false);
+        }
+    }
+
+    size_t index = insertEntry(value.first, hash, value.second);
+
+    return std::make_pair(iterator(this, index), true);
+}
+
+size_t ObjectTypeHash::insertEntry(
+        _In_ const std::string& key,
+        _In_ size_t hash,
+        _In_ const AttrHash& attrHash)
+{
+    SWSS_LOG_ENTER();
+
+    // keep load factor under 3/4 and erased entries under half of entries
+
+    if ((m_size + 1) * 4 > m_slots.size() * 3)
+    {
+        rehash(std::max((size_t)OBJECT_TYPE_HASH_MIN_SLOTS, m_slots.size() * 2));
+    }
+    else if (m_entries.size() - m_size > m_size + OBJECT_TYPE_HASH_MIN_SLOTS)
+    {
+        rehash(m_slots.size());
+    }
+
+    size_t pos = findSlot(key, hash);
+
+    m_entries.emplace_back(new value_type(key, attrHash));
+
+    m_slots[pos].hash = hash;
+    m_slots[pos].index = m_entries.size() - 1;
+
+    m_size++;
+
+    return m_entries.size() - 1;
+}
+
+ObjectTypeHash::iterator ObjectTypeHash::erase(
+        _In_ const_iterator pos)
+{
+    SWSS_LOG_ENTER();
+
+    size_t index = pos.m_index;
+
+    const std::string& key = m_entries[index]->first;
+
+    eraseSlot(findSlot(key, hashKey(key)));
+
+    /*
+     * Entry is only released, vector is compacted on next insert, so
+     * iterators pointing to other entries remain valid.
+     */
+
+    m_entries[index].reset();
+
+    m_size--;
+
+    return iterator(this, index + 1);
+}
+
+size_t ObjectTypeHash::erase(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = find(key);
+
+    if (it == end())
+    {
+        return 0;
+    }
+
+    erase(it);
+
+    return 1;
+}
+
+void ObjectTypeHash::eraseSlot(
+        _In_ size_t slot)
+{
+    SWSS_LOG_ENTER();
+
+    size_t mask = m_slots.size() - 1;
+
+    size_t hole = slot;
+
+    for (size_t pos = (hole + 1) & mask; m_slots[pos].index != EMPTY_SLOT; pos = (pos + 1) & mask)
+    {
+        size_t home = m_slots[pos].hash & mask;
+
+        // move entry to hole if hole is between entry home and its position
+
+        bool movable = (pos > hole)
+            ? (home <= hole || home > pos)
+            : (home <= hole && home > pos);
+
+        if (movable)
+        {
+            m_slots[hole] = m_slots[pos];
+
+            hole = pos;
+        }
+    }
+
+    m_slots[hole].index = EMPTY_SLOT;
+}
+
+void ObjectTypeHash::rehash(
+        _In_ size_t slotCount)
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = 0;
+
+    for (size_t idx = 0; idx < m_entries.size(); idx++)
+    {
+        if (m_entries[idx])
+        {
+            m_entries[count++] = std::move(m_entries[idx]);
+        }
+    }
+
+    m_entries.resize(count);
+
+    m_slots.assign(slotCount, Slot{0, EMPTY_SLOT});
+
+    size_t mask = slotCount - 1;
+
+    for (size_t idx = 0; idx < m_entries.size(); idx++)
+    {
+        size_t hash = hashKey(m_entries[idx]->first);
+
+        size_t pos = hash & mask;
+
+        while (m_slots[pos].index != EMPTY_SLOT)
+        {
+            pos = (pos + 1) & mask;
+        }
+
+        m_slots[pos].hash = hash;
+        m_slots[pos].index = idx;
+    }
+}
+
+void ObjectTypeHash::copyFrom(
+        _In_ const ObjectTypeHash& other)
+{
+    SWSS_LOG_ENTER();
+
+    m_entries.clear();
+
+    m_entries.reserve(other.m_size);
+
+    for (auto& e: other.m_entries)
+    {
+        if (e)
+        {
+            m_entries.emplace_back(new value_type(*e));
+        }
+    }
+
+    m_size = m_entries.size();
+
+    size_t slotCount = OBJECT_TYPE_HASH_MIN_SLOTS;
+
+    while (m_size * 4 > slotCount * 3)
+    {
+        slotCount *= 2;
+    }
+
+    rehash(m_size ? slotCount : 0);
+}
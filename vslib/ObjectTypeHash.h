@@ -0,0 +1,310 @@
+#pragma once
+
+#include "SaiAttrWrap.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <iterator>
+#include <type_traits>
+
+namespace saivs
+{
+    /**
+     * @brief Objects of single object type indexed by serialized object id.
+     *
+     * Entries are kept in insertion order in dense vector and indexed by open
+     * addressing hash table with linear probing, so lookup is single hash
+     * computation and mostly one cache line probe instead of string compare on
+     * every level of ordered tree. Each probe slot caches key hash, so most
+     * mismatches are rejected without touching key string.
+     *
+     * Interface follows subset of std::map used by switch state, iteration
+     * order is insertion order. Entries are allocated separately, so
+     * references to entries are stable until entry is removed. Iterators
+     * are invalidated by insert, but not by erase.
+     */
+    class ObjectTypeHash
+    {
+        public:
+
+            /**
+             * @brief AttrHash key is attribute ID, value is actual attribute
+             */
+            typedef std::map<std::string, std::shared_ptr<SaiAttrWrap>> AttrHash;
+
+            typedef std::string key_type;
+
+            typedef AttrHash mapped_type;
+
+            typedef std::pair<const std::string, AttrHash> value_type;
+
+        private:
+
+            template <bool isConst>
+            class Iterator
+            {
+                private:
+
+                    friend class ObjectTypeHash;
+
+                    typedef typename std::conditional<isConst,
+                            const ObjectTypeHash, ObjectTypeHash>::type Container;
+
+                public:
+
+                    typedef std::forward_iterator_tag iterator_category;
+
+                    typedef ObjectTypeHash::value_type value_type;
+
+                    typedef std::ptrdiff_t difference_type;
+
+                    typedef typename std::conditional<isConst,
+                            const value_type*, value_type*>::type pointer;
+
+                    typedef typename std::conditional<isConst,
+                            const value_type&, value_type&>::type reference;
+
+                public:
+
+                    Iterator():
+                        m_container(nullptr),
+                        m_index(0)
+                    {
+                    }
+
+                    Iterator(
+                            _In_ Container* container,
+                            _In_ size_t index):
+                        m_container(container),
+                        m_index(index)
+                    {
+                        skipErased();
+                    }
+
+                    template <bool wasConst, typename = typename std::enable_if<isConst && !wasConst>::type>
+                    Iterator(
+                            _In_ const Iterator<wasConst>& other):
+                        m_container(other.m_container),
+                        m_index(other.m_index)
+                    {
+                    }
+
+                public:
+
+                    reference operator*() const
+                    {
+                        return *m_container->m_entries[m_index];
+                    }
+
+                    pointer operator->() const
+                    {
+                        return m_container->m_entries[m_index].get();
+                    }
+
+                    Iterator& operator++()
+                    {
+                        // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+                        m_index++;
+
+                        skipErased();
+
+                        return *this;
+                    }
+
+                    Iterator operator++(int)
+                    {
+                        Iterator it = *this;
+
+                        ++(*this);
+
+                        return it;
+                    }
+
+                    bool operator==(
+                            _In_ const Iterator& other) const
+                    {
+                        return m_index == other.m_index && m_container == other.m_container;
+                    }
+
+                    bool operator!=(
+                            _In_ const Iterator& other) const
+                    {
+                        return !(*this == other);
+                    }
+
+                private:
+
+                    void skipErased()
+                    {
+                        // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+                        while (m_index < m_container->m_entries.size() && !m_container->m_entries[m_index])
+                        {
+                            m_index++;
+                        }
+                    }
+
+                private:
+
+                    template <bool> friend class Iterator;
+
+                    Container* m_container;
+
+                    size_t m_index;
+            };
+
+        public:
+
+            typedef Iterator<false> iterator;
+
+            typedef Iterator<true> const_iterator;
+
+        public:
+
+            ObjectTypeHash();
+
+            ObjectTypeHash(
+                    _In_ const ObjectTypeHash& other);
+
+            ObjectTypeHash(
+                    _In_ ObjectTypeHash&& other) noexcept;
+
+            virtual ~ObjectTypeHash();
+
+            ObjectTypeHash& operator=(
+                    _In_ const ObjectTypeHash& other);
+
+            ObjectTypeHash& operator=(
+                    _In_ ObjectTypeHash&& other) noexcept;
+
+        public:
+
+            iterator begin() { return iterator(this, 0); }
+
+            iterator end() { return iterator(this, m_entries.size()); }
+
+            const_iterator begin() const { return const_iterator(this, 0); }
+
+            const_iterator end() const { return const_iterator(this, m_entries.size()); }
+
+            const_iterator cbegin() const { return begin(); }
+
+            const_iterator cend() const { return end(); }
+
+        public:
+
+            size_t size() const;
+
+            bool empty() const;
+
+            void clear();
+
+            /**
+             * @brief Allocate space for given number of entries, so they can
+             * be inserted without rehashing index.
+             */
+            void reserve(
+                    _In_ size_t count);
+
+            iterator find(
+                    _In_ const std::string& key);
+
+            const_iterator find(
+                    _In_ const std::string& key) const;
+
+            size_t count(
+                    _In_ const std::string& key) const;
+
+            /**
+             * @brief Get entry, throws std::out_of_range if entry don't exist.
+             */
+            AttrHash& at(
+                    _In_ const std::string& key);
+
+            const AttrHash& at(
+                    _In_ const std::string& key) const;
+
+            /**
+             * @brief Get entry, empty entry is inserted if it don't exist.
+             */
+            AttrHash& operator[](
+                    _In_ const std::string& key);
+
+            /**
+             * @brief Insert entry if it don't exist.
+             *
+             * @return Iterator to entry and true if entry was inserted.
+             */
+            std::pair<iterator, bool> insert(
+                    _In_ const value_type& value);
+
+            /**
+             * @brief Remove entry.
+             *
+             * @return Iterator to entry following removed one.
+             */
+            iterator erase(
+                    _In_ const_iterator pos);
+
+            size_t erase(
+                    _In_ const std::string& key);
+
+        private:
+
+            /**
+             * @brief Single probe slot, index points to m_entries.
+             */
+            struct Slot
+            {
+                size_t hash;
+
+                size_t index;
+            };
+
+            static size_t hashKey(
+                    _In_ const std::string& key);
+
+            /**
+             * @brief Find slot holding given key.
+             *
+             * @return Slot position, or position of empty slot where key
+             * should be inserted if key don't exist.
+             */
+            size_t findSlot(
+                    _In_ const std::string& key,
+                    _In_ size_t hash) const;
+
+            size_t insertEntry(
+                    _In_ const std::string& key,
+                    _In_ size_t hash,
+                    _In_ const AttrHash& attrHash);
+
+            /**
+             * @brief Remove entry from index using backward shift deletion,
+             * so no tombstones are left in probe sequences.
+             */
+            void eraseSlot(
+                    _In_ size_t slot);
+
+            /**
+             * @brief Drop erased entries and rebuild index with given number
+             * of slots, which must be power of 2.
+             */
+            void rehash(
+                    _In_ size_t slotCount);
+
+            void copyFrom(
+                    _In_ const ObjectTypeHash& other);
+
+        private:
+
+            std::vector<std::unique_ptr<value_type>> m_entries;
+
+            std::vector<Slot> m_slots;
+
+            size_t m_size;
+    };
+}
@@ -0,0 +1,177 @@
+#include "PacketRing.h"
+
+#include "swss/logger.h"
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+
+#include <string.h>
+#include <errno.h>
+
+using namespace saivs;
+
+PacketRing::PacketRing():
+    m_ring(nullptr),
+    m_ringSize(0),
+    m_blockIndex(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+PacketRing::~PacketRing()
+{
+    SWSS_LOG_ENTER();
+
+    close();
+}
+
+bool PacketRing::open(
+        _In_ int socket)
+{
+    SWSS_LOG_ENTER();
+
+    close();
+
+    int version = TPACKET_V3;
+
+    if (setsockopt(socket, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0)
+    {
+        SWSS_LOG_ERROR("setsockopt() set PACKET_VERSION failed: %s", strerror(errno));
+
+        return false;
+    }
+
+    // reserve space in front of each frame for in place VLAN tag insertion
+
+    unsigned int reserve = HEADROOM;
+
+    if (setsockopt(socket, SOL_PACKET, PACKET_RESERVE, &reserve, sizeof(reserve)) < 0)
+    {
+        SWSS_LOG_ERROR("setsockopt() set PACKET_RESERVE failed: %s", strerror(errno));
+
+        return false;
+    }
+
+    struct tpacket_req3 req;
+
+    memset(&req, 0, sizeof(req));
+
+    req.tp_block_size = BLOCK_SIZE;
+    req.tp_block_nr = BLOCK_COUNT;
+    req.tp_frame_size = FRAME_SIZE;
+    req.tp_frame_nr = (BLOCK_SIZE / FRAME_SIZE) * BLOCK_COUNT;
+    req.tp_retire_blk_tov = BLOCK_TIMEOUT_MS;
+
+    if (setsockopt(socket, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) < 0)
+    {
+        SWSS_LOG_ERROR("setsockopt() set PACKET_RX_RING failed: %s", strerror(errno));
+
+        return false;
+    }
+
+    size_t size = (size_t)BLOCK_SIZE * BLOCK_COUNT;
+
+    void* ring = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_LOCKED, socket, 0);
+
+    if (ring == MAP_FAILED)
+    {
+        // locked memory limit may be too low, try without locking
+
+        ring = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, socket, 0);
+    }
+
+    if (ring == MAP_FAILED)
+    {
+        SWSS_LOG_ERROR("mmap of packet ring failed: %s", strerror(errno));
+
+        return false;
+    }
+
+    m_ring = static_cast<unsigned char*>(ring);
+    m_ringSize = size;
+    m_blockIndex = 0;
+
+    SWSS_LOG_NOTICE("packet ring of %zu bytes mapped on socket %d", size, socket);
+
+    return true;
+}
+
+void PacketRing::close()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_ring)
+    {
+        munmap(m_ring, m_ringSize);
+
+        m_ring = nullptr;
+        m_ringSize = 0;
+    }
+}
+
+bool PacketRing::is_open() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_ring != nullptr;
+}
+
+bool PacketRing::receive(
+        _In_ const FrameCallback& callback)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_ring == nullptr)
+    {
+        SWSS_LOG_THROW("packet ring is not open");
+    }
+
+    while (true)
+    {
+        auto desc = static_cast<struct tpacket_block_desc*>(static_cast<void*>(m_ring + (size_t)m_blockIndex * BLOCK_SIZE));
+
+        if ((__atomic_load_n(&desc->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER) == 0)
+        {
+            return true; // no more blocks released by kernel
+        }
+
+        bool run = true;
+
+        auto hdr = static_cast<struct tpacket3_hdr*>(static_cast<void*>(reinterpret_cast<unsigned char*>(desc) + desc->hdr.bh1.offset_to_first_pkt));
+
+        for (uint32_t i = 0; i < desc->hdr.bh1.num_pkts && run; i++)
+        {
+            run = callback(hdr);
+
+            hdr = static_cast<struct tpacket3_hdr*>(static_cast<void*>(reinterpret_cast<unsigned char*>(hdr) + hdr->tp_next_offset));
+        }
+
+        // return block to kernel
+
+        __atomic_store_n(&desc->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+
+        m_blockIndex = (m_blockIndex + 1) % BLOCK_COUNT;
+
+        if (!run)
+        {
+            return false;
+        }
+    }
+}
+
+unsigned char* PacketRing::getFrame(
+        _In_ struct tpacket3_hdr* hdr,
+        _Out_ size_t& headroom)
+{
+    SWSS_LOG_ENTER();
+
+    // frame layout: tpacket3_hdr, sockaddr_ll, padding, frame data
+
+    size_t start = TPACKET_ALIGN(sizeof(struct tpacket3_hdr)) + sizeof(struct sockaddr_ll);
+
+    headroom = (hdr->tp_mac > start) ? (hdr->tp_mac - start) : 0;
+
+    return reinterpret_cast<unsigned char*>(hdr) + hdr->tp_mac;
+}
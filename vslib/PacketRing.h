@@ -0,0 +1,90 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <linux/if_packet.h>
+
+#include <functional>
+#include <stdint.h>
+#include <stddef.h>
+
+namespace saivs
+{
+    /**
+     * @brief Memory mapped TPACKET_V3 receive ring of packet socket.
+     *
+     * Kernel places received frames directly into blocks of memory shared
+     * with user space, so frames can be processed without recvmsg and
+     * without copying. Each frame is preceded by at least VLAN tag size of
+     * headroom, so VLAN tag can be inserted in place.
+     */
+    class PacketRing
+    {
+        private:
+
+            PacketRing(const PacketRing&) = delete;
+            PacketRing& operator=(const PacketRing&) = delete;
+
+        public:
+
+            static constexpr uint32_t BLOCK_SIZE = 1 << 16;
+
+            static constexpr uint32_t BLOCK_COUNT = 32;
+
+            static constexpr uint32_t FRAME_SIZE = 1 << 11;
+
+            static constexpr uint32_t BLOCK_TIMEOUT_MS = 2;
+
+            static constexpr uint32_t HEADROOM = 4;
+
+            /**
+             * @brief Frame callback, returns false if processing should stop.
+             */
+            typedef std::function<bool(struct tpacket3_hdr* hdr)> FrameCallback;
+
+        public:
+
+            PacketRing();
+
+            virtual ~PacketRing();
+
+        public:
+
+            /**
+             * @brief Setup receive ring on packet socket.
+             *
+             * Must be called before socket is used for receive. Socket
+             * remains owned by caller and can still be used for send.
+             */
+            bool open(
+                    _In_ int socket);
+
+            void close();
+
+            bool is_open() const;
+
+            /**
+             * @brief Process frames of all blocks released by kernel.
+             *
+             * @return False if callback requested to stop.
+             */
+            bool receive(
+                    _In_ const FrameCallback& callback);
+
+            /**
+             * @brief Get frame data and number of bytes available in front
+             * of frame data inside ring frame.
+             */
+            static unsigned char* getFrame(
+                    _In_ struct tpacket3_hdr* hdr,
+                    _Out_ size_t& headroom);
+
+        private:
+
+            unsigned char* m_ring;
+
+            size_t m_ringSize;
+
+            uint32_t m_blockIndex;
+    };
+}
@@ -163,6 +163,28 @@ sai_status_t Sai::apiInitialize(
 
     SWSS_LOG_NOTICE("use configured speed as oper speed: %s", (useConfiguredSpeedAsOperSpeed ? "true" : "false"));
 
+    auto cstrPacketEngineThreads = service_method_table->profile_get_value(0, SAI_KEY_VS_HOSTIF_PACKET_ENGINE_THREADS);
+
+    uint32_t packetEngineThreads = 0;
+
+    if (cstrPacketEngineThreads != nullptr)
+    {
+        if (sscanf(cstrPacketEngineThreads, "%u", &packetEngineThreads) != 1)
+        {
+            SWSS_LOG_WARN("failed to parse '%s' as uint32, using dedicated hostif threads", cstrPacketEngineThreads);
+
+            packetEngineThreads = 0;
+        }
+    }
+
+    SWSS_LOG_NOTICE("hostif packet engine threads: %u", packetEngineThreads);
+
+    const char *use_packet_ring = service_method_table->profile_get_value(0, SAI_KEY_VS_HOSTIF_USE_PACKET_RING);
+
+    auto usePacketRing = SwitchConfig::parseBool(use_packet_ring);
+
+    SWSS_LOG_NOTICE("hostif use packet ring: %s", (usePacketRing ? "true" : "false"));
+
     auto cstrGlobalContext = service_method_table->profile_get_value(0, SAI_KEY_VS_GLOBAL_CONTEXT);
 
     m_globalContext = 0;
@@ -219,6 +241,13 @@ sai_status_t Sai::apiInitialize(
 
     m_eventQueue = std::make_shared<EventQueue>(m_signal);
 
+    std::shared_ptr<HostifPacketEngine> packetEngine;
+
+    if (packetEngineThreads)
+    {
+        packetEngine = std::make_shared<HostifPacketEngine>(packetEngineThreads);
+    }
+
     for (auto& sc: scc->getSwitchConfigs())
     {
         // NOTE: switch index and hardware info is already populated
@@ -230,6 +259,8 @@ sai_status_t Sai::apiInitialize(
         sc->m_useConfiguredSpeedAsOperSpeed = useConfiguredSpeedAsOperSpeed;
         sc->m_laneMap = m_laneMapContainer->getLaneMap(sc->m_switchIndex);
         sc->m_bfdOffload = bfdOffloadSupported;
+        sc->m_hostifPacketEngine = packetEngine;
+        sc->m_hostifUsePacketRing = usePacketRing;
 
         if (sc->m_laneMap == nullptr)
         {
@@ -258,6 +289,8 @@ sai_status_t Sai::apiInitialize(
 
     m_vsSai->setMeta(m_meta);
 
+    m_vsSai->setWarmBootWriteFile(m_warm_boot_write_file);
+
     if (bootType == SAI_VS_BOOT_TYPE_WARM)
     {
         if (!m_vsSai->readWarmBootFile(m_warm_boot_read_file))
@@ -311,7 +344,7 @@ sai_status_t Sai::apiUninitialize(void)
 
     // clear state after ending all threads
 
-    m_vsSai->writeWarmBootFile(m_warm_boot_write_file);
+    m_vsSai->closeWarmBootFile();
 
     m_vsSai = nullptr;
     m_meta = nullptr;
@@ -19,7 +19,8 @@ SwitchConfig::SwitchConfig(
     m_hardwareInfo(hwinfo),
     m_useTapDevice(false),
     m_bfdOffload(true),
-    m_useConfiguredSpeedAsOperSpeed(false)
+    m_useConfiguredSpeedAsOperSpeed(false),
+    m_hostifUsePacketRing(false)
 {
     SWSS_LOG_ENTER();
 
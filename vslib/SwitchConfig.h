@@ -4,6 +4,7 @@
 #include "EventQueue.h"
 #include "ResourceLimiter.h"
 #include "CorePortIndexMap.h"
+#include "HostifPacketEngine.h"
 
 #include <string>
 #include <memory>
@@ -99,5 +100,13 @@ namespace saivs
             std::shared_ptr<ResourceLimiter> m_resourceLimiter;
 
             std::shared_ptr<CorePortIndexMap> m_corePortIndexMap;
+
+            /**
+             * @brief Packet engine serving host interfaces, when nullptr
+             * each host interface uses dedicated threads.
+             */
+            std::shared_ptr<HostifPacketEngine> m_hostifPacketEngine;
+
+            bool m_hostifUsePacketRing;
     };
 }
@@ -5,6 +5,7 @@ extern "C" {
 }
 
 #include "SaiAttrWrap.h"
+#include "ObjectTypeHash.h"
 #include "SwitchConfig.h"
 
 #include "meta/Meta.h"
@@ -26,12 +27,15 @@ namespace saivs
             /**
              * @brief AttrHash key is attribute ID, value is actual attribute
              */
-            typedef std::map<std::string, std::shared_ptr<SaiAttrWrap>> AttrHash;
+            typedef ObjectTypeHash::AttrHash AttrHash;
 
             /**
              * @brief ObjectHash is map indexed by object type and then serialized object id.
+             *
+             * Objects of each type are held in hash table, since single type
+             * (like routes) can have millions of entries.
              */
-            typedef std::map<sai_object_type_t, std::map<std::string, AttrHash>> ObjectHash;
+            typedef std::map<sai_object_type_t, ObjectTypeHash> ObjectHash;
 
         public:
 
@@ -6,6 +6,7 @@
 #include "meta/NotificationSwitchMacsecPostStatus.h"
 #include "meta/NotificationMacsecPostStatus.h"
 #include "EventPayloadNotification.h"
+#include "WarmBootSnapshot.h"
 
 #include <net/if.h>
 #include <unistd.h>
@@ -54,6 +55,18 @@ SwitchStateBase::SwitchStateBase(
         {
             m_fdb_info_set = warmBootState->m_fdbInfoSet;
 
+            // schedule oldest entries first, wheel starts from first timestamp
+
+            std::vector<FdbInfo> fdbInfos(m_fdb_info_set.begin(), m_fdb_info_set.end());
+
+            std::sort(fdbInfos.begin(), fdbInfos.end(), [](const FdbInfo& a, const FdbInfo& b) {
+                    return a.getTimestamp() < b.getTimestamp(); });
+
+            for (auto& fi: fdbInfos)
+            {
+                m_fdbAgingWheel.schedule(fi);
+            }
+
             // TODO populate m_hostif_info_map - need to be able to remove port after warm boot
             // should be auto populated vs_recreate_hostif_tap_interfaces on create_switch
         }
@@ -285,21 +298,18 @@ sai_status_t SwitchStateBase::create_internal(
         }
     }
 
-    if (objectHash.find(serializedObjectId) == objectHash.end())
-    {
-        /*
-         * Number of attributes may be zero, so see if actual entry was created
-         * with empty hash.
-         */
+    /*
+     * Number of attributes may be zero, so actual entry is created with empty
+     * hash if it don't exist.
+     */
 
-        objectHash[serializedObjectId] = {};
-    }
+    auto& attrHash = (it == objectHash.end()) ? objectHash[serializedObjectId] : it->second;
 
     for (uint32_t i = 0; i < attr_count; ++i)
     {
         auto a = std::make_shared<SaiAttrWrap>(object_type, &attr_list[i]);
 
-        objectHash[serializedObjectId][a->getAttrMetadata()->attridname] = a;
+        attrHash[a->getAttrMetadata()->attridname] = a;
     }
 
     if (object_type == SAI_OBJECT_TYPE_SWITCH)
@@ -620,9 +630,11 @@ sai_status_t SwitchStateBase::set_internal(
 {
     SWSS_LOG_ENTER();
 
-    auto it = m_objectHash.at(objectType).find(serializedObjectId);
+    auto &objectHash = m_objectHash.at(objectType);
+
+    auto it = objectHash.find(serializedObjectId);
 
-    if (it == m_objectHash.at(objectType).end())
+    if (it == objectHash.end())
     {
         SWSS_LOG_ERROR("not found %s:%s",
                 sai_serialize_object_type(objectType).c_str(),
@@ -2934,13 +2946,23 @@ sai_status_t SwitchStateBase::refresh_read_only(
     return SAI_STATUS_NOT_IMPLEMENTED;
 }
 
-void SwitchStateBase::processFdbEntriesForAging()
+bool SwitchStateBase::getFdbAgingTime(
+        _Out_ uint32_t& agingTime)
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_DEBUG("fdb infos to process: %zu", m_fdb_info_set.size());
+    // read directly from switch state, get() would log every aging tick
 
-    uint32_t current = (uint32_t)time(NULL);
+    auto& attrHash = m_objectHash.at(SAI_OBJECT_TYPE_SWITCH).at(sai_serialize_object_id(m_switch_id));
+
+    auto it = attrHash.find("SAI_SWITCH_ATTR_FDB_AGING_TIME");
+
+    if (it != attrHash.end())
+    {
+        agingTime = it->second->getAttr()->value.u32;
+
+        return true;
+    }
 
     sai_attribute_t attr;
 
@@ -2949,6 +2971,26 @@ void SwitchStateBase::processFdbEntriesForAging()
     sai_status_t status = get(SAI_OBJECT_TYPE_SWITCH, m_switch_id, 1, &attr);
 
     if (status != SAI_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    agingTime = attr.value.u32;
+
+    return true;
+}
+
+void SwitchStateBase::processFdbEntriesForAging()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_DEBUG("fdb infos to process: %zu", m_fdbAgingWheel.size());
+
+    uint32_t current = (uint32_t)time(NULL);
+
+    uint32_t aging_time;
+
+    if (!getFdbAgingTime(aging_time))
     {
         SWSS_LOG_WARN("failed to get FDB aging time for switch %s",
                 sai_serialize_object_id(m_switch_id).c_str());
@@ -2956,30 +2998,50 @@ void SwitchStateBase::processFdbEntriesForAging()
         return;
     }
 
-    uint32_t aging_time = attr.value.u32;
-
     if (aging_time == 0)
     {
         SWSS_LOG_DEBUG("aging is disabled");
         return;
     }
 
-    // find aged fdb entries
-
-    for (auto it = m_fdb_info_set.begin(); it != m_fdb_info_set.end();)
+    if (current < aging_time)
     {
-        if ((current - it->getTimestamp()) >= aging_time)
-        {
-            FdbInfo fi = *it;
+        return;
+    }
 
-            processFdbInfo(fi, SAI_FDB_EVENT_AGED);
+    uint32_t cutoff = current - aging_time;
 
-            it = m_fdb_info_set.erase(it);
-        }
-        else
-        {
-            ++it;
-        }
+    // find aged fdb entries, only expired wheel slots are visited
+
+    std::vector<FdbInfo> aged;
+
+    m_fdbAgingWheel.advance(cutoff, [&](const FdbInfo& expired) {
+
+            auto it = m_fdb_info_set.find(expired);
+
+            if (it == m_fdb_info_set.end())
+            {
+                // entry was flushed or removed
+                return;
+            }
+
+            if (it->getTimestamp() > cutoff)
+            {
+                // entry was refreshed, schedule with new timestamp
+                m_fdbAgingWheel.schedule(*it);
+                return;
+            }
+
+            aged.push_back(*it);
+
+            m_fdb_info_set.erase(it);
+    });
+
+    if (aged.size())
+    {
+        SWSS_LOG_INFO("aged %zu fdb entries", aged.size());
+
+        processFdbInfos(aged, SAI_FDB_EVENT_AGED);
     }
 }
 
@@ -3434,43 +3496,27 @@ bool SwitchStateBase::check_object_list_default_state(
             [&](sai_object_id_t oid) { return check_object_default_state(oid); });
 }
 
-std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
+bool SwitchStateBase::dump_switch_database_for_warm_restart(
+        _In_ int fd) const
 {
     SWSS_LOG_ENTER();
 
-    std::stringstream ss;
+    WarmBootSnapshot snapshot(fd);
 
-    const auto& objectHash = m_objectHash;
-
-    // dump all objects and attributes to file
+    // stream all objects and attributes as binary snapshot sections
 
     size_t count = 0;
 
-    for (auto kvp: objectHash)
+    for (auto& kvp: m_objectHash)
     {
-        auto singleTypeObjectMap = kvp.second;
+        if (kvp.second.empty())
+            continue;
 
-        count += singleTypeObjectMap.size();
+        count += kvp.second.size();
 
-        for (auto o: singleTypeObjectMap)
+        if (!snapshot.writeObjects(m_switch_id, kvp.first, kvp.second))
         {
-            // if object don't have attributes, size can be zero
-            if (o.second.size() == 0)
-            {
-                ss << sai_serialize_object_type(kvp.first) << " " << o.first << " NULL NULL" << std::endl;
-                continue;
-            }
-
-            for (auto a: o.second)
-            {
-                ss << sai_serialize_object_type(kvp.first) << " ";
-                ss << o.first.c_str();
-                ss << " ";
-                ss << a.first.c_str();
-                ss << " ";
-                ss << a.second->getAttrStrValue();
-                ss << std::endl;
-            }
+            return false;
         }
     }
 
@@ -3481,9 +3527,9 @@ std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
          * data and restore it on warm start.
          */
 
-        for (auto fi: m_fdb_info_set)
+        if (!snapshot.writeFdbInfos(m_switch_id, m_fdb_info_set))
         {
-            ss << SAI_VS_FDB_INFO << " " << fi.serialize() << std::endl;
+            return false;
         }
 
         SWSS_LOG_NOTICE("dumped %zu fdb infos for switch %s",
@@ -3495,7 +3541,7 @@ std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
             count,
             sai_serialize_object_id(m_switch_id).c_str());
 
-    return ss.str();
+    return true;
 }
 
 sai_object_type_t SwitchStateBase::objectTypeQuery(
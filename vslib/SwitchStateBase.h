@@ -2,6 +2,7 @@
 
 #include "SwitchState.h"
 #include "FdbInfo.h"
+#include "FdbAgingWheel.h"
 #include "HostInterfaceInfo.h"
 #include "WarmBootState.h"
 #include "SwitchConfig.h"
@@ -387,6 +388,16 @@ namespace saivs
                     _In_ const FdbInfo &fi,
                     _In_ sai_fdb_event_t fdb_event);
 
+            /**
+             * @brief Process FDB infos and send all events in single notification.
+             */
+            void processFdbInfos(
+                    _In_ const std::vector<FdbInfo> &fdbInfos,
+                    _In_ sai_fdb_event_t fdb_event);
+
+            bool getFdbAgingTime(
+                    _Out_ uint32_t& agingTime);
+
             void findBridgeVlanForPortVlan(
                     _In_ sai_object_id_t port_id,
                     _In_ sai_vlan_id_t vlan_id,
@@ -558,7 +569,8 @@ namespace saivs
                     _In_ sai_object_id_t port_id,
                     _In_ sai_port_oper_status_t port_oper_status);
 
-            std::string dump_switch_database_for_warm_restart() const;
+            bool dump_switch_database_for_warm_restart(
+                    _In_ int fd) const;
 
             void syncOnLinkMsg(
                     _In_ std::shared_ptr<EventPayloadNetLinkMsg> payload);
@@ -566,6 +578,10 @@ namespace saivs
             void send_fdb_event_notification(
                     _In_ const sai_fdb_event_notification_data_t& data);
 
+            void send_fdb_event_notification(
+                    _In_ uint32_t count,
+                    _In_ const sai_fdb_event_notification_data_t* data);
+
         protected: // Telemetry and Monitor
 
             void send_tam_tel_type_config_change(
@@ -801,6 +817,12 @@ namespace saivs
 
             std::set<FdbInfo> m_fdb_info_set;
 
+            /**
+             * @brief Learned FDB infos scheduled for aging, wheel entries
+             * are validated against m_fdb_info_set when they expire.
+             */
+            FdbAgingWheel m_fdbAgingWheel;
+
             std::map<std::string, std::shared_ptr<HostInterfaceInfo>> m_hostif_info_map;
 
             std::shared_ptr<RealObjectIdManager> m_realObjectIdManager;
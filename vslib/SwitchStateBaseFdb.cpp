@@ -66,27 +66,50 @@ void SwitchStateBase::processFdbInfo(
 {
     SWSS_LOG_ENTER();
 
-    sai_attribute_t attrs[2];
+    processFdbInfos(std::vector<FdbInfo>{fi}, fdb_event);
+}
+
+void SwitchStateBase::processFdbInfos(
+        _In_ const std::vector<FdbInfo> &fdbInfos,
+        _In_ sai_fdb_event_t fdb_event)
+{
+    SWSS_LOG_ENTER();
+
+    if (fdbInfos.empty())
+    {
+        return;
+    }
 
-    attrs[0].id = SAI_FDB_ENTRY_ATTR_TYPE;
-    attrs[0].value.s32 = SAI_FDB_ENTRY_TYPE_DYNAMIC;
+    // attributes must not be reallocated, since data points to them
 
-    attrs[1].id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
-    attrs[1].value.oid = fi.getBridgePortId();
+    std::vector<sai_attribute_t> attrs(fdbInfos.size() * 2);
+
+    std::vector<sai_fdb_event_notification_data_t> data(fdbInfos.size());
+
+    for (size_t idx = 0; idx < fdbInfos.size(); idx++)
+    {
+        const auto& fi = fdbInfos[idx];
 
-    sai_fdb_event_notification_data_t data;
+        sai_attribute_t* attr = &attrs[idx * 2];
 
-    data.event_type = fdb_event;
+        attr[0].id = SAI_FDB_ENTRY_ATTR_TYPE;
+        attr[0].value.s32 = SAI_FDB_ENTRY_TYPE_DYNAMIC;
 
-    data.fdb_entry = fi.getFdbEntry();
+        attr[1].id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
+        attr[1].value.oid = fi.getBridgePortId();
 
-    data.attr_count = 2;
-    data.attr = attrs;
+        data[idx].event_type = fdb_event;
 
-    // update local DB
-    updateLocalDB(data, fdb_event); // TODO we could move to send_fdb_event_notification and support flush
+        data[idx].fdb_entry = fi.getFdbEntry();
 
-    send_fdb_event_notification(data);
+        data[idx].attr_count = 2;
+        data[idx].attr = attr;
+
+        // update local DB
+        updateLocalDB(data[idx], fdb_event); // TODO we could move to send_fdb_event_notification and support flush
+    }
+
+    send_fdb_event_notification((uint32_t)data.size(), data.data());
 }
 
 void SwitchStateBase::findBridgeVlanForPortVlan(
@@ -525,6 +548,8 @@ void SwitchStateBase::process_packet_for_fdb_event(
 
         fi.setTimestamp(frametime);
 
+        m_fdb_info_set.erase(it);
+
         m_fdb_info_set.insert(fi);
 
         return;
@@ -563,6 +588,8 @@ void SwitchStateBase::process_packet_for_fdb_event(
 
             m_fdb_info_set.insert(fi);
 
+            m_fdbAgingWheel.schedule(fi);
+
             processFdbInfo(fi, SAI_FDB_EVENT_LEARNED);
         }
         else if (attr.value.s32 == SAI_BRIDGE_PORT_FDB_LEARNING_MODE_DISABLE)
@@ -589,11 +616,20 @@ void SwitchStateBase::send_fdb_event_notification(
 {
     SWSS_LOG_ENTER();
 
+    send_fdb_event_notification(1, &data);
+}
+
+void SwitchStateBase::send_fdb_event_notification(
+        _In_ uint32_t count,
+        _In_ const sai_fdb_event_notification_data_t* data)
+{
+    SWSS_LOG_ENTER();
+
     auto meta = getMeta();
 
     if (meta)
     {
-        meta->meta_sai_on_fdb_event(1, &data);
+        meta->meta_sai_on_fdb_event(count, data);
     }
 
     sai_attribute_t attr;
@@ -610,7 +646,7 @@ void SwitchStateBase::send_fdb_event_notification(
         return;
     }
 
-    auto str = sai_serialize_fdb_event_ntf(1, &data);
+    auto str = sai_serialize_fdb_event_ntf(count, data);
 
     sai_switch_notifications_t sn = { };
 
@@ -460,6 +460,22 @@ bool SwitchStateBase::hostif_create_tap_veth_forwarding(
         return false;
     }
 
+    std::shared_ptr<PacketRing> ring;
+
+    if (m_switchConfig->m_hostifUsePacketRing)
+    {
+        ring = std::make_shared<PacketRing>();
+
+        if (!ring->open(packet_socket))
+        {
+            SWSS_LOG_ERROR("failed to setup packet ring for %s", vethname.c_str());
+
+            close(packet_socket);
+
+            return false;
+        }
+    }
+
     // bind to device
 
     struct sockaddr_ll sock_address;
@@ -508,7 +524,19 @@ bool SwitchStateBase::hostif_create_tap_veth_forwarding(
                 port_id,
                 m_switchConfig->m_eventQueue);
 
-    m_hostif_info_map[tapname]->runThreads();
+    if (ring)
+    {
+        m_hostif_info_map[tapname]->usePacketRing(ring);
+    }
+
+    if (m_switchConfig->m_hostifPacketEngine)
+    {
+        m_hostif_info_map[tapname]->runPacketEngine(m_switchConfig->m_hostifPacketEngine);
+    }
+    else
+    {
+        m_hostif_info_map[tapname]->runThreads();
+    }
 
     SWSS_LOG_NOTICE("setup forward rule for %s succeeded", tapname.c_str());
 
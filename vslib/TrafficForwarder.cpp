@@ -72,6 +72,38 @@ bool TrafficForwarder::addVlanTag(
     return false;
 }
 
+unsigned char* TrafficForwarder::addVlanTagInPlace(
+        _Inout_ unsigned char *buffer,
+        _Inout_ size_t &length,
+        _In_ uint16_t vlanTci)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_DEBUG("got vlan tci: 0x%x, vlanid: %d", vlanTci, vlanTci & 0xFFF);
+
+    if ((length + VLAN_TAG_SIZE) > ETH_FRAME_BUFFER_SIZE)
+    {
+        SWSS_LOG_THROW("The VLAN packet size %lu exceeds the ETH_FRAME_BUFFER_SIZE", length + VLAN_TAG_SIZE);
+    }
+
+    // only MAC addresses are moved, instead of the whole frame
+
+    unsigned char* frame = buffer - VLAN_TAG_SIZE;
+
+    memmove(frame, buffer, 2 * MAC_ADDRESS_SIZE);
+
+    uint16_t tci = htons(vlanTci);
+    uint16_t tpid = htons(IEEE_8021Q_ETHER_TYPE);
+
+    uint8_t* pvlan = (uint8_t *)(frame + 2 * MAC_ADDRESS_SIZE);
+    memcpy(pvlan, &tpid, sizeof(uint16_t));
+    memcpy(pvlan + sizeof(uint16_t), &tci, sizeof(uint16_t));
+
+    length += VLAN_TAG_SIZE;
+
+    return frame;
+}
+
 bool TrafficForwarder::sendTo(
         _In_ int fd,
         _In_ const unsigned char *buffer,
@@ -3,6 +3,7 @@
 #include "swss/sal.h"
 
 #include <stddef.h>
+#include <stdint.h>
 #include <sys/socket.h>
 
 namespace saivs
@@ -27,6 +28,17 @@ namespace saivs
                     _Inout_ size_t &length,
                     _Inout_ struct msghdr &msg);
 
+            /**
+             * @brief Insert VLAN tag by moving MAC addresses into headroom
+             * in front of buffer, which must be at least VLAN tag size.
+             *
+             * @return Beginning of tagged frame.
+             */
+            static unsigned char* addVlanTagInPlace(
+                    _Inout_ unsigned char *buffer,
+                    _Inout_ size_t &length,
+                    _In_ uint16_t vlanTci);
+
             virtual bool sendTo(
                     _In_ int fd,
                     _In_ const unsigned char *buffer,
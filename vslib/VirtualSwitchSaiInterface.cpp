@@ -15,11 +15,18 @@
 #include "SwitchBCM56971B0.h"
 #include "SwitchMLNX2700.h"
 #include "SwitchNvdaMBF2H536C.h"
+#include "WarmBootSnapshot.h"
 #ifdef USE_VPP
 #include "SwitchVpp.h"
 #endif
 
 #include <inttypes.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 /*
  * Max number of counters used in 1 api call
@@ -34,6 +41,7 @@ using namespace sairediscommon;
 
 VirtualSwitchSaiInterface::VirtualSwitchSaiInterface(
         _In_ std::shared_ptr<ContextConfig> contextConfig):
+    m_warmBootWriteFd(-1),
     m_contextConfig(contextConfig)
 {
     SWSS_LOG_ENTER();
@@ -47,7 +55,10 @@ VirtualSwitchSaiInterface::~VirtualSwitchSaiInterface()
 {
     SWSS_LOG_ENTER();
 
-    // empty
+    if (m_warmBootWriteFd >= 0)
+    {
+        ::close(m_warmBootWriteFd);
+    }
 }
 
 sai_status_t VirtualSwitchSaiInterface::apiInitialize(
@@ -319,7 +330,7 @@ sai_status_t VirtualSwitchSaiInterface::create(
 
         if (m_switchStateMap.find(switchId) != m_switchStateMap.end())
         {
-            if (m_warmBootData.find(switchId) == m_warmBootData.end())
+            if (m_warmBootSwitchIds.find(switchId) == m_warmBootSwitchIds.end())
             {
                 SWSS_LOG_ERROR("switch %s with hwinfo '%s' already exists",
                         sai_serialize_object_id(switchId).c_str(),
@@ -765,7 +776,13 @@ sai_status_t VirtualSwitchSaiInterface::remove(
 
             if (attr.value.booldata)
             {
-                m_warmBootData[switchId] = ss->dump_switch_database_for_warm_restart();
+                m_warmBootSwitchIds.insert(switchId);
+
+                if (!dumpWarmBootSwitch(ss))
+                {
+                    SWSS_LOG_ERROR("failed to dump switch %s for warm restart",
+                            sai_serialize_object_id(switchId).c_str());
+                }
             }
         }
         else
@@ -1402,44 +1419,76 @@ sai_status_t VirtualSwitchSaiInterface::queryApiVersion(
     return SAI_STATUS_INVALID_PARAMETER;
 }
 
-bool VirtualSwitchSaiInterface::writeWarmBootFile(
-        _In_ const char* warmBootFile) const
+void VirtualSwitchSaiInterface::setWarmBootWriteFile(
+        _In_ const char* warmBootFile)
+{
+    SWSS_LOG_ENTER();
+
+    m_warmBootWriteFile = warmBootFile ? warmBootFile : "";
+}
+
+bool VirtualSwitchSaiInterface::dumpWarmBootSwitch(
+        _In_ std::shared_ptr<SwitchStateBase> ss)
 {
     SWSS_LOG_ENTER();
 
-    if (warmBootFile)
+    if (m_warmBootWriteFile.empty())
+    {
+        SWSS_LOG_WARN("warm boot write file is not specified, but SAI_SWITCH_ATTR_RESTART_WARM was set to true!");
+
+        return false;
+    }
+
+    if (m_warmBootWriteFd < 0)
     {
-        std::ofstream ofs;
+        // first dumped switch truncates file, next switches are appended
 
-        ofs.open(warmBootFile);
+        m_warmBootWriteFd = ::open(m_warmBootWriteFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
 
-        if (!ofs.is_open())
+        if (m_warmBootWriteFd < 0)
         {
-            SWSS_LOG_ERROR("failed to open: %s", warmBootFile);
+            SWSS_LOG_ERROR("failed to open: %s: %s", m_warmBootWriteFile.c_str(), strerror(errno));
+
             return false;
         }
+    }
 
-        if (m_warmBootData.size() == 0)
-        {
-            SWSS_LOG_WARN("warm boot data is empty, is that what you want?");
-        }
+    // switch state is released right after remove, so it's streamed to file now
 
-        for (auto& kvp: m_warmBootData)
-        {
-            ofs << kvp.second;
-        }
+    return ss->dump_switch_database_for_warm_restart(m_warmBootWriteFd);
+}
 
-        ofs.close();
+bool VirtualSwitchSaiInterface::closeWarmBootFile()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_warmBootWriteFd >= 0)
+    {
+        ::close(m_warmBootWriteFd);
+
+        m_warmBootWriteFd = -1;
 
         return true;
     }
 
-    if (m_warmBootData.size())
+    if (m_warmBootWriteFile.empty())
     {
-        SWSS_LOG_WARN("warm boot write file is not specified, but SAI_SWITCH_ATTR_RESTART_WARM was set to true!");
+        return false;
+    }
+
+    SWSS_LOG_WARN("warm boot data is empty, is that what you want?");
+
+    int fd = ::open(m_warmBootWriteFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0)
+    {
+        SWSS_LOG_ERROR("failed to open: %s: %s", m_warmBootWriteFile.c_str(), strerror(errno));
+        return false;
     }
 
-    return false;
+    ::close(fd);
+
+    return true;
 }
 
 bool VirtualSwitchSaiInterface::readWarmBootFile(
@@ -1454,10 +1503,104 @@ bool VirtualSwitchSaiInterface::readWarmBootFile(
         return false;
     }
 
+    int fd = ::open(warmBootFile, O_RDONLY);
+
+    if (fd < 0)
+    {
+        SWSS_LOG_ERROR("failed to open: %s: %s", warmBootFile, strerror(errno));
+
+        return false;
+    }
+
+    struct stat st;
+
+    if (::fstat(fd, &st) != 0)
+    {
+        SWSS_LOG_ERROR("failed to stat: %s: %s", warmBootFile, strerror(errno));
+
+        ::close(fd);
+        return false;
+    }
+
+    size_t size = (size_t)st.st_size;
+
+    SWSS_LOG_NOTICE("%s file size: %zu", warmBootFile, size);
+
+    void* data = size ? ::mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+
+    ::close(fd);
+
+    bool success;
+
+    if (data != MAP_FAILED && WarmBootSnapshot::isSnapshot((const char*)data, size))
+    {
+        success = readWarmBootSnapshot((const char*)data, size);
+    }
+    else
+    {
+        // files written by previous versions are in text format
+
+        success = readWarmBootTextFile(warmBootFile);
+    }
+
+    if (data != MAP_FAILED)
+    {
+        ::munmap(data, size);
+    }
+
+    if (!success)
+    {
+        m_warmBootState.clear();
+
+        return false;
+    }
+
+    SWSS_LOG_NOTICE("warm boot file %s stats, loaded switches: %zu", warmBootFile, m_warmBootState.size());
+
+    for (auto& kvp: m_warmBootState)
+    {
+        size_t count = 0;
+
+        for (auto& o: kvp.second.m_objectHash)
+        {
+            count += o.second.size();
+        }
+
+        SWSS_LOG_NOTICE("switch %s loaded %zu objects",
+                sai_serialize_object_id(kvp.first).c_str(),
+                count);
+
+        SWSS_LOG_NOTICE("switch %s loaded %zu fdb infos",
+                sai_serialize_object_id(kvp.first).c_str(),
+                kvp.second.m_fdbInfoSet.size());
+    }
+
+    return true;
+}
+
+bool VirtualSwitchSaiInterface::readWarmBootSnapshot(
+        _In_ const char* data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    try
+    {
+        return WarmBootSnapshot::deserialize(data, size, m_warmBootState,
+                [this](sai_object_id_t oid) { m_realObjectIdManager->updateWarmBootObjectIndex(oid); });
+    }
+    catch (const std::exception& e)
     {
-        std::ifstream in(warmBootFile, std::ifstream::ate | std::ifstream::binary);
-        SWSS_LOG_NOTICE("%s file size: %zu", warmBootFile, (size_t)in.tellg());
+        SWSS_LOG_ERROR("failed to deserialize warm boot snapshot: %s", e.what());
+
+        return false;
     }
+}
+
+bool VirtualSwitchSaiInterface::readWarmBootTextFile(
+        _In_ const char* warmBootFile)
+{
+    SWSS_LOG_ENTER();
 
     std::ifstream ifs;
 
@@ -1564,26 +1707,6 @@ bool VirtualSwitchSaiInterface::readWarmBootFile(
 
     ifs.close();
 
-    SWSS_LOG_NOTICE("warm boot file %s stats, loaded switches: %zu", warmBootFile, m_warmBootState.size());
-
-    for (auto& kvp: m_warmBootState)
-    {
-        size_t count = 0;
-
-        for (auto& o: kvp.second.m_objectHash)
-        {
-            count += o.second.size();
-        }
-
-        SWSS_LOG_NOTICE("switch %s loaded %zu objects",
-                sai_serialize_object_id(kvp.first).c_str(),
-                count);
-
-        SWSS_LOG_NOTICE("switch %s loaded %zu fdb infos",
-                sai_serialize_object_id(kvp.first).c_str(),
-                kvp.second.m_fdbInfoSet.size());
-    }
-
     return true;
 }
 
@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 
 namespace saivs
 {
@@ -309,12 +310,39 @@ namespace saivs
             void setMeta(
                     _In_ std::weak_ptr<saimeta::Meta> meta);
 
-            bool writeWarmBootFile(
-                    _In_ const char* warmBootFile) const;
+            /**
+             * @brief Sets file to which switch state is streamed when switch
+             * is removed with SAI_SWITCH_ATTR_RESTART_WARM set.
+             */
+            void setWarmBootWriteFile(
+                    _In_ const char* warmBootFile);
+
+            /**
+             * @brief Closes warm boot write file.
+             *
+             * If no switch was dumped, file is truncated.
+             *
+             * @return True if warm boot file was written, false otherwise.
+             */
+            bool closeWarmBootFile();
 
             bool readWarmBootFile(
                     _In_ const char* warmBootFile);
 
+        private:
+
+            bool readWarmBootSnapshot(
+                    _In_ const char* data,
+                    _In_ size_t size);
+
+            bool readWarmBootTextFile(
+                    _In_ const char* warmBootFile);
+
+            bool dumpWarmBootSwitch(
+                    _In_ std::shared_ptr<SwitchStateBase> ss);
+
+        public:
+
             void ageFdbs();
 
             void debugSetStats(
@@ -331,7 +359,11 @@ namespace saivs
 
             std::weak_ptr<saimeta::Meta> m_meta;
 
-            std::map<sai_object_id_t, std::string> m_warmBootData;
+            std::set<sai_object_id_t> m_warmBootSwitchIds;
+
+            std::string m_warmBootWriteFile;
+
+            int m_warmBootWriteFd;
 
             std::map<sai_object_id_t, WarmBootState> m_warmBootState;
 
@@ -0,0 +1,563 @@
+#include "WarmBootSnapshot.h"
+
+#include "swss/logger.h"
+
+#include "meta/sai_serialize.h"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+using namespace saivs;
+
+/**
+ * @def WARM_BOOT_SNAPSHOT_MAGIC
+ *
+ * Magic value at the beginning of each section, "VSWB" in little endian.
+ */
+#define WARM_BOOT_SNAPSHOT_MAGIC (0x42575356)
+
+/**
+ * @def WARM_BOOT_SNAPSHOT_VERSION
+ *
+ * Version of section format, needs to be bumped every time format changes.
+ */
+#define WARM_BOOT_SNAPSHOT_VERSION (1)
+
+/**
+ * @def WARM_BOOT_SECTION_FDB_INFO
+ *
+ * Section type of FDB info set, other section types are object types.
+ */
+#define WARM_BOOT_SECTION_FDB_INFO (0xFFFFFFFF)
+
+/**
+ * @def WARM_BOOT_SNAPSHOT_BUFFER_SIZE
+ *
+ * Size of buffer in which payload is collected before it's written to file.
+ */
+#define WARM_BOOT_SNAPSHOT_BUFFER_SIZE (64 * 1024)
+
+/**
+ * @def WARM_BOOT_SNAPSHOT_CHECKSUM_INIT
+ *
+ * FNV-1a offset basis.
+ */
+#define WARM_BOOT_SNAPSHOT_CHECKSUM_INIT (0xcbf29ce484222325ULL)
+
+typedef struct _warm_boot_section_header_t
+{
+    uint32_t magic;
+
+    uint32_t version;
+
+    uint32_t sectionType;
+
+    uint32_t count;
+
+    uint64_t switchId;
+
+    uint64_t size;
+
+    uint64_t checksum;
+
+} warm_boot_section_header_t;
+
+WarmBootSnapshot::WarmBootSnapshot(
+        _In_ int fd):
+    m_fd(fd),
+    m_failed(false),
+    m_headerOffset(0),
+    m_sectionType(0),
+    m_switchId(SAI_NULL_OBJECT_ID),
+    m_size(0),
+    m_checksum(WARM_BOOT_SNAPSHOT_CHECKSUM_INIT)
+{
+    SWSS_LOG_ENTER();
+
+    m_buffer.reserve(WARM_BOOT_SNAPSHOT_BUFFER_SIZE);
+}
+
+WarmBootSnapshot::~WarmBootSnapshot()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+bool WarmBootSnapshot::isSnapshot(
+        _In_ const char* data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t magic;
+
+    if (data == NULL || size < sizeof(warm_boot_section_header_t))
+    {
+        return false;
+    }
+
+    memcpy(&magic, data, sizeof(magic));
+
+    return magic == WARM_BOOT_SNAPSHOT_MAGIC;
+}
+
+uint64_t WarmBootSnapshot::checksum(
+        _In_ const char* data,
+        _In_ size_t size,
+        _In_ uint64_t hash)
+{
+    SWSS_LOG_ENTER();
+
+    // FNV-1a, can be continued on next chunk of data
+
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        hash ^= (uint8_t)data[idx];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+bool WarmBootSnapshot::writeAt(
+        _In_ const void* data,
+        _In_ size_t size,
+        _In_ off_t offset)
+{
+    SWSS_LOG_ENTER();
+
+    const char* pos = (const char*)data;
+
+    while (size)
+    {
+        ssize_t written = (offset < 0)
+            ? ::write(m_fd, pos, size)
+            : ::pwrite(m_fd, pos, size, offset);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            SWSS_LOG_ERROR("failed to write warm boot snapshot: %s", strerror(errno));
+
+            m_failed = true;
+
+            return false;
+        }
+
+        pos += written;
+        size -= (size_t)written;
+
+        if (offset >= 0)
+        {
+            offset += written;
+        }
+    }
+
+    return true;
+}
+
+bool WarmBootSnapshot::flush()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_failed)
+    {
+        return false;
+    }
+
+    if (m_buffer.empty())
+    {
+        return true;
+    }
+
+    m_checksum = checksum(m_buffer.data(), m_buffer.size(), m_checksum);
+
+    m_size += m_buffer.size();
+
+    bool success = writeAt(m_buffer.data(), m_buffer.size(), -1);
+
+    m_buffer.clear();
+
+    return success;
+}
+
+void WarmBootSnapshot::append(
+        _In_ const void* data,
+        _In_ size_t size)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    if (m_failed)
+    {
+        return;
+    }
+
+    if (m_buffer.size() + size > WARM_BOOT_SNAPSHOT_BUFFER_SIZE)
+    {
+        flush();
+    }
+
+    m_buffer.insert(m_buffer.end(), (const char*)data, (const char*)data + size);
+}
+
+void WarmBootSnapshot::appendU32(
+        _In_ uint32_t value)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    append(&value, sizeof(value));
+}
+
+void WarmBootSnapshot::appendString(
+        _In_ const std::string& value)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    appendU32((uint32_t)value.size());
+
+    append(value.data(), value.size());
+}
+
+void WarmBootSnapshot::beginSection(
+        _In_ uint32_t sectionType,
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    m_sectionType = sectionType;
+    m_switchId = switchId;
+    m_size = 0;
+    m_checksum = WARM_BOOT_SNAPSHOT_CHECKSUM_INIT;
+
+    m_headerOffset = ::lseek(m_fd, 0, SEEK_CUR);
+
+    if (m_headerOffset < 0)
+    {
+        SWSS_LOG_ERROR("failed to get warm boot snapshot offset: %s", strerror(errno));
+
+        m_failed = true;
+        return;
+    }
+
+    // header is patched in endSection when payload size and checksum are known
+
+    warm_boot_section_header_t header;
+
+    memset(&header, 0, sizeof(header));
+
+    writeAt(&header, sizeof(header), -1);
+}
+
+bool WarmBootSnapshot::endSection(
+        _In_ uint32_t count)
+{
+    SWSS_LOG_ENTER();
+
+    if (!flush())
+    {
+        return false;
+    }
+
+    warm_boot_section_header_t header;
+
+    memset(&header, 0, sizeof(header));
+
+    header.magic = WARM_BOOT_SNAPSHOT_MAGIC;
+    header.version = WARM_BOOT_SNAPSHOT_VERSION;
+    header.sectionType = m_sectionType;
+    header.count = count;
+    header.switchId = m_switchId;
+    header.size = m_size;
+    header.checksum = m_checksum;
+
+    return writeAt(&header, sizeof(header), m_headerOffset);
+}
+
+bool WarmBootSnapshot::writeObjects(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t objectType,
+        _In_ const ObjectTypeHash& objects)
+{
+    SWSS_LOG_ENTER();
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info == NULL)
+    {
+        SWSS_LOG_THROW("failed to get object type info for object type %d", objectType);
+    }
+
+    beginSection(objectType, switchId);
+
+    for (auto& o: objects)
+    {
+        if (info->isobjectid)
+        {
+            sai_object_id_t oid;
+
+            sai_deserialize_object_id(o.first, oid);
+
+            append(&oid, sizeof(oid));
+        }
+
+        appendString(o.first);
+
+        appendU32((uint32_t)o.second.size());
+
+        for (auto& a: o.second)
+        {
+            appendString(a.first);
+
+            appendString(a.second->getAttrStrValue());
+        }
+    }
+
+    return endSection((uint32_t)objects.size());
+}
+
+bool WarmBootSnapshot::writeFdbInfos(
+        _In_ sai_object_id_t switchId,
+        _In_ const std::set<FdbInfo>& fdbInfoSet)
+{
+    SWSS_LOG_ENTER();
+
+    beginSection(WARM_BOOT_SECTION_FDB_INFO, switchId);
+
+    for (auto& fi: fdbInfoSet)
+    {
+        appendString(fi.serialize());
+    }
+
+    return endSection((uint32_t)fdbInfoSet.size());
+}
+
+bool WarmBootSnapshot::readU32(
+        _Inout_ const char*& pos,
+        _In_ const char* end,
+        _Out_ uint32_t& value)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    if ((size_t)(end - pos) < sizeof(value))
+    {
+        return false;
+    }
+
+    memcpy(&value, pos, sizeof(value));
+
+    pos += sizeof(value);
+
+    return true;
+}
+
+bool WarmBootSnapshot::readU64(
+        _Inout_ const char*& pos,
+        _In_ const char* end,
+        _Out_ uint64_t& value)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    if ((size_t)(end - pos) < sizeof(value))
+    {
+        return false;
+    }
+
+    memcpy(&value, pos, sizeof(value));
+
+    pos += sizeof(value);
+
+    return true;
+}
+
+bool WarmBootSnapshot::readString(
+        _Inout_ const char*& pos,
+        _In_ const char* end,
+        _Out_ std::string& value)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    uint32_t length;
+
+    if (!readU32(pos, end, length) || (size_t)(end - pos) < length)
+    {
+        return false;
+    }
+
+    value.assign(pos, length);
+
+    pos += length;
+
+    return true;
+}
+
+bool WarmBootSnapshot::deserializeObjects(
+        _In_ const char* pos,
+        _In_ const char* end,
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t count,
+        _Inout_ WarmBootState& state,
+        _In_ const std::function<void(sai_object_id_t)>& objectIndexCallback)
+{
+    SWSS_LOG_ENTER();
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info == NULL)
+    {
+        SWSS_LOG_ERROR("invalid object type %d in warm boot snapshot", objectType);
+
+        return false;
+    }
+
+    auto& objectHash = state.m_objectHash[objectType]; // will create if not exist
+
+    objectHash.reserve(objectHash.size() + count);
+
+    std::string strObjectId;
+    std::string strAttrId;
+    std::string strAttrValue;
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        if (info->isobjectid)
+        {
+            uint64_t oid;
+
+            if (!readU64(pos, end, oid))
+            {
+                return false;
+            }
+
+            objectIndexCallback(oid);
+        }
+
+        uint32_t attrCount;
+
+        if (!readString(pos, end, strObjectId) || !readU32(pos, end, attrCount))
+        {
+            return false;
+        }
+
+        auto& attrHash = objectHash[strObjectId];
+
+        for (uint32_t i = 0; i < attrCount; i++)
+        {
+            if (!readString(pos, end, strAttrId) || !readString(pos, end, strAttrValue))
+            {
+                return false;
+            }
+
+            attrHash[strAttrId] = std::make_shared<SaiAttrWrap>(strAttrId, strAttrValue);
+        }
+    }
+
+    return pos == end;
+}
+
+bool WarmBootSnapshot::deserializeFdbInfos(
+        _In_ const char* pos,
+        _In_ const char* end,
+        _In_ uint32_t count,
+        _Inout_ WarmBootState& state)
+{
+    SWSS_LOG_ENTER();
+
+    std::string str;
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        if (!readString(pos, end, str))
+        {
+            return false;
+        }
+
+        state.m_fdbInfoSet.insert(FdbInfo::deserialize(str));
+    }
+
+    return pos == end;
+}
+
+bool WarmBootSnapshot::deserialize(
+        _In_ const char* data,
+        _In_ size_t size,
+        _Inout_ std::map<sai_object_id_t, WarmBootState>& warmBootState,
+        _In_ const std::function<void(sai_object_id_t)>& objectIndexCallback)
+{
+    SWSS_LOG_ENTER();
+
+    const char* pos = data;
+    const char* end = data + size;
+
+    while (pos < end)
+    {
+        warm_boot_section_header_t header;
+
+        if ((size_t)(end - pos) < sizeof(header))
+        {
+            SWSS_LOG_ERROR("warm boot snapshot truncated at offset %zu", (size_t)(pos - data));
+
+            return false;
+        }
+
+        memcpy(&header, pos, sizeof(header));
+
+        pos += sizeof(header);
+
+        if (header.magic != WARM_BOOT_SNAPSHOT_MAGIC || header.version != WARM_BOOT_SNAPSHOT_VERSION)
+        {
+            SWSS_LOG_ERROR("invalid warm boot section header (magic 0x%x, version %u)",
+                    header.magic,
+                    header.version);
+
+            return false;
+        }
+
+        if ((uint64_t)(end - pos) < header.size)
+        {
+            SWSS_LOG_ERROR("warm boot section of type %u truncated", header.sectionType);
+
+            return false;
+        }
+
+        if (checksum(pos, header.size, WARM_BOOT_SNAPSHOT_CHECKSUM_INIT) != header.checksum)
+        {
+            SWSS_LOG_ERROR("warm boot section of type %u checksum mismatch", header.sectionType);
+
+            return false;
+        }
+
+        if (header.switchId == SAI_NULL_OBJECT_ID)
+        {
+            SWSS_LOG_ERROR("warm boot section of type %u has NULL switch id", header.sectionType);
+
+            return false;
+        }
+
+        objectIndexCallback(header.switchId);
+
+        auto& state = warmBootState[header.switchId];
+
+        state.m_switchId = header.switchId;
+
+        const char* sectionEnd = pos + header.size;
+
+        bool success = (header.sectionType == WARM_BOOT_SECTION_FDB_INFO)
+            ? deserializeFdbInfos(pos, sectionEnd, header.count, state)
+            : deserializeObjects(pos, sectionEnd, (sai_object_type_t)header.sectionType, header.count, state, objectIndexCallback);
+
+        if (!success)
+        {
+            SWSS_LOG_ERROR("failed to deserialize warm boot section of type %u", header.sectionType);
+
+            return false;
+        }
+
+        pos = sectionEnd;
+    }
+
+    return true;
+}
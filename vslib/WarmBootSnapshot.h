@@ -0,0 +1,177 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include "WarmBootState.h"
+
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+namespace saivs
+{
+    /**
+     * @brief Binary warm boot snapshot of virtual switch state.
+     *
+     * Snapshot is sequence of sections, each section holds all objects of
+     * single object type or FDB info set of single switch. Section starts
+     * with header containing payload size and payload checksum, so snapshots
+     * of multiple switches can be simply concatenated, and payload can be
+     * parsed directly from memory mapped file.
+     *
+     * Sections are streamed to file descriptor through small buffer, header
+     * is written first and patched with payload size and checksum when
+     * section ends, so snapshot is never held in memory.
+     *
+     * Object record: object id value (only for OID object types), serialized
+     * object id, attribute count and attribute name/serialized value pairs.
+     * Strings are prefixed by 32 bit length and all values are in host byte
+     * order, since snapshot is only read by the same host.
+     */
+    class WarmBootSnapshot
+    {
+        public:
+
+            /**
+             * @brief Creates snapshot writer.
+             *
+             * @param[in] fd File descriptor opened for writing, sections are
+             * written at current file offset, descriptor is not closed.
+             */
+            WarmBootSnapshot(
+                    _In_ int fd);
+
+            virtual ~WarmBootSnapshot();
+
+        public:
+
+            /**
+             * @brief Write section with all objects of given type.
+             *
+             * @return True on success, false on write error.
+             */
+            bool writeObjects(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t objectType,
+                    _In_ const ObjectTypeHash& objects);
+
+            /**
+             * @brief Write section with FDB info set.
+             *
+             * @return True on success, false on write error.
+             */
+            bool writeFdbInfos(
+                    _In_ sai_object_id_t switchId,
+                    _In_ const std::set<FdbInfo>& fdbInfoSet);
+
+        public:
+
+            /**
+             * @brief Checks whether buffer starts with snapshot section.
+             */
+            static bool isSnapshot(
+                    _In_ const char* data,
+                    _In_ size_t size);
+
+            /**
+             * @brief Deserialize snapshot.
+             *
+             * Checksum of every section is verified before section is
+             * parsed. Object index callback is called for every switch and
+             * OID object in snapshot.
+             *
+             * @return True on success, false if snapshot is truncated or
+             * corrupted, in that case content of warm boot state is
+             * undefined.
+             */
+            static bool deserialize(
+                    _In_ const char* data,
+                    _In_ size_t size,
+                    _Inout_ std::map<sai_object_id_t, WarmBootState>& warmBootState,
+                    _In_ const std::function<void(sai_object_id_t)>& objectIndexCallback);
+
+        private:
+
+            static uint64_t checksum(
+                    _In_ const char* data,
+                    _In_ size_t size,
+                    _In_ uint64_t hash);
+
+            void append(
+                    _In_ const void* data,
+                    _In_ size_t size);
+
+            void appendU32(
+                    _In_ uint32_t value);
+
+            void appendString(
+                    _In_ const std::string& value);
+
+            bool flush();
+
+            bool writeAt(
+                    _In_ const void* data,
+                    _In_ size_t size,
+                    _In_ off_t offset);
+
+            void beginSection(
+                    _In_ uint32_t sectionType,
+                    _In_ sai_object_id_t switchId);
+
+            bool endSection(
+                    _In_ uint32_t count);
+
+            static bool readU32(
+                    _Inout_ const char*& pos,
+                    _In_ const char* end,
+                    _Out_ uint32_t& value);
+
+            static bool readU64(
+                    _Inout_ const char*& pos,
+                    _In_ const char* end,
+                    _Out_ uint64_t& value);
+
+            static bool readString(
+                    _Inout_ const char*& pos,
+                    _In_ const char* end,
+                    _Out_ std::string& value);
+
+            static bool deserializeObjects(
+                    _In_ const char* pos,
+                    _In_ const char* end,
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint32_t count,
+                    _Inout_ WarmBootState& state,
+                    _In_ const std::function<void(sai_object_id_t)>& objectIndexCallback);
+
+            static bool deserializeFdbInfos(
+                    _In_ const char* pos,
+                    _In_ const char* end,
+                    _In_ uint32_t count,
+                    _Inout_ WarmBootState& state);
+
+        private:
+
+            int m_fd;
+
+            bool m_failed;
+
+            std::vector<char> m_buffer;
+
+            off_t m_headerOffset;
+
+            uint32_t m_sectionType;
+
+            sai_object_id_t m_switchId;
+
+            uint64_t m_size;
+
+            uint64_t m_checksum;
+    };
+}
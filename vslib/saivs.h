@@ -79,6 +79,29 @@ extern "C" {
  */
 #define SAI_KEY_VS_USE_CONFIGURED_SPEED_AS_OPER_SPEED "SAI_VS_USE_CONFIGURED_SPEED_AS_OPER_SPEED"
 
+/**
+ * @def SAI_KEY_VS_HOSTIF_PACKET_ENGINE_THREADS
+ *
+ * Number of packet engine threads forwarding packets between tap devices
+ * and veth interfaces of all host interfaces. Each thread serves many
+ * host interfaces using epoll and batched socket calls.
+ *
+ * By default this value is 0, and each host interface uses two dedicated
+ * threads.
+ */
+#define SAI_KEY_VS_HOSTIF_PACKET_ENGINE_THREADS "SAI_VS_HOSTIF_PACKET_ENGINE_THREADS"
+
+/**
+ * @def SAI_KEY_VS_HOSTIF_USE_PACKET_RING
+ *
+ * Bool flag, (true/false). If set to true, frames from veth interfaces are
+ * received through memory mapped TPACKET_V3 ring instead of recvmsg, and
+ * VLAN tag is inserted in place.
+ *
+ * By default this flag is set to false.
+ */
+#define SAI_KEY_VS_HOSTIF_USE_PACKET_RING "SAI_VS_HOSTIF_USE_PACKET_RING"
+
 /**
  * @def SAI_KEY_VS_CORE_PORT_INDEX_MAP_FILE
  *